@@ -36,11 +36,33 @@ REDIS_PORT = 6379
 # Keys used in Redis for state persistence
 REDIS_QUEUE_KEY = 'web2wire:job_queue'
 REDIS_STATE_KEY = 'web2wire:device_state'
+REDIS_INFLIGHT_KEY = 'web2wire:device_inflight'
+REDIS_LATENCY_KEY = 'web2wire:job_latency' # Recent per-job latency breakdowns (newest first)
+LATENCY_SAMPLES_KEPT = 1000
 
 # Status States
 STATUS_IDLE = "IDLE"
 STATUS_PROCESSING = "PROCESSING"
 MAX_QUEUE_SIZE = 10 # Reject requests if the queue is larger than this limit
+# Jobs handed to the device at once: the running one plus one queued behind it,
+# which the device renders ahead while the current LED sequence plays.
+DEVICE_PIPELINE_DEPTH = 2
+# Queue polling: slow while the queue is empty, fast while jobs wait for a free device slot
+# (a board in express mode finishes a job in well under a second).
+PROCESSOR_IDLE_POLL_S = 5
+PROCESSOR_BUSY_POLL_S = 0.25
+
+# --- MULTI-DEVICE DISPATCH (OPTIONAL) ---
+# Set WEB2WIRE_DISCOVERY=1 to find boards over mDNS (_web2wire._tcp, see device_discovery.py)
+# and send each job to the one with the most free slots. Without it, every job goes to ESP32_IP.
+DISCOVERY_ENABLED = os.environ.get('WEB2WIRE_DISCOVERY') == '1'
+
+# --- TRAFFIC RECORDING (OPTIONAL) ---
+# Set WEB2WIRE_TRAFFIC_LOG to a file path to append every accepted request as one
+# JSON line: {"ts": <unix seconds>, "job": {"name": ..., "country": ..., "flag": ...}}.
+# backend/replay_traffic.py replays these recordings against a device.
+TRAFFIC_LOG_PATH = os.environ.get('WEB2WIRE_TRAFFIC_LOG')
+traffic_lock = threading.Lock()
 
 # --- APPLICATION STATE & PERSISTENCE (REDIS) ---
 app = Flask(__name__)
@@ -70,12 +92,20 @@ try:
     if not r.get(REDIS_STATE_KEY):
         r.set(REDIS_STATE_KEY, STATUS_IDLE)
         print(f"[INIT] Device state initialized to {STATUS_IDLE} in Redis.")
+    if not r.get(REDIS_INFLIGHT_KEY):
+        r.set(REDIS_INFLIGHT_KEY, 0)
 
 except redis.exceptions.ConnectionError as e:
     print(f"[FATAL] Could not connect to Redis: {e}")
     print("[FATAL] Please ensure Redis server is running on 127.0.0.1:6379.")
     r = None # Set r to None to fail subsequent Redis operations
 
+device_directory = None
+if DISCOVERY_ENABLED:
+    from device_discovery import DeviceDirectory
+    device_directory = DeviceDirectory()
+    print("[INIT] Device discovery enabled (_web2wire._tcp).")
+
 # --- REDIS HELPER FUNCTIONS ---
 
 def _get_device_state():
@@ -90,6 +120,73 @@ def _set_device_state(state):
     if r:
         r.set(REDIS_STATE_KEY, state)
         
+def _get_inflight():
+    """Returns how many jobs the device currently holds (running + queued)."""
+    if r:
+        return int(r.get(REDIS_INFLIGHT_KEY) or 0)
+    return 0
+
+def _job_dispatched():
+    """Counts a job handed to the device and marks it PROCESSING."""
+    if r:
+        r.incr(REDIS_INFLIGHT_KEY)
+    _set_device_state(STATUS_PROCESSING)
+
+def _job_finished():
+    """Counts a job as done (completed or rejected); the device is IDLE once none are left."""
+    inflight = 0
+    if r:
+        inflight = max(r.decr(REDIS_INFLIGHT_KEY), 0)
+        if inflight == 0:
+            r.set(REDIS_INFLIGHT_KEY, 0) # Clamp: buffered completions may arrive after a restart reset the count
+    if inflight == 0:
+        _set_device_state(STATUS_IDLE)
+
+def _record_traffic(job_data):
+    """Appends an accepted request to the traffic recording, if one is configured."""
+    if not TRAFFIC_LOG_PATH:
+        return
+    record = {
+        'ts': job_data['timestamp'],
+        'job': {key: job_data[key] for key in ('name', 'country', 'flag')}
+    }
+    try:
+        with traffic_lock, open(TRAFFIC_LOG_PATH, 'a', encoding='utf-8') as f:
+            f.write(json.dumps(record, ensure_ascii=False) + '\n')
+    except OSError as e:
+        print(f"[ERROR] Could not record traffic to {TRAFFIC_LOG_PATH}: {e}")
+
+def _record_latency(data):
+    """
+    Logs the per-stage breakdown a device sends with a completion and keeps the last
+    LATENCY_SAMPLES_KEPT of them in Redis for the latency SLOs. Stages are ms since the
+    device accepted the job; queue_ms (enqueue to accept) is only there when the device
+    had a wall clock (SNTP, or the 'sent_at' offset). The device cannot time the completion
+    POST it is sending, so with a wall clock its arrival here is added as 'completion_received'.
+    """
+    received_ms = time.time() * 1000
+    latency = data.get('latency')
+    if not isinstance(latency, dict):
+        return
+    stages = latency.get('stages_ms', {})
+    if latency.get('accepted_at_ms') is not None:
+        stages['completion_received'] = round(received_ms - latency['accepted_at_ms'], 1)
+    sample = {
+        'job_name': data.get('job_name'),
+        'device_id': data.get('device_id'),
+        'clock': latency.get('clock'),
+        'queue_ms': latency.get('queue_ms'),
+        'stages_ms': stages,
+    }
+    if sample['queue_ms'] is not None and 'frame_done' in stages:
+        sample['queue_to_pixel_ms'] = round(sample['queue_ms'] + stages['frame_done'], 1)
+    print(f"[LATENCY] {sample['job_name']}: queue {sample['queue_ms']} ms, "
+          + ", ".join(f"{stage} +{ms} ms" for stage, ms in stages.items())
+          + f" (clock: {sample['clock']})")
+    if r:
+        r.lpush(REDIS_LATENCY_KEY, json.dumps(sample))
+        r.ltrim(REDIS_LATENCY_KEY, 0, LATENCY_SAMPLES_KEPT - 1)
+
 def _get_queue_size():
     """Returns the current queue length from Redis."""
     if r:
@@ -107,74 +204,91 @@ def _pop_next_job():
 
 # --- INTERNAL JOB PROCESSING ---
 
-def _send_job_to_esp32(job_data):
+def _next_job_target():
+    """
+    Returns (start URL, discovered device) for the device that should take the next job, or
+    (None, None) if every device is full. With discovery, the choice follows the boards' free
+    slots; otherwise the single ESP32_IP device (no directory entry) is filled up to
+    DEVICE_PIPELINE_DEPTH.
+    """
+    if device_directory is None:
+        return (ESP32_JOB_START_URL if _get_inflight() < DEVICE_PIPELINE_DEPTH else None), None
+    device = device_directory.pick()
+    return (device.job_url, device) if device else (None, None)
+
+def _send_job_to_esp32(job_data, job_url=ESP32_JOB_START_URL, device=None):
     """
     Internal function to send the job request to the ESP32 device.
     Runs in a separate thread.
     """
     
-    # 1. Read current state from Redis
-    device_state = _get_device_state()
-    
-    # Check status outside the lock first for efficiency
-    if device_state != STATUS_IDLE:
-        print(f"[PROCESSOR] Device is busy ({device_state}). Job should have been skipped.")
-        return
-
-    # 2. Update state to PROCESSING in Redis
-    with state_lock:
-        _set_device_state(STATUS_PROCESSING)
-        print(f"[PROCESSOR] State set to {STATUS_PROCESSING}. Sending job to ESP32...")
+    # The processor loop has already counted this job as in flight (see _job_dispatched)
+    print(f"[PROCESSOR] Sending job to ESP32 ({_get_inflight()} in flight)...")
 
     try:
         # Step 3: Server sends the request to esp32
-        print(f"[PROCESSOR] Sending POST request to ESP32 at: {ESP32_JOB_START_URL}")
+        print(f"[PROCESSOR] Sending POST request to ESP32 at: {job_url}")
         
-        # job_data now includes 'flag' field
+        # job_data now includes 'flag' field; 'sent_at' lets a board without SNTP map its clock to ours,
+        # and 'backlog' (jobs still queued here) switches the board to express mode when it grows
         response = requests.post(
-            ESP32_JOB_START_URL, 
-            json=job_data,
+            job_url, 
+            json=dict(job_data, sent_at=time.time(), backlog=_get_queue_size()),
             timeout=5 
         )
         
-        if response.status_code == 202:
+        # 200 = started right away, 202 = queued behind the running job (rendered ahead)
+        if response.status_code in (200, 202):
             print(f"[ESP32] Job successfully handed over. Status: {response.status_code}")
+        elif response.status_code == 429:
+            # Board full after all (another dispatch got there first): the job goes back to the front
+            print(f"[QUEUE] ESP32 at {job_url} is full. Re-queuing job for: {job_data.get('name', 'N/A')}")
+            _handle_device_failure(job_data, requeue=True)
         else:
             print(f"[ERROR] ESP32 device rejected job. Status: {response.status_code}. Response: {response.text}")
             _handle_device_failure(job_data)
 
     except requests.exceptions.RequestException as e:
-        print(f"[ERROR] Communication failed with ESP32 at {ESP32_IP}: {e}")
+        print(f"[ERROR] Communication failed with ESP32 at {job_url}: {e}")
         _handle_device_failure(job_data)
+    finally:
+        if device is not None:
+            device_directory.acknowledge(device)
 
-def _handle_device_failure(failed_job_data):
-    """Handles communication failure or rejection from the ESP32."""
+def _handle_device_failure(failed_job_data, requeue=False):
+    """Handles communication failure or rejection from the ESP32; 'requeue' puts the job back at the front of the queue."""
     with state_lock:
-        _set_device_state(STATUS_IDLE)
-        # Note: If desired, you could re-queue the job here: r.lpush(REDIS_QUEUE_KEY, json.dumps(failed_job_data))
-    print("[ERROR] Device failure handled. State reset to IDLE in Redis.")
+        _job_finished()
+        if requeue and r:
+            r.lpush(REDIS_QUEUE_KEY, json.dumps(failed_job_data))
+    print(f"[ERROR] Device failure handled. State is {_get_device_state()} in Redis.")
 
 
 def _processor_loop():
     """Continuously checks the queue and starts processing if a job is available."""
     while True:
-        device_state = _get_device_state()
         queue_size = _get_queue_size()
         
-        # Only attempt to process if the device is IDLE and the queue is not empty
-        if device_state == STATUS_IDLE and queue_size > 0:
+        # Keep the device pipelines full: send while a device has a free slot
+        job_url, device = _next_job_target() if queue_size > 0 else (None, None)
+        if job_url:
             
             # Safely pop the job from Redis
             next_job = _pop_next_job()
             
             if next_job:
+                with state_lock:
+                    _job_dispatched()
                 print(f"[QUEUE] Popped job for user: {next_job.get('name', 'N/A')}. Country: {next_job.get('country', 'N/A')}. Flag: {next_job.get('flag', 'N/A')}. Queue size remaining: {_get_queue_size()}")
                 
                 # Start the non-blocking process to send the job to the ESP32
-                job_thread = threading.Thread(target=_send_job_to_esp32, args=(next_job,))
+                job_thread = threading.Thread(target=_send_job_to_esp32, args=(next_job, job_url, device))
                 job_thread.start()
+                continue # A device may have more free slots; fill them before sleeping
+            if device is not None:
+                device_directory.acknowledge(device) # Queue emptied under us; give the slot back
             
-        time.sleep(5) # Increased sleep for less log spam while debugging
+        time.sleep(PROCESSOR_BUSY_POLL_S if queue_size > 0 else PROCESSOR_IDLE_POLL_S)
 
 # Start the background processor thread when the server starts
 processor_thread = threading.Thread(target=_processor_loop, daemon=True)
@@ -234,6 +348,7 @@ def new_request():
         job_json = json.dumps(job_data)
         if r:
             r.rpush(REDIS_QUEUE_KEY, job_json)
+        _record_traffic(job_data)
 
         # The new size is the client's position in the queue
         new_queue_size = current_queue_size + 1 
@@ -280,11 +395,12 @@ def job_complete():
     data = request.json
     
     if data and data.get('status') == 'completed':
-        print("[API] Job completion signal received from authorized ESP32. Resetting state.")
+        print("[API] Job completion signal received from authorized ESP32. Updating state.")
+        _record_latency(data)
         
-        # Safely reset device state to IDLE in Redis
+        # The device is IDLE once no dispatched job is left on it
         with state_lock:
-            _set_device_state(STATUS_IDLE)
+            _job_finished()
         
         # The processor thread will automatically check for the next job.
         return jsonify({
@@ -0,0 +1,377 @@
+"""
+Finds Web2Wire boards on the local network and picks the least loaded one for the next job.
+
+Each board advertises _web2wire._tcp over mDNS/DNS-SD with this TXT record:
+
+    id=<MAC>  fw=<version>  caps=queue,timeline,...  depth=<jobs held at once>
+    free=<free slots>  state=idle|busy
+
+TXT load values are throttled on the device, so before a job is sent the chosen
+board is asked for its exact load on GET /api/device/load.
+
+control_api.py uses DeviceDirectory when WEB2WIRE_DISCOVERY=1. The module also
+runs on its own, which allows a multi-board setup to be tried on one host
+(loopback multicast) without hardware:
+
+    python device_discovery.py simulate --count 3    # three fake boards on 127.0.0.1
+    python device_discovery.py browse --loopback     # list boards and their load
+    python device_discovery.py dispatch --loopback --jobs 12
+
+On Linux the loopback interface needs multicast enabled for this:
+    sudo ip link set lo multicast on
+    sudo ip route add 224.0.0.0/4 dev lo
+"""
+import argparse
+import json
+import socket
+import sys
+import threading
+import time
+from http.server import BaseHTTPRequestHandler, ThreadingHTTPServer
+
+import requests
+from zeroconf import InterfaceChoice, ServiceBrowser, ServiceInfo, ServiceStateChange, Zeroconf
+
+SERVICE_TYPE = '_web2wire._tcp.local.'
+LOAD_TIMEOUT_S = 1.0
+INFO_TIMEOUT_MS = 2000
+
+
+class Device:
+    """One advertised board, as last seen in its TXT record (and refined by /api/device/load)."""
+
+    def __init__(self, name, host, port, txt):
+        self.name = name
+        self.host = host
+        self.port = port
+        self.dispatched = 0                   # Picked for a job whose POST has not been answered yet
+        self.update_txt(txt)
+
+    def update_txt(self, txt):
+        self.device_id = txt.get('id', self.name)
+        self.fw = txt.get('fw', '')
+        self.caps = [c for c in txt.get('caps', '').split(',') if c]
+        self.depth = int(txt.get('depth', 1))
+        self.free = int(txt.get('free', 0))
+        self.state = txt.get('state', 'unknown')
+        self.last_seen = time.time()
+
+    @property
+    def base_url(self):
+        return f"http://{self.host}:{self.port}"
+
+    @property
+    def job_url(self):
+        return f"{self.base_url}/api/job/start"
+
+    def refresh_load(self):
+        """
+        Replaces the advertised load with the exact one, less the jobs already on their way
+        to the board (the board cannot count those yet). Returns False if it did not answer.
+        """
+        try:
+            response = requests.get(f"{self.base_url}/api/device/load", timeout=LOAD_TIMEOUT_S)
+            response.raise_for_status()
+            load = response.json()
+        except (requests.exceptions.RequestException, ValueError):
+            return False
+        self.free = max(int(load.get('free_slots', 0)) - self.dispatched, 0)
+        self.depth = int(load.get('depth', self.depth))
+        self.state = load.get('state', self.state)
+        self.last_seen = time.time()
+        return True
+
+    def as_dict(self):
+        return {
+            'id': self.device_id, 'host': self.host, 'port': self.port, 'fw': self.fw,
+            'caps': self.caps, 'depth': self.depth, 'free': self.free, 'state': self.state
+        }
+
+
+def _decode_txt(properties):
+    """zeroconf hands TXT items over as bytes; None values are keys without '='."""
+    txt = {}
+    for key, value in properties.items():
+        key = key.decode('utf-8', 'replace') if isinstance(key, bytes) else key
+        value = value.decode('utf-8', 'replace') if isinstance(value, bytes) else (value or '')
+        txt[key] = value
+    return txt
+
+
+class DeviceDirectory:
+    """Tracks every _web2wire._tcp board on the link and chooses where the next job goes."""
+
+    def __init__(self, loopback=False):
+        self._lock = threading.Lock()
+        self._devices = {}
+        self._zeroconf = Zeroconf(interfaces=['127.0.0.1'] if loopback else InterfaceChoice.All)
+        self._browser = ServiceBrowser(self._zeroconf, SERVICE_TYPE, handlers=[self._on_service_change])
+
+    def _on_service_change(self, zeroconf, service_type, name, state_change):
+        if state_change == ServiceStateChange.Removed:
+            with self._lock:
+                self._devices.pop(name, None)
+            print(f"[DISCOVERY] {name} left.")
+            return
+
+        info = zeroconf.get_service_info(service_type, name, timeout=INFO_TIMEOUT_MS)
+        if not info or not info.parsed_addresses():
+            return
+        txt = _decode_txt(info.properties)
+        with self._lock:
+            device = self._devices.get(name)
+            if device:
+                device.host, device.port = info.parsed_addresses()[0], info.port
+                device.update_txt(txt)
+            else:
+                self._devices[name] = Device(name, info.parsed_addresses()[0], info.port, txt)
+                print(f"[DISCOVERY] {name} at {info.parsed_addresses()[0]}:{info.port} (free {txt.get('free', '?')}/{txt.get('depth', '?')}).")
+
+    def devices(self):
+        with self._lock:
+            return list(self._devices.values())
+
+    def total_capacity(self):
+        return sum(d.depth for d in self.devices())
+
+    def pick(self):
+        """
+        Returns the board with the most free slots (confirmed on /api/device/load), or None
+        if every board is full. The returned board counts one more dispatched job until
+        acknowledge() is called for it, so picks made while earlier POSTs are still in the
+        air do not pile onto the same board.
+        """
+        with self._lock:
+            candidates = sorted(self._devices.values(), key=lambda d: (-d.free, d.last_seen))
+        for device in candidates:
+            if device.free <= 0 and device.state != 'unknown':
+                # Advertised full; only worth a load check if the TXT record is stale
+                if time.time() - device.last_seen < 2.0:
+                    continue
+            if device.refresh_load() and device.free > 0:
+                with self._lock:
+                    device.free -= 1
+                    device.dispatched += 1
+                return device
+        return None
+
+    def acknowledge(self, device):
+        """The POST for a job pick() handed out was answered (or failed); the board's own load covers it now."""
+        with self._lock:
+            device.dispatched = max(device.dispatched - 1, 0)
+
+    def close(self):
+        self._browser.cancel()
+        self._zeroconf.close()
+
+
+# --- SIMULATED DEVICES (host testing) ---
+
+class SimulatedDevice:
+    """
+    A fake board on 127.0.0.1: same status codes as the firmware (200 started, 202 queued,
+    429 full), a fixed job duration, and the same mDNS advertisement and load endpoint.
+    """
+
+    def __init__(self, zeroconf, index, depth, job_seconds, complete_url=None):
+        self.index = index
+        self.depth = depth
+        self.job_seconds = job_seconds
+        self.complete_url = complete_url
+        self.device_id = f"02:00:00:00:00:{index:02X}"
+        self.hostname = f"web2wire-sim{index}"
+        self.jobs = []                        # Names held: running first
+        self.completed = 0
+        self._lock = threading.Lock()
+        self._zeroconf = zeroconf
+
+        self.httpd = ThreadingHTTPServer(('127.0.0.1', 0), self._handler_class())
+        self.port = self.httpd.server_address[1]
+        self.info = self._service_info()
+        threading.Thread(target=self.httpd.serve_forever, daemon=True).start()
+        zeroconf.register_service(self.info)
+
+    def _service_info(self):
+        with self._lock:
+            held = len(self.jobs)
+        return ServiceInfo(
+            SERVICE_TYPE,
+            f"{self.hostname}.{SERVICE_TYPE}",
+            addresses=[socket.inet_aton('127.0.0.1')],
+            port=self.port,
+            properties={
+                'id': self.device_id, 'fw': 'sim', 'caps': 'queue,timeline,flags-iso',
+                'depth': str(self.depth), 'free': str(max(self.depth - held, 0)),
+                'state': 'busy' if held else 'idle'
+            },
+            server=f"{self.hostname}.local."
+        )
+
+    def _readvertise(self):
+        self.info = self._service_info()
+        self._zeroconf.update_service(self.info)
+
+    def load(self):
+        with self._lock:
+            held = len(self.jobs)
+        return {
+            'id': self.device_id, 'hostname': self.hostname, 'fw': 'sim', 'depth': self.depth,
+            'in_flight': held, 'free_slots': max(self.depth - held, 0),
+            'state': 'busy' if held else 'idle', 'completed': self.completed
+        }
+
+    def submit(self, job):
+        with self._lock:
+            if len(self.jobs) >= self.depth:
+                return 429
+            self.jobs.append(job.get('name', 'Unknown Task'))
+            started = len(self.jobs) == 1
+        if started:
+            threading.Thread(target=self._run, daemon=True).start()
+        self._readvertise()
+        return 200 if started else 202
+
+    def _run(self):
+        # Plays held jobs back to back, like the firmware's handoff to the render-ahead job
+        while True:
+            time.sleep(self.job_seconds)
+            with self._lock:
+                name = self.jobs.pop(0)
+                self.completed += 1
+                more = bool(self.jobs)
+            if self.complete_url:
+                try:
+                    requests.post(self.complete_url, json={'job_name': name, 'device_id': self.device_id, 'status': 'completed'}, timeout=2)
+                except requests.exceptions.RequestException:
+                    pass
+            self._readvertise()
+            if not more:
+                return
+
+    def _handler_class(self):
+        device = self
+
+        class Handler(BaseHTTPRequestHandler):
+            def log_message(self, *args):
+                pass
+
+            def _reply(self, status, body):
+                data = json.dumps(body).encode('utf-8')
+                self.send_response(status)
+                self.send_header('Content-Type', 'application/json')
+                self.send_header('Content-Length', str(len(data)))
+                self.end_headers()
+                self.wfile.write(data)
+
+            def do_GET(self):
+                if self.path == '/api/device/load':
+                    self._reply(200, device.load())
+                else:
+                    self._reply(404, {'status': 'error'})
+
+            def do_POST(self):
+                if self.path != '/api/job/start':
+                    self._reply(404, {'status': 'error'})
+                    return
+                try:
+                    job = json.loads(self.rfile.read(int(self.headers.get('Content-Length', 0))) or b'{}')
+                except ValueError:
+                    self._reply(400, {'status': 'error', 'message': 'Invalid JSON payload.'})
+                    return
+                status = device.submit(job)
+                self._reply(status, {'status': {200: 'processing', 202: 'queued', 429: 'busy'}[status]})
+
+        return Handler
+
+    def close(self):
+        self._zeroconf.unregister_service(self.info)
+        self.httpd.shutdown()
+
+
+# --- COMMAND LINE ---
+
+def _cmd_browse(args):
+    directory = DeviceDirectory(loopback=args.loopback)
+    try:
+        time.sleep(args.wait)
+        for device in directory.devices():
+            device.refresh_load()
+            print(json.dumps(device.as_dict()))
+        if not directory.devices():
+            print("No _web2wire._tcp boards found.", file=sys.stderr)
+    finally:
+        directory.close()
+
+
+def _cmd_simulate(args):
+    zeroconf = Zeroconf(interfaces=['127.0.0.1'])
+    devices = [SimulatedDevice(zeroconf, i + 1, args.depth, args.job_seconds, args.complete_url) for i in range(args.count)]
+    for device in devices:
+        print(f"[SIM] {device.hostname} ({device.device_id}) on 127.0.0.1:{device.port}")
+    try:
+        while True:
+            time.sleep(1)
+    except KeyboardInterrupt:
+        pass
+    finally:
+        for device in devices:
+            device.close()
+        zeroconf.close()
+
+
+def _cmd_dispatch(args):
+    """Feeds jobs through DeviceDirectory.pick() the way control_api does and reports the spread."""
+    directory = DeviceDirectory(loopback=args.loopback)
+    per_device = {}
+    try:
+        time.sleep(args.wait)
+        print(f"[DISPATCH] {len(directory.devices())} boards, {directory.total_capacity()} slots.")
+        sent = 0
+        start = time.time()
+        while sent < args.jobs:
+            device = directory.pick()
+            if device is None:
+                time.sleep(0.05)
+                continue
+            job = {'name': f"Job {sent + 1}", 'country': 'Testland', 'flag': 'NL'}
+            try:
+                status = requests.post(device.job_url, json=job, timeout=5).status_code
+            except requests.exceptions.RequestException:
+                status = None
+            directory.acknowledge(device)
+            if status in (200, 202):
+                per_device[device.device_id] = per_device.get(device.device_id, 0) + 1
+                sent += 1
+        print(f"[DISPATCH] {sent} jobs handed out in {time.time() - start:.2f} s: {json.dumps(per_device)}")
+    finally:
+        directory.close()
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Discover Web2Wire boards, or simulate some for host testing.")
+    sub = parser.add_subparsers(dest='command', required=True)
+
+    browse = sub.add_parser('browse', help="List advertised boards and their load")
+    browse.add_argument('--loopback', action='store_true', help="Browse on 127.0.0.1 only (simulated boards)")
+    browse.add_argument('--wait', type=float, default=2.0, help="Seconds to collect announcements")
+    browse.set_defaults(func=_cmd_browse)
+
+    simulate = sub.add_parser('simulate', help="Run fake boards on 127.0.0.1 until Ctrl+C")
+    simulate.add_argument('--count', '-n', type=int, default=3)
+    simulate.add_argument('--depth', type=int, default=2, help="Jobs held at once (running + queued)")
+    simulate.add_argument('--job-seconds', type=float, default=1.5, help="Duration of one simulated LED sequence")
+    simulate.add_argument('--complete-url', help="POST completions here (e.g. a local control_api)")
+    simulate.set_defaults(func=_cmd_simulate)
+
+    dispatch = sub.add_parser('dispatch', help="Spread test jobs across the discovered boards")
+    dispatch.add_argument('--loopback', action='store_true')
+    dispatch.add_argument('--jobs', type=int, default=12)
+    dispatch.add_argument('--wait', type=float, default=2.0)
+    dispatch.set_defaults(func=_cmd_dispatch)
+
+    args = parser.parse_args()
+    args.func(args)
+
+
+if __name__ == '__main__':
+    main()
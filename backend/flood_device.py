@@ -0,0 +1,162 @@
+"""
+Floods a Web2Wire device with requests and reports what it cost the device.
+
+The device's own loop profiler is the CPU meter: GET /api/debug/loop?reset=1 clears it
+before the flood, and afterwards handle_client's mean time per iteration x iterations is
+the time the main loop spent in the web server. With admission control the rejections
+are canned responses, so that share should stay flat however hard the device is pushed.
+
+Kinds of flood (--kind):
+  job      valid POST /api/job/start bodies (busy device -> early 429)
+  large    POST /api/job/start announcing a 1 MB body, headers only (-> 413)
+  slow     header block dripped one byte every 50 ms (-> 408 / in-flight cap)
+  mixed    all of the above, round-robin
+
+Usage:
+    python flood_device.py --device 192.168.2.13 --kind job --connections 32 --seconds 10
+"""
+import argparse
+import collections
+import json
+import re
+import socket
+import threading
+import time
+import urllib.request
+
+REQUEST_TIMEOUT_S = 5
+JOB_BODY = json.dumps({"name": "Flood", "country": "Netherlands", "flag": "NL"})
+
+
+def http_get_json(url):
+    with urllib.request.urlopen(url, timeout=REQUEST_TIMEOUT_S) as response:
+        return json.loads(response.read())
+
+
+def admission_counters(device, port):
+    """Scrapes the rejection counters from /metrics: {series: value}."""
+    with urllib.request.urlopen(f"http://{device}:{port}/metrics", timeout=REQUEST_TIMEOUT_S) as response:
+        text = response.read().decode()
+    counters = {}
+    for name, value in re.findall(r'^(web2wire_(?:admission|jobs)_rejected_total\{[^}]*\}) (\d+)$', text, re.M):
+        counters[name] = int(value)
+    return counters
+
+
+def build_request(kind, host):
+    if kind == 'large':
+        return (f"POST /api/job/start HTTP/1.1\r\nHost: {host}\r\nContent-Type: application/json\r\n"
+                f"Content-Length: 1048576\r\n\r\n").encode()
+    return (f"POST /api/job/start HTTP/1.1\r\nHost: {host}\r\nContent-Type: application/json\r\n"
+            f"Content-Length: {len(JOB_BODY)}\r\nConnection: close\r\n\r\n{JOB_BODY}").encode()
+
+
+def one_request(device, port, kind):
+    """Sends one request and returns (status or error name, seconds)."""
+    start = time.perf_counter()
+    try:
+        with socket.create_connection((device, port), timeout=REQUEST_TIMEOUT_S) as sock:
+            request = build_request('job' if kind == 'slow' else kind, device)
+            if kind == 'slow':
+                head = request[:request.index(b'\r\n\r\n')]
+                for byte in head:
+                    sock.sendall(bytes([byte]))
+                    time.sleep(0.05)
+            else:
+                sock.sendall(request)
+            status_line = sock.recv(64).split(b'\r\n', 1)[0]
+        status = status_line.split(b' ')[1].decode() if status_line.startswith(b'HTTP/') else 'closed'
+    except ConnectionResetError:
+        status = 'reset'
+    except socket.timeout:
+        status = 'timeout'
+    except OSError as e:
+        status = type(e).__name__
+    return status, time.perf_counter() - start
+
+
+def flood(device, port, kinds, connections, seconds):
+    statuses = collections.Counter()
+    latencies = []
+    lock = threading.Lock()
+    deadline = time.perf_counter() + seconds
+
+    def worker(index):
+        n = index
+        while time.perf_counter() < deadline:
+            status, elapsed = one_request(device, port, kinds[n % len(kinds)])
+            n += connections
+            with lock:
+                statuses[status] += 1
+                latencies.append(elapsed)
+
+    threads = [threading.Thread(target=worker, args=(i,), daemon=True) for i in range(connections)]
+    for t in threads:
+        t.start()
+    for t in threads:
+        t.join()
+    return statuses, sorted(latencies)
+
+
+def percentile(sorted_values, p):
+    if not sorted_values:
+        return 0.0
+    return sorted_values[min(len(sorted_values) - 1, int(len(sorted_values) * p / 100))]
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Flood a device and report the web server's share of its main loop.")
+    parser.add_argument('--device', required=True, help="Device IP or hostname")
+    parser.add_argument('--port', type=int, default=80)
+    parser.add_argument('--kind', choices=['job', 'large', 'slow', 'mixed'], default='job')
+    parser.add_argument('--connections', type=int, default=16, help="Concurrent client connections")
+    parser.add_argument('--seconds', type=float, default=10)
+    parser.add_argument('--json', help="Also write the report to this file")
+    args = parser.parse_args()
+
+    base = f"http://{args.device}:{args.port}"
+    kinds = ['job', 'large', 'slow'] if args.kind == 'mixed' else [args.kind]
+
+    counters_before = admission_counters(args.device, args.port)
+    http_get_json(f"{base}/api/debug/loop?reset=1")
+    started = time.perf_counter()
+    statuses, latencies = flood(args.device, args.port, kinds, args.connections, args.seconds)
+    wall = time.perf_counter() - started
+    loop = http_get_json(f"{base}/api/debug/loop")
+    counters_after = admission_counters(args.device, args.port)
+
+    server_us = loop['steps']['handle_client']['mean_us'] * loop['iterations']
+    report = {
+        'kind': args.kind,
+        'connections': args.connections,
+        'seconds': round(wall, 2),
+        'requests': sum(statuses.values()),
+        'requests_per_s': round(sum(statuses.values()) / wall, 1),
+        'statuses': dict(statuses),
+        'client_latency_ms': {p: round(percentile(latencies, p) * 1000, 1) for p in (50, 90, 99)},
+        'device_rejections': {k: counters_after.get(k, 0) - v for k, v in counters_before.items()},
+        'loop': {
+            'iterations': loop['iterations'],
+            'p99_us': loop['p99_us'],
+            'max_us': loop['max_us'],
+            'handle_client_max_us': loop['steps']['handle_client']['max_us'],
+            'handle_client_share': round(server_us / (wall * 1e6), 3),
+        },
+    }
+
+    print(f"{report['requests']} requests in {report['seconds']} s ({report['requests_per_s']}/s) over {args.connections} connections")
+    print(f"  responses:   {', '.join(f'{k}={v}' for k, v in sorted(report['statuses'].items()))}")
+    print(f"  client p50/p90/p99: {report['client_latency_ms'][50]} / {report['client_latency_ms'][90]} / {report['client_latency_ms'][99]} ms")
+    for name, delta in report['device_rejections'].items():
+        print(f"  {name}: +{delta}")
+    print(f"  device loop: p99 {loop['p99_us']} us, max {loop['max_us']} us; "
+          f"web server {report['loop']['handle_client_share'] * 100:.1f}% of the loop "
+          f"(worst call {report['loop']['handle_client_max_us']} us)")
+
+    if args.json:
+        with open(args.json, 'w', encoding='utf-8') as f:
+            json.dump(report, f, indent=2)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,246 @@
+"""
+Replays a recorded traffic file against a Web2Wire device and reports latency distributions.
+
+Traffic files hold one JSON object per line, as written by control_api.py when
+WEB2WIRE_TRAFFIC_LOG is set:
+
+    {"ts": 1718035200.25, "job": {"name": "Ada", "country": "Netherlands", "flag": "NL"}}
+
+Jobs are offered to POST /api/job/start at their recorded spacing (divided by --speed).
+The harness plays the role of the backend queue: a job the device answers with 429
+waits in a local FIFO and is retried. Device progress is followed on the
+GET /api/device/events stream.
+
+Reported per run:
+  * accepted / rejected (400 or unreachable) / busy retries
+  * queue delay:       scheduled send time -> device accepted the job
+  * time to first pixel: accepted -> first render_done event for that job
+  * completion latency: accepted -> completion_sent event for that job
+
+Note: the device still POSTs its completions to COMPLETION_URL. Point it at a
+backend that is not serving real traffic while replaying.
+
+Usage:
+    python replay_traffic.py traffic.jsonl --device 192.168.2.13 --speed 10 --json results.json
+"""
+import argparse
+import collections
+import json
+import sys
+import threading
+import time
+
+import requests
+
+BUSY_RETRY_S = 0.05       # Pause before offering a 429'd job again
+REQUEST_TIMEOUT_S = 5
+
+
+class Job:
+    def __init__(self, index, due, payload):
+        self.index = index
+        self.due = due            # Scheduled send time (perf_counter)
+        self.payload = payload
+        self.accepted = None
+        self.first_pixel = None
+        self.completed = None
+        self.completion_ok = None
+
+
+def load_traffic(path, limit):
+    """Reads a traffic file and returns (offset_seconds, payload) pairs sorted by time."""
+    records = []
+    with open(path, encoding='utf-8') as f:
+        for line_no, line in enumerate(f, 1):
+            line = line.strip()
+            if not line:
+                continue
+            try:
+                record = json.loads(line)
+                records.append((float(record['ts']), record['job']))
+            except (ValueError, KeyError, TypeError) as e:
+                print(f"[WARN] {path}:{line_no}: skipped ({e})", file=sys.stderr)
+    records.sort(key=lambda r: r[0])
+    if limit:
+        records = records[:limit]
+    if not records:
+        return []
+    start = records[0][0]
+    return [(ts - start, job) for ts, job in records]
+
+
+class EventFollower(threading.Thread):
+    """Reads the device's SSE stream and stamps render/completion events onto the matching jobs."""
+
+    def __init__(self, base_url, jobs, lock):
+        super().__init__(daemon=True)
+        self.url = f"{base_url}/api/device/events"
+        self.jobs = jobs            # Accepted jobs in device order
+        self.lock = lock
+        self.connected = threading.Event()
+
+    def _match(self, name, field):
+        # The device processes jobs in order, so the oldest accepted job with a matching
+        # (possibly truncated) name that has not seen this event yet is the one.
+        for job in self.jobs:
+            if getattr(job, field) is None and job.payload.get('name', '').startswith(name):
+                return job
+        return None
+
+    def _handle(self, event, data):
+        now = time.perf_counter()
+        try:
+            body = json.loads(data)
+        except ValueError:
+            return
+        name = body.get('job', '')
+        with self.lock:
+            if event == 'render_done':
+                job = self._match(name, 'first_pixel')
+                if job:
+                    job.first_pixel = now
+            elif event == 'completion_sent':
+                job = self._match(name, 'completed')
+                if job:
+                    job.completed = now
+                    job.completion_ok = body.get('value') == 1
+
+    def run(self):
+        with requests.get(self.url, stream=True, timeout=(REQUEST_TIMEOUT_S, None)) as response:
+            response.raise_for_status()
+            self.connected.set()
+            event, data = None, None
+            # chunk_size=1: the default 512-byte chunks would hold events back until the buffer fills
+            for line in response.iter_lines(chunk_size=1, decode_unicode=True):
+                if line is None:
+                    continue
+                if line.startswith('event: '):
+                    event = line[7:]
+                elif line.startswith('data: '):
+                    data = line[6:]
+                elif line == '' and event and data:
+                    self._handle(event, data)
+                    event, data = None, None
+
+
+def percentile(sorted_values, p):
+    if not sorted_values:
+        return None
+    k = min(len(sorted_values) - 1, max(0, int(round(p / 100.0 * (len(sorted_values) - 1)))))
+    return sorted_values[k]
+
+
+def summarize(values):
+    values = sorted(v * 1000.0 for v in values)
+    if not values:
+        return {"count": 0}
+    return {
+        "count": len(values),
+        "min_ms": round(values[0], 1),
+        "p50_ms": round(percentile(values, 50), 1),
+        "p90_ms": round(percentile(values, 90), 1),
+        "p99_ms": round(percentile(values, 99), 1),
+        "max_ms": round(values[-1], 1),
+    }
+
+
+def replay(args):
+    traffic = load_traffic(args.traffic, args.limit)
+    if not traffic:
+        print("[ERROR] No jobs in traffic file.", file=sys.stderr)
+        return None
+
+    base_url = f"http://{args.device}"
+    lock = threading.Lock()
+    accepted_jobs = []
+    follower = EventFollower(base_url, accepted_jobs, lock)
+    follower.start()
+    if not follower.connected.wait(REQUEST_TIMEOUT_S):
+        print("[ERROR] Could not open the device event stream.", file=sys.stderr)
+        return None
+
+    session = requests.Session()
+    start = time.perf_counter()
+    schedule = collections.deque(Job(i, start + offset / args.speed, job) for i, (offset, job) in enumerate(traffic))
+    waiting = collections.deque()   # Due but not yet accepted (backend queue stand-in)
+    rejected = 0
+    busy_retries = 0
+
+    print(f"[REPLAY] {len(schedule)} jobs over {traffic[-1][0] / args.speed:.1f} s (speed x{args.speed:g}) -> {base_url}")
+    while schedule or waiting:
+        now = time.perf_counter()
+        while schedule and schedule[0].due <= now:
+            waiting.append(schedule.popleft())
+        if not waiting:
+            time.sleep(max(0.0, min(schedule[0].due - now, 0.5)))
+            continue
+
+        job = waiting[0]
+        try:
+            response = session.post(f"{base_url}/api/job/start", json=job.payload, timeout=REQUEST_TIMEOUT_S)
+            status = response.status_code
+        except requests.exceptions.RequestException as e:
+            print(f"[ERROR] Job {job.index}: {e}", file=sys.stderr)
+            status = None
+
+        if status in (200, 202):
+            with lock:
+                job.accepted = time.perf_counter()
+                accepted_jobs.append(job)
+            waiting.popleft()
+        elif status == 429:
+            busy_retries += 1
+            time.sleep(BUSY_RETRY_S)
+        else:
+            rejected += 1
+            waiting.popleft()
+
+    # Let the last jobs finish their sequences
+    deadline = time.perf_counter() + args.drain_timeout
+    while time.perf_counter() < deadline:
+        with lock:
+            if all(j.completed is not None for j in accepted_jobs):
+                break
+        time.sleep(0.1)
+
+    with lock:
+        results = {
+            "traffic": args.traffic,
+            "speed": args.speed,
+            "jobs": len(traffic),
+            "accepted": len(accepted_jobs),
+            "rejected": rejected,
+            "busy_retries": busy_retries,
+            "completion_failures": sum(1 for j in accepted_jobs if j.completion_ok is False),
+            "unfinished": sum(1 for j in accepted_jobs if j.completed is None),
+            "queue_delay": summarize([j.accepted - j.due for j in accepted_jobs]),
+            "time_to_first_pixel": summarize([j.first_pixel - j.accepted for j in accepted_jobs if j.first_pixel]),
+            "completion_latency": summarize([j.completed - j.accepted for j in accepted_jobs if j.completed]),
+        }
+    return results
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Replay recorded Web2Wire traffic against a device.")
+    parser.add_argument('traffic', help="Traffic file (JSON lines with 'ts' and 'job')")
+    parser.add_argument('--device', default="192.168.2.13", help="Device host[:port]")
+    parser.add_argument('--speed', type=float, default=1.0, help="Time acceleration (10 = ten times faster than recorded)")
+    parser.add_argument('--limit', type=int, default=0, help="Replay only the first N jobs")
+    parser.add_argument('--drain-timeout', type=float, default=30.0, help="Seconds to wait for outstanding completions")
+    parser.add_argument('--json', help="Also write the results to this file (for comparing firmware revisions)")
+    args = parser.parse_args()
+    if args.speed <= 0:
+        parser.error("--speed must be positive")
+
+    results = replay(args)
+    if results is None:
+        sys.exit(1)
+
+    print(json.dumps(results, indent=2))
+    if args.json:
+        with open(args.json, 'w', encoding='utf-8') as f:
+            json.dump(results, f, indent=2)
+
+
+if __name__ == '__main__':
+    main()
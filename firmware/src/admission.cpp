@@ -0,0 +1,441 @@
+#include "admission.h"
+#include <WiFi.h>
+#include <lwip/sockets.h>
+#include <errno.h>
+#include <esp_timer.h>
+#include "metrics.h"
+#include "deferred_log.h"
+
+// ******************************************************
+// ** EARLY ADMISSION CONTROL **
+// ******************************************************
+// The stock WebServer resolves the handler, then reads every header into Strings and the
+// whole body into a heap buffer before a handler can say "busy". Here connections are
+// accepted by the subclass instead: each one is held in a small in-flight table until its
+// header block has arrived, which is inspected with recv(MSG_PEEK) so nothing is consumed.
+// An admitted connection is handed to WebServer untouched (status HC_WAIT_READ, exactly as
+// if it had accepted it itself); a rejected one gets a canned response and is closed.
+// URIs with a registered fixed reply (captive-portal probes) are answered the same way.
+
+static const char JOB_START_URI[] = "/api/job/start";
+
+// Canned responses, written in one call. The body is never read, so all of them close the connection.
+static const char RESPONSE_RATE_LIMITED[] =
+    "HTTP/1.1 429 Too Many Requests\r\n"
+    "Content-Type: application/json\r\n"
+    "Retry-After: 1\r\n"
+    "Connection: close\r\n"
+    "Content-Length: 62\r\n"
+    "\r\n"
+    "{\"status\": \"busy\", \"message\": \"Too many requests, slow down.\"}";
+static const char RESPONSE_JOB_BUSY[] =
+    "HTTP/1.1 429 Too Many Requests\r\n"
+    "Content-Type: application/json\r\n"
+    "Retry-After: 1\r\n"
+    "Connection: close\r\n"
+    "Content-Length: 70\r\n"
+    "\r\n"
+    "{\"status\": \"busy\", \"message\": \"Device is currently processing a job.\"}";
+static const char RESPONSE_TOO_LARGE[] =
+    "HTTP/1.1 413 Payload Too Large\r\n"
+    "Content-Type: application/json\r\n"
+    "Connection: close\r\n"
+    "Content-Length: 55\r\n"
+    "\r\n"
+    "{\"status\": \"error\", \"message\": \"Payload is too large.\"}";
+static const char RESPONSE_HEADERS_TOO_LARGE[] =
+    "HTTP/1.1 431 Request Header Fields Too Large\r\n"
+    "Connection: close\r\n"
+    "Content-Length: 0\r\n"
+    "\r\n";
+static const char RESPONSE_LENGTH_REQUIRED[] =
+    "HTTP/1.1 411 Length Required\r\n"
+    "Connection: close\r\n"
+    "Content-Length: 0\r\n"
+    "\r\n";
+static const char RESPONSE_TIMEOUT[] =
+    "HTTP/1.1 408 Request Timeout\r\n"
+    "Connection: close\r\n"
+    "Content-Length: 0\r\n"
+    "\r\n";
+static const char RESPONSE_OVERLOADED[] =
+    "HTTP/1.1 503 Service Unavailable\r\n"
+    "Retry-After: 1\r\n"
+    "Connection: close\r\n"
+    "Content-Length: 0\r\n"
+    "\r\n";
+
+enum Verdict
+{
+    VERDICT_PENDING = 0, // Header block not complete yet
+    VERDICT_CLOSED,      // Peer went away before sending a full header block
+    VERDICT_ADMIT,
+    VERDICT_RATE_LIMITED,
+    VERDICT_JOB_BUSY,
+    VERDICT_TOO_LARGE,
+    VERDICT_LENGTH_REQUIRED, // Chunked body: its size cannot be checked against the route limit
+    VERDICT_HEADERS_TOO_LARGE,
+    VERDICT_CANNED, // Fixed reply registered for the URI (cannedMatch)
+};
+
+struct InFlight
+{
+    WiFiClient client;
+    unsigned long acceptedAt;
+    int64_t acceptedUs; // esp_timer time, for the job latency stamps
+    bool admitted; // Screened, waiting for WebServer to finish the previous request
+};
+
+struct TokenBucket
+{
+    uint32_t source;      // IPv4 address, 0 = unused
+    uint32_t milliTokens; // Tokens x1000, so refill needs no floating point
+    unsigned long refilledAt;
+};
+
+struct RouteLimit
+{
+    const char *uri;
+    uint32_t maxBody;
+};
+
+struct CannedReply
+{
+    const char *uri;
+    const char *response;
+    size_t length;
+};
+
+static InFlight inFlight[ADMISSION_MAX_IN_FLIGHT];
+static TokenBucket buckets[ADMISSION_BUCKET_SOURCES];
+static RouteLimit routeLimits[ADMISSION_MAX_ROUTE_LIMITS] = {{JOB_START_URI, ADMISSION_MAX_JOB_BODY}};
+static int routeLimitCount = 1;
+static CannedReply cannedReplies[ADMISSION_MAX_CANNED];
+static int cannedCount = 0;
+static int cannedMatch = -1; // Set by screen() along with VERDICT_CANNED
+static char peekBuffer[ADMISSION_PEEK_BYTES + 1];
+
+static int64_t currentAcceptedUs = 0; // Accept time of the connection WebServer is handling
+static AdmissionLoadFn loadFn = nullptr;
+static int jobDepth = 1;
+
+// --- SCREENING ---
+
+static bool takeToken(uint32_t source, unsigned long now)
+{
+    TokenBucket *bucket = nullptr;
+    TokenBucket *oldest = &buckets[0];
+    for (int i = 0; i < ADMISSION_BUCKET_SOURCES; i++)
+    {
+         if (buckets[i].source == source)
+         {
+             bucket = &buckets[i];
+             break;
+         }
+         if (buckets[i].source == 0 || (oldest->source != 0 && buckets[i].refilledAt < oldest->refilledAt))
+         {
+             oldest = &buckets[i];
+         }
+    }
+    if (!bucket)
+    {
+         bucket = oldest;
+         bucket->source = source;
+         bucket->milliTokens = ADMISSION_BUCKET_BURST * 1000;
+         bucket->refilledAt = now;
+    }
+
+    // ms x tokens/s = milli-tokens; the elapsed time is capped at a full refill so it cannot overflow
+    uint32_t elapsed = min<uint32_t>(now - bucket->refilledAt, ADMISSION_BUCKET_BURST * 1000 / ADMISSION_BUCKET_PER_SECOND);
+    uint32_t refill = elapsed * ADMISSION_BUCKET_PER_SECOND;
+    bucket->milliTokens = min<uint32_t>(bucket->milliTokens + refill, ADMISSION_BUCKET_BURST * 1000);
+    bucket->refilledAt = now;
+    if (bucket->milliTokens < 1000)
+    {
+         return false;
+    }
+    bucket->milliTokens -= 1000;
+    return true;
+}
+
+// Finds a header's value in the peeked block (case-insensitive name match at a line start).
+static const char *findHeader(const char *headers, const char *name)
+{
+    size_t nameLen = strlen(name);
+    for (const char *line = strstr(headers, "\r\n"); line; line = strstr(line + 2, "\r\n"))
+    {
+         if (strncasecmp(line + 2, name, nameLen) == 0 && line[2 + nameLen] == ':')
+         {
+             const char *value = line + 3 + nameLen;
+             while (*value == ' ' || *value == '\t')
+             {
+                 value++;
+             }
+             return value;
+         }
+    }
+    return nullptr;
+}
+
+static uint32_t bodyLimitFor(const char *uri, size_t uriLen)
+{
+    for (int i = 0; i < routeLimitCount; i++)
+    {
+         if (strlen(routeLimits[i].uri) == uriLen && strncmp(routeLimits[i].uri, uri, uriLen) == 0)
+         {
+             return routeLimits[i].maxBody;
+         }
+    }
+    return ADMISSION_MAX_BODY;
+}
+
+static Verdict screen(WiFiClient &client, unsigned long now)
+{
+    int peeked = recv(client.fd(), peekBuffer, ADMISSION_PEEK_BYTES, MSG_PEEK | MSG_DONTWAIT);
+    if (peeked == 0 || (peeked < 0 && errno != EAGAIN && errno != EWOULDBLOCK))
+    {
+         return VERDICT_CLOSED;
+    }
+    if (peeked < 0)
+    {
+         return VERDICT_PENDING;
+    }
+    peekBuffer[peeked] = '\0';
+    char *headerEnd = strstr(peekBuffer, "\r\n\r\n");
+    if (!headerEnd)
+    {
+         return peeked >= ADMISSION_PEEK_BYTES ? VERDICT_HEADERS_TOO_LARGE : VERDICT_PENDING;
+    }
+    headerEnd[2] = '\0'; // Keep the last header's CRLF so findHeader sees every line
+
+    if (!takeToken((uint32_t)client.remoteIP(), now))
+    {
+         return VERDICT_RATE_LIMITED;
+    }
+
+    // Request line: METHOD SP /path[?query] SP HTTP/1.x
+    const char *uri = strchr(peekBuffer, ' ');
+    if (!uri)
+    {
+         return VERDICT_ADMIT; // Malformed; WebServer answers it as usual
+    }
+    uri++;
+    size_t uriLen = strcspn(uri, " ?\r");
+    bool isPost = strncmp(peekBuffer, "POST ", 5) == 0;
+
+    for (int i = 0; i < cannedCount; i++)
+    {
+         if (strlen(cannedReplies[i].uri) == uriLen && strncmp(cannedReplies[i].uri, uri, uriLen) == 0)
+         {
+             cannedMatch = i;
+             return VERDICT_CANNED;
+         }
+    }
+
+    // Every route has a body limit, and WebServer would buffer a chunked body without one
+    const char *transferEncoding = findHeader(peekBuffer, "Transfer-Encoding");
+    if (transferEncoding && strncasecmp(transferEncoding, "identity", 8) != 0)
+    {
+         return VERDICT_LENGTH_REQUIRED;
+    }
+
+    const char *contentLength = findHeader(peekBuffer, "Content-Length");
+    if (contentLength && strtoul(contentLength, nullptr, 10) > bodyLimitFor(uri, uriLen))
+    {
+         return VERDICT_TOO_LARGE;
+    }
+
+    if (isPost && loadFn && uriLen == sizeof(JOB_START_URI) - 1 && strncmp(uri, JOB_START_URI, uriLen) == 0 &&
+        loadFn() >= jobDepth)
+    {
+         return VERDICT_JOB_BUSY;
+    }
+    return VERDICT_ADMIT;
+}
+
+// Writes a canned response (rejection or fixed reply) and closes the connection.
+static void reject(WiFiClient &client, const char *response, size_t len)
+{
+    client.write((const uint8_t *)response, len);
+    // Discard what has already arrived (headers, small bodies): closing with unread data
+    // makes lwIP send a RST, which can destroy the response before the client reads it.
+    for (int drained = 0; drained < 2 * ADMISSION_PEEK_BYTES;)
+    {
+         int n = recv(client.fd(), peekBuffer, ADMISSION_PEEK_BYTES, MSG_DONTWAIT);
+         if (n <= 0)
+         {
+             break;
+         }
+         drained += n;
+    }
+    client.stop();
+    client = WiFiClient();
+}
+
+#define REJECT(client, response) reject(client, response, sizeof(response) - 1)
+
+// --- SERVER ---
+
+void AdmissionWebServer::handleClient()
+{
+    unsigned long now = millis();
+
+    // 1. Accept everything that is waiting; past the in-flight cap, answer 503 straight away
+    for (int accepted = 0; accepted < ADMISSION_MAX_ACCEPTS_PER_LOOP; accepted++)
+    {
+         WiFiClient client = _server.available();
+         if (!client)
+         {
+             break;
+         }
+         int free = -1;
+         for (int i = 0; i < ADMISSION_MAX_IN_FLIGHT; i++)
+         {
+             if (!inFlight[i].client)
+             {
+                 free = i;
+                 break;
+             }
+         }
+         if (free < 0)
+         {
+             REJECT(client, RESPONSE_OVERLOADED);
+             metricsIncrement(COUNTER_ADMISSION_REJECTED_OVERLOAD);
+             continue;
+         }
+         inFlight[free].client = client;
+         inFlight[free].acceptedAt = now;
+         inFlight[free].acceptedUs = esp_timer_get_time();
+         inFlight[free].admitted = false;
+    }
+
+    // 2. Screen the connections whose header block has arrived
+    int next = -1;
+    for (int i = 0; i < ADMISSION_MAX_IN_FLIGHT; i++)
+    {
+         InFlight &slot = inFlight[i];
+         if (!slot.client)
+         {
+             continue;
+         }
+         if (!slot.admitted)
+         {
+             switch (screen(slot.client, now))
+             {
+             case VERDICT_PENDING:
+                 if (now - slot.acceptedAt > ADMISSION_HEADER_TIMEOUT_MS)
+                 {
+                     REJECT(slot.client, RESPONSE_TIMEOUT);
+                     metricsIncrement(COUNTER_ADMISSION_REJECTED_OVERLOAD);
+                 }
+                 continue;
+             case VERDICT_CLOSED:
+                 slot.client.stop(); // Free the slot now rather than at the header timeout
+                 slot.client = WiFiClient();
+                 continue;
+             case VERDICT_RATE_LIMITED:
+                 REJECT(slot.client, RESPONSE_RATE_LIMITED);
+                 metricsIncrement(COUNTER_ADMISSION_REJECTED_RATE);
+                 continue;
+             case VERDICT_JOB_BUSY:
+                 REJECT(slot.client, RESPONSE_JOB_BUSY);
+                 metricsIncrement(COUNTER_JOBS_REJECTED_BUSY);
+                 continue;
+             case VERDICT_TOO_LARGE:
+                 REJECT(slot.client, RESPONSE_TOO_LARGE);
+                 metricsIncrement(COUNTER_ADMISSION_REJECTED_TOO_LARGE);
+                 continue;
+             case VERDICT_LENGTH_REQUIRED:
+                 REJECT(slot.client, RESPONSE_LENGTH_REQUIRED);
+                 metricsIncrement(COUNTER_ADMISSION_REJECTED_TOO_LARGE);
+                 continue;
+             case VERDICT_HEADERS_TOO_LARGE:
+                 REJECT(slot.client, RESPONSE_HEADERS_TOO_LARGE);
+                 metricsIncrement(COUNTER_ADMISSION_REJECTED_TOO_LARGE);
+                 continue;
+             case VERDICT_CANNED:
+                 reject(slot.client, cannedReplies[cannedMatch].response, cannedReplies[cannedMatch].length);
+                 continue;
+             case VERDICT_ADMIT:
+                 slot.admitted = true;
+                 break;
+             }
+         }
+         if (next < 0 || slot.acceptedAt < inFlight[next].acceptedAt)
+         {
+             next = i; // Oldest admitted connection goes first
+         }
+    }
+
+    // 3. Hand the oldest admitted connection to the stock parser once it is free
+    if (_currentStatus == HC_NONE)
+    {
+         if (next < 0)
+         {
+             if (_nullDelay)
+             {
+                 delay(1); // Same idle yield as WebServer::handleClient()
+             }
+             return;
+         }
+         _currentClient = inFlight[next].client;
+         _currentStatus = HC_WAIT_READ;
+         _statusChange = now;
+         currentAcceptedUs = inFlight[next].acceptedUs;
+         inFlight[next].client = WiFiClient();
+    }
+    WebServer::handleClient();
+}
+
+WiFiClient AdmissionWebServer::detachClient()
+{
+    WiFiClient client = _currentClient;
+    _currentClient = WiFiClient(); // Not connected(), so WebServer drops it instead of HC_WAIT_CLOSE
+    _currentStatus = HC_NONE;
+    return client;
+}
+
+// --- PUBLIC API ---
+
+void setupAdmission(int pipelineDepth, AdmissionLoadFn load)
+{
+    jobDepth = pipelineDepth;
+    loadFn = load;
+}
+
+void admissionLimitBody(const char *uri, uint32_t maxBytes)
+{
+    for (int i = 0; i < routeLimitCount; i++)
+    {
+         if (strcmp(routeLimits[i].uri, uri) == 0)
+         {
+             routeLimits[i].maxBody = maxBytes;
+             return;
+         }
+    }
+    if (routeLimitCount < ADMISSION_MAX_ROUTE_LIMITS)
+    {
+         routeLimits[routeLimitCount++] = {uri, maxBytes};
+    }
+    else
+    {
+         LOG_WARN("Admission: no room for a body limit on %s\n", uri);
+    }
+}
+
+void admissionCannedReply(const char *uri, const char *response, size_t length)
+{
+    if (cannedCount < ADMISSION_MAX_CANNED)
+    {
+         cannedReplies[cannedCount++] = {uri, response, length};
+    }
+    else
+    {
+         LOG_WARN("Admission: no room for a canned reply on %s\n", uri);
+    }
+}
+
+int64_t admissionAcceptedAtUs()
+{
+    return currentAcceptedUs;
+}
@@ -0,0 +1,70 @@
+#ifndef ADMISSION_H
+#define ADMISSION_H
+
+#include <Arduino.h>
+#include <WebServer.h>
+
+// --- ADMISSION CONFIGURATION ---
+// Connections are screened from their peeked request line and headers before WebServer
+// reads (and heap-buffers) anything, so a flood is turned away for the cost of one recv().
+#define ADMISSION_MAX_IN_FLIGHT 4          // Connections accepted but not yet answered; extra ones get 503
+#define ADMISSION_MAX_ACCEPTS_PER_LOOP 8   // Bounds the work one handleClient() call spends accepting
+#define ADMISSION_HEADER_TIMEOUT_MS 2000   // Time a connection gets to deliver its full header block
+#define ADMISSION_PEEK_BYTES 1536          // Largest header block screened; bigger ones get 431
+#define ADMISSION_BUCKET_SOURCES 16        // Per-source token buckets (least recently seen is recycled)
+#define ADMISSION_BUCKET_BURST 20          // Requests a source may send back to back
+#define ADMISSION_BUCKET_PER_SECOND 10     // Sustained requests per second per source
+#define ADMISSION_MAX_BODY 1024            // Content-Length limit for routes without their own
+#define ADMISSION_MAX_JOB_BODY 2048        // POST /api/job/start (16-keyframe timeline plus text)
+#define ADMISSION_MAX_ROUTE_LIMITS 4
+#define ADMISSION_MAX_CANNED 12            // URIs answered with a fixed response (captive-portal probes)
+
+// Returns how many jobs the device holds right now (running + queued).
+typedef int (*AdmissionLoadFn)();
+
+/**
+ * @brief WebServer that accepts connections itself and only hands admitted ones to the
+ * stock request parser. Rejections (429 rate/busy, 413, 411, 431, 408, 503) are written from
+ * precomputed responses without reading the body.
+ */
+class AdmissionWebServer : public WebServer
+{
+public:
+    AdmissionWebServer(int port = 80) : WebServer(port) {}
+    void handleClient() override;
+
+    /**
+     * @brief Takes the connection of the request being handled away from WebServer, for
+     * handlers that keep the socket open (event streams). The server is free for the next
+     * admitted connection as soon as the handler returns instead of waiting for it to close.
+     * Only call from inside a route handler, after the response headers are written.
+     */
+    WiFiClient detachClient();
+};
+
+/**
+ * @brief Enables the early busy check for POST /api/job/start.
+ * @param pipelineDepth Jobs the device accepts at once (running + queued).
+ * @param load Callback reporting the current number of held jobs.
+ */
+void setupAdmission(int pipelineDepth, AdmissionLoadFn load);
+
+/**
+ * @brief Raises (or lowers) the Content-Length limit for one route, e.g. an upload.
+ */
+void admissionLimitBody(const char *uri, uint32_t maxBytes);
+
+/**
+ * @brief Answers every request for 'uri' with a fixed response, written on the accept path
+ * without WebServer parsing the request. 'response' is a complete HTTP message and must
+ * outlive the server (a string literal).
+ */
+void admissionCannedReply(const char *uri, const char *response, size_t length);
+
+/**
+ * @brief When the connection of the request being handled was accepted (esp_timer_get_time()).
+ * Only meaningful inside a route handler.
+ */
+int64_t admissionAcceptedAtUs();
+
+#endif // ADMISSION_H
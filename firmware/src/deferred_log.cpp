@@ -0,0 +1,280 @@
+#include "deferred_log.h"
+
+// ******************************************************
+// ** DEFERRED BINARY LOGGER **
+// ******************************************************
+// Producers copy a compact record into a byte ring under a short spinlock and
+// return. A low-priority task on core 0 pops records, expands the format string
+// and writes to the UART, so 115200 baud never shows up on the job hot path.
+
+static const char *LEVEL_TAGS[] = {"", "E", "W", "I", "D"};
+
+static uint8_t logRing[LOG_RING_SIZE];
+static uint32_t logHead = 0; // Total bytes written
+static uint32_t logTail = 0; // Total bytes consumed
+static uint32_t logDropped = 0;
+static portMUX_TYPE logMux = portMUX_INITIALIZER_UNLOCKED;
+static TaskHandle_t logTask = nullptr;
+
+// --- ENCODING ---
+
+LogRecordWriter::LogRecordWriter(uint8_t level, const char *fmt) : _len(sizeof(LogRecordHeader))
+{
+    LogRecordHeader header;
+    header.fmt = fmt;
+    header.timestamp = millis();
+    header.level = level;
+    header.length = 0;
+    memcpy(_buf, &header, sizeof(header));
+}
+
+void LogRecordWriter::addWord(char tag, uint32_t word)
+{
+    if (_len + 5 > LOG_MAX_RECORD)
+    {
+         return;
+    }
+    _buf[_len++] = tag;
+    memcpy(_buf + _len, &word, sizeof(word));
+    _len += sizeof(word);
+}
+
+void LogRecordWriter::addFloat(float v)
+{
+    uint32_t word;
+    memcpy(&word, &v, sizeof(word));
+    addWord('f', word);
+}
+
+void LogRecordWriter::add(const char *v)
+{
+    if (v == nullptr)
+    {
+         v = "(null)";
+    }
+    size_t n = strnlen(v, LOG_MAX_STRING_ARG);
+    if (_len + 2 + n > LOG_MAX_RECORD)
+    {
+         n = _len + 2 < LOG_MAX_RECORD ? LOG_MAX_RECORD - _len - 2 : 0;
+    }
+    if (_len + 2 > LOG_MAX_RECORD)
+    {
+         return;
+    }
+    _buf[_len++] = 's';
+    _buf[_len++] = (uint8_t)n;
+    memcpy(_buf + _len, v, n);
+    _len += n;
+}
+
+void LogRecordWriter::commit()
+{
+    _buf[offsetof(LogRecordHeader, length)] = (uint8_t)_len;
+
+    portENTER_CRITICAL(&logMux);
+    if (LOG_RING_SIZE - (logHead - logTail) < _len)
+    {
+         logDropped++;
+         portEXIT_CRITICAL(&logMux);
+         return;
+    }
+    size_t start = logHead % LOG_RING_SIZE;
+    size_t first = min<size_t>(_len, LOG_RING_SIZE - start);
+    memcpy(logRing + start, _buf, first);
+    memcpy(logRing, _buf + first, _len - first);
+    logHead += _len;
+    portEXIT_CRITICAL(&logMux);
+
+    if (logTask != nullptr)
+    {
+         xTaskNotifyGive(logTask);
+    }
+}
+
+// --- DECODING ---
+
+// Pops one whole record into 'out'. Returns its length, or 0 when the ring is empty.
+static size_t popRecord(uint8_t *out)
+{
+    size_t len = 0;
+    portENTER_CRITICAL(&logMux);
+    if (logHead != logTail)
+    {
+         size_t start = logTail % LOG_RING_SIZE;
+         uint8_t header[sizeof(LogRecordHeader)];
+         for (size_t i = 0; i < sizeof(header); i++)
+         {
+             header[i] = logRing[(start + i) % LOG_RING_SIZE];
+         }
+         len = header[offsetof(LogRecordHeader, length)];
+         size_t first = min<size_t>(len, LOG_RING_SIZE - start);
+         memcpy(out, logRing + start, first);
+         memcpy(out + first, logRing, len - first);
+         logTail += len;
+    }
+    portEXIT_CRITICAL(&logMux);
+    return len;
+}
+
+// Expands a record's format string one conversion at a time, using the tagged argument for each.
+static void formatRecord(const uint8_t *rec, size_t len, char *out, size_t outLen)
+{
+    LogRecordHeader header;
+    memcpy(&header, rec, sizeof(header));
+    size_t pos = sizeof(header);
+
+    int o = snprintf(out, outLen, "[%lu][%s] ", (unsigned long)header.timestamp, LEVEL_TAGS[header.level]);
+    const char *f = header.fmt;
+
+    while (*f && o < (int)outLen - 1)
+    {
+         if (*f != '%')
+         {
+             out[o++] = *f++;
+             continue;
+         }
+         if (f[1] == '%')
+         {
+             out[o++] = '%';
+             f += 2;
+             continue;
+         }
+
+         // Copy one conversion spec (flags, width, precision, length, conversion).
+         char spec[16];
+         size_t s = 0;
+         spec[s++] = *f++;
+         while (*f && !strchr("diuxXcsfFeEgGp", *f) && s < sizeof(spec) - 2)
+         {
+             spec[s++] = *f++;
+         }
+         if (*f)
+         {
+             spec[s++] = *f++;
+         }
+         spec[s] = '\0';
+         char conv = spec[s - 1];
+
+         int n = 0;
+         size_t room = outLen - o;
+         if (pos >= len)
+         {
+             n = snprintf(out + o, room, "<?>");
+         }
+         else if (rec[pos] == 's')
+         {
+             char str[LOG_MAX_STRING_ARG + 1];
+             size_t sl = rec[pos + 1];
+             memcpy(str, rec + pos + 2, sl);
+             str[sl] = '\0';
+             pos += 2 + sl;
+             n = conv == 's' ? snprintf(out + o, room, spec, str) : snprintf(out + o, room, "%s", str);
+         }
+         else
+         {
+             char tag = rec[pos];
+             uint32_t word;
+             memcpy(&word, rec + pos + 1, sizeof(word));
+             pos += 5;
+             if (tag == 'f')
+             {
+                  float v;
+                  memcpy(&v, &word, sizeof(v));
+                  n = snprintf(out + o, room, strchr("fFeEgG", conv) ? spec : "%g", (double)v);
+             }
+             else if (conv == 'p')
+             {
+                  n = snprintf(out + o, room, "0x%08lx", (unsigned long)word);
+             }
+             else if (strchr("fFeEgGs", conv))
+             {
+                  n = tag == 'i' ? snprintf(out + o, room, "%ld", (long)(int32_t)word) : snprintf(out + o, room, "%lu", (unsigned long)word);
+             }
+             else
+             {
+                  // Normalise the length modifier so a 32-bit word is always passed as a long.
+                  char spec32[20];
+                  size_t k = 0;
+                  for (size_t i = 0; i + 1 < s && k < sizeof(spec32) - 3; i++)
+                  {
+                      if (spec[i] != 'l' && spec[i] != 'h' && spec[i] != 'z')
+                      {
+                           spec32[k++] = spec[i];
+                      }
+                  }
+                  if (conv != 'c')
+                  {
+                      spec32[k++] = 'l';
+                  }
+                  spec32[k++] = conv;
+                  spec32[k] = '\0';
+                  if (conv == 'c')
+                  {
+                      n = snprintf(out + o, room, spec32, (int)word);
+                  }
+                  else if (tag == 'i')
+                  {
+                      n = snprintf(out + o, room, spec32, (long)(int32_t)word);
+                  }
+                  else
+                  {
+                      n = snprintf(out + o, room, spec32, (unsigned long)word);
+                  }
+             }
+         }
+         if (n > 0)
+         {
+             o = min<int>(o + n, outLen - 1);
+         }
+    }
+    out[o] = '\0';
+}
+
+static void drainOnce()
+{
+    uint8_t rec[LOG_MAX_RECORD];
+    char line[256];
+    size_t len;
+    while ((len = popRecord(rec)) > 0)
+    {
+         formatRecord(rec, len, line, sizeof(line));
+         Serial.print(line);
+    }
+}
+
+static void logTaskMain(void *)
+{
+    uint32_t reportedDrops = 0;
+    for (;;)
+    {
+         ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(100));
+         drainOnce();
+         if (logDropped != reportedDrops)
+         {
+             Serial.printf("[log] %lu records dropped (ring full)\n", (unsigned long)(logDropped - reportedDrops));
+             reportedDrops = logDropped;
+         }
+    }
+}
+
+// --- PUBLIC API ---
+
+void startDeferredLog()
+{
+    if (logTask == nullptr)
+    {
+         // Priority 1 on core 0: below the WiFi/LwIP tasks, off the core that runs loop().
+         xTaskCreatePinnedToCore(logTaskMain, "deferred_log", 3072, nullptr, 1, &logTask, 0);
+    }
+}
+
+void flushDeferredLog()
+{
+    drainOnce();
+    Serial.flush();
+}
+
+uint32_t deferredLogDropped()
+{
+    return logDropped;
+}
@@ -0,0 +1,129 @@
+#ifndef DEFERRED_LOG_H
+#define DEFERRED_LOG_H
+
+#include <Arduino.h>
+
+// --- DEFERRED LOGGER CONFIGURATION ---
+#define LOG_LEVEL_NONE 0
+#define LOG_LEVEL_ERROR 1
+#define LOG_LEVEL_WARN 2
+#define LOG_LEVEL_INFO 3
+#define LOG_LEVEL_DEBUG 4
+
+// Compile-time level: calls above it expand to nothing (arguments are not evaluated).
+// Override with -D DEFERRED_LOG_LEVEL=... in platformio.ini build_flags.
+#ifndef DEFERRED_LOG_LEVEL
+#define DEFERRED_LOG_LEVEL LOG_LEVEL_INFO
+#endif
+
+#define LOG_RING_SIZE 4096     // Bytes of binary records buffered between producer and drain task
+#define LOG_MAX_RECORD 96      // Largest encoded record (header + arguments)
+#define LOG_MAX_STRING_ARG 40  // String arguments are copied and truncated to this many bytes
+
+// ******************************************************
+// ** BINARY RECORD ENCODING **
+// ******************************************************
+// A record is a header (format string pointer as its id, millis() timestamp,
+// level, length) followed by tagged arguments. The format string itself is
+// never copied - it lives in flash - and is only expanded by the drain task.
+
+struct LogRecordHeader
+{
+    const char *fmt;
+    uint32_t timestamp;
+    uint8_t level;
+    uint8_t length; // Header + arguments, in bytes
+};
+
+class LogRecordWriter
+{
+public:
+    LogRecordWriter(uint8_t level, const char *fmt);
+
+    // Every argument is promoted onto one of four encodings: int32, uint32, float or string.
+    void add(int v) { addWord('i', (int32_t)v); }
+    void add(long v) { addWord('i', (int32_t)v); }
+    void add(short v) { addWord('i', (int32_t)v); }
+    void add(signed char v) { addWord('i', (int32_t)v); }
+    void add(char v) { addWord('i', (int32_t)v); }
+    void add(bool v) { addWord('i', (int32_t)v); }
+    void add(unsigned v) { addWord('u', (uint32_t)v); }
+    void add(unsigned long v) { addWord('u', (uint32_t)v); }
+    void add(unsigned short v) { addWord('u', (uint32_t)v); }
+    void add(unsigned char v) { addWord('u', (uint32_t)v); }
+    void add(float v) { addFloat(v); }
+    void add(double v) { addFloat((float)v); }
+    void add(const char *v);
+    void add(const String &v) { add(v.c_str()); }
+
+    void commit();
+
+private:
+    void addWord(char tag, uint32_t word);
+    void addFloat(float v);
+
+    uint8_t _buf[LOG_MAX_RECORD];
+    size_t _len;
+};
+
+/**
+ * @brief Starts the low-priority task that formats queued records and writes them to Serial.
+ */
+void startDeferredLog();
+
+/**
+ * @brief Formats and prints every queued record synchronously (e.g. right before a restart).
+ */
+void flushDeferredLog();
+
+/**
+ * @brief Records dropped because the ring was full since boot.
+ */
+uint32_t deferredLogDropped();
+
+inline void deferredLogArgs(LogRecordWriter &) {}
+
+template <typename T, typename... Rest>
+inline void deferredLogArgs(LogRecordWriter &w, const T &first, const Rest &...rest)
+{
+    w.add(first);
+    deferredLogArgs(w, rest...);
+}
+
+/**
+ * @brief Encodes one record into the ring. Never blocks and never touches the UART.
+ */
+template <typename... Args>
+inline void deferredLog(uint8_t level, const char *fmt, const Args &...args)
+{
+    LogRecordWriter w(level, fmt);
+    deferredLogArgs(w, args...);
+    w.commit();
+}
+
+// --- LOGGING MACROS ---
+#if DEFERRED_LOG_LEVEL >= LOG_LEVEL_ERROR
+#define LOG_ERROR(...) deferredLog(LOG_LEVEL_ERROR, __VA_ARGS__)
+#else
+#define LOG_ERROR(...) do {} while (0)
+#endif
+
+#if DEFERRED_LOG_LEVEL >= LOG_LEVEL_WARN
+#define LOG_WARN(...) deferredLog(LOG_LEVEL_WARN, __VA_ARGS__)
+#else
+#define LOG_WARN(...) do {} while (0)
+#endif
+
+#if DEFERRED_LOG_LEVEL >= LOG_LEVEL_INFO
+#define LOG_INFO(...) deferredLog(LOG_LEVEL_INFO, __VA_ARGS__)
+#else
+#define LOG_INFO(...) do {} while (0)
+#endif
+
+#if DEFERRED_LOG_LEVEL >= LOG_LEVEL_DEBUG
+#define LOG_DEBUG(...) deferredLog(LOG_LEVEL_DEBUG, __VA_ARGS__)
+#else
+#define LOG_DEBUG(...) do {} while (0)
+#endif
+
+#endif // DEFERRED_LOG_H
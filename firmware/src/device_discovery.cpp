@@ -0,0 +1,108 @@
+#include "device_discovery.h"
+#include <ESPmDNS.h>
+#include <WiFi.h>
+#include <ArduinoJson.h>
+#include "deferred_log.h"
+#include "job_pacing.h"
+
+// ******************************************************
+// ** CAPACITY ADVERTISEMENT (mDNS/DNS-SD + GET /api/device/load) **
+// ******************************************************
+// The TXT record carries the static identity (id, fw, caps, depth) plus the
+// live load (free, state). Load updates are throttled because every TXT change
+// triggers an mDNS announcement; dispatchers that need an exact number ask
+// GET /api/device/load, which is computed on the spot.
+
+static WebServer *discoveryServer = nullptr;
+static DeviceLoadFn loadFn = nullptr;
+static int deviceDepth = 1;
+static bool advertising = false;
+static char deviceId[18];   // MAC, as sent in the completion payload's device_id
+static char hostname[16];   // web2wire-XXXXXX
+
+static int lastAdvertisedHeld = -1;
+static unsigned long lastTxtUpdate = 0;
+
+static int heldJobs()
+{
+    return loadFn ? loadFn() : 0;
+}
+
+static void setTxtNumber(const char *key, int value)
+{
+    char buf[8];
+    snprintf(buf, sizeof(buf), "%d", value);
+    MDNS.addServiceTxt(DISCOVERY_SERVICE, DISCOVERY_PROTO, key, buf); // Replaces the existing item
+}
+
+static void advertiseLoad(int held)
+{
+    setTxtNumber("free", max(deviceDepth - held, 0));
+    MDNS.addServiceTxt(DISCOVERY_SERVICE, DISCOVERY_PROTO, "state", held > 0 ? "busy" : "idle");
+    lastAdvertisedHeld = held;
+    lastTxtUpdate = millis();
+}
+
+static void handleDeviceLoad()
+{
+    int held = heldJobs();
+
+    JsonDocument doc;
+    doc["id"] = deviceId;
+    doc["hostname"] = hostname;
+    doc["fw"] = DEVICE_FIRMWARE_VERSION;
+    doc["caps"] = DEVICE_CAPABILITIES;
+    doc["depth"] = deviceDepth;
+    doc["in_flight"] = held;
+    doc["free_slots"] = max(deviceDepth - held, 0);
+    doc["state"] = held > 0 ? "busy" : "idle";
+    doc["uptime_ms"] = millis();
+    pacingToJson(doc["pacing"].to<JsonObject>());
+
+    String body;
+    serializeJson(doc, body);
+    discoveryServer->send(200, "application/json", body);
+}
+
+// --- PUBLIC API ---
+
+void setupDeviceDiscovery(WebServer &server, int pipelineDepth, DeviceLoadFn load)
+{
+    discoveryServer = &server;
+    loadFn = load;
+    deviceDepth = pipelineDepth;
+
+    uint8_t mac[6];
+    WiFi.macAddress(mac);
+    snprintf(deviceId, sizeof(deviceId), "%02X:%02X:%02X:%02X:%02X:%02X", mac[0], mac[1], mac[2], mac[3], mac[4], mac[5]);
+    snprintf(hostname, sizeof(hostname), "web2wire-%02x%02x%02x", mac[3], mac[4], mac[5]);
+
+    server.on("/api/device/load", HTTP_GET, handleDeviceLoad);
+
+    if (!MDNS.begin(hostname))
+    {
+         LOG_ERROR("mDNS responder failed to start; load is still served on /api/device/load.\n");
+         return;
+    }
+    MDNS.addService(DISCOVERY_SERVICE, DISCOVERY_PROTO, DISCOVERY_HTTP_PORT);
+    MDNS.addServiceTxt(DISCOVERY_SERVICE, DISCOVERY_PROTO, "id", deviceId);
+    MDNS.addServiceTxt(DISCOVERY_SERVICE, DISCOVERY_PROTO, "fw", DEVICE_FIRMWARE_VERSION);
+    MDNS.addServiceTxt(DISCOVERY_SERVICE, DISCOVERY_PROTO, "caps", DEVICE_CAPABILITIES);
+    setTxtNumber("depth", deviceDepth);
+    advertiseLoad(heldJobs());
+    advertising = true;
+    LOG_INFO("Advertising _%s._%s as %s.local\n", DISCOVERY_SERVICE, DISCOVERY_PROTO, hostname);
+}
+
+void deviceDiscoveryTick()
+{
+    if (!advertising)
+    {
+         return;
+    }
+    int held = heldJobs();
+    if (held != lastAdvertisedHeld && millis() - lastTxtUpdate >= DISCOVERY_TXT_MIN_INTERVAL_MS)
+    {
+         advertiseLoad(held);
+    }
+}
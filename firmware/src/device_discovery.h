@@ -0,0 +1,36 @@
+#ifndef DEVICE_DISCOVERY_H
+#define DEVICE_DISCOVERY_H
+
+#include <Arduino.h>
+#include <WebServer.h>
+
+// --- DISCOVERY CONFIGURATION ---
+// Boards announce themselves as _web2wire._tcp on the local link (hostname web2wire-XXXXXX,
+// the last three MAC bytes), so a dispatcher can find every board and its spare capacity.
+#define DISCOVERY_SERVICE "web2wire"
+#define DISCOVERY_PROTO "tcp"
+#define DISCOVERY_HTTP_PORT 80              // Must match the job server port
+#define DISCOVERY_TXT_MIN_INTERVAL_MS 250  // Load changes are re-announced at most this often
+#define DEVICE_FIRMWARE_VERSION "1.2"
+// Features a dispatcher can rely on: 202 queueing, per-job LED timelines, ISO flag table, SSE events, /metrics,
+// "phases"/"phase_ms" and degradation tiers (express, latest-wins) driven by the job's "backlog".
+#define DEVICE_CAPABILITIES "queue,timeline,flags-iso,events,metrics,pacing"
+
+// Returns how many jobs the device holds right now (running + queued).
+typedef int (*DeviceLoadFn)();
+
+/**
+ * @brief Starts the mDNS responder, advertises the job server with its TXT record
+ * (id, fw, caps, depth, free, state) and registers GET /api/device/load.
+ * @param server The job server (listening on DISCOVERY_HTTP_PORT).
+ * @param pipelineDepth Jobs the device accepts at once (running + queued).
+ * @param load Callback reporting the current number of held jobs.
+ */
+void setupDeviceDiscovery(WebServer &server, int pipelineDepth, DeviceLoadFn load);
+
+/**
+ * @brief Called from loop(): refreshes the TXT record's load fields when they changed.
+ */
+void deviceDiscoveryTick();
+
+#endif // DEVICE_DISCOVERY_H
@@ -0,0 +1,209 @@
+#include "device_events.h"
+#include "deferred_log.h"
+#include <lwip/sockets.h>
+
+// ******************************************************
+// ** SERVER-SENT EVENT STREAM (GET /api/device/events) **
+// ******************************************************
+// Events are published from the job pipeline into a small fixed ring and only
+// written to the sockets from pumpDeviceEvents(), a few at a time, so a slow
+// subscriber can never stall the blink sequence or the HTTP handlers. Writes never
+// block: a subscriber whose send buffer cannot take a whole event is dropped (it
+// reconnects on its own after 'retry'; the gap shows in the event ids).
+
+struct QueuedEvent
+{
+    uint32_t seq;
+    uint32_t timestamp; // millis() at publish time
+    DeviceEventType type;
+    int32_t value;
+    char detail[EVENT_DETAIL_LEN];
+};
+
+static AdmissionWebServer *eventServer = nullptr;
+static WiFiClient subscribers[MAX_EVENT_SUBSCRIBERS];
+static uint32_t subscriberNextSeq[MAX_EVENT_SUBSCRIBERS];
+
+static QueuedEvent eventQueue[EVENT_QUEUE_SIZE];
+static uint32_t eventHead = 0; // Sequence number of the next event to publish
+static uint32_t eventTail = 0; // Sequence number of the oldest event still held by the ring
+static unsigned long lastKeepalive = 0;
+
+static const char *EVENT_NAMES[] = {
+    "accepted",
+    "blink_phase",
+    "render_done",
+    "completion_sent",
+    "idle"
+};
+
+static const char SSE_HEADERS[] =
+    "HTTP/1.1 200 OK\r\n"
+    "Content-Type: text/event-stream\r\n"
+    "Cache-Control: no-cache\r\n"
+    "Connection: keep-alive\r\n"
+    "Access-Control-Allow-Origin: *\r\n"
+    "\r\n";
+
+// Copies src into dst, escaping the characters that would break the JSON data line.
+static void copyJsonEscaped(char *dst, size_t dstLen, const char *src)
+{
+    size_t o = 0;
+    for (; src && *src && o + 2 < dstLen; src++)
+    {
+         char c = *src;
+         if (c == '"' || c == '\\')
+         {
+             dst[o++] = '\\';
+             dst[o++] = c;
+         }
+         else if ((uint8_t)c >= 0x20)
+         {
+             dst[o++] = c;
+         }
+    }
+    dst[o] = '\0';
+}
+
+// All or nothing without blocking: WiFiClient::write() waits out the socket timeout when
+// the peer's window is full, and a partial event would corrupt the stream anyway.
+static bool writeNow(WiFiClient &client, const char *data, size_t len)
+{
+    return send(client.fd(), data, len, MSG_DONTWAIT) == (ssize_t)len;
+}
+
+static bool writeEvent(WiFiClient &client, const QueuedEvent &ev)
+{
+    char buf[EVENT_DETAIL_LEN + 128];
+    int len = snprintf(buf, sizeof(buf),
+                       "id: %lu\nevent: %s\ndata: {\"t_ms\":%lu,\"value\":%ld,\"job\":\"%s\"}\n\n",
+                       (unsigned long)ev.seq, EVENT_NAMES[ev.type], (unsigned long)ev.timestamp,
+                       (long)ev.value, ev.detail);
+    if (len <= 0)
+    {
+         return true;
+    }
+    if (len >= (int)sizeof(buf))
+    {
+         len = sizeof(buf) - 1;
+    }
+    return writeNow(client, buf, len);
+}
+
+static void handleDeviceEventsRequest()
+{
+    int slot = -1;
+    for (int i = 0; i < MAX_EVENT_SUBSCRIBERS; i++)
+    {
+         if (!subscribers[i] || !subscribers[i].connected())
+         {
+             slot = i;
+             break;
+         }
+    }
+
+    if (slot < 0)
+    {
+         eventServer->send(503, "application/json", "{\"status\": \"busy\", \"message\": \"Too many event subscribers.\"}");
+         return;
+    }
+
+    // Take the socket over; left with WebServer it would sit in HC_WAIT_CLOSE and hold up
+    // every other request (POST /api/job/start included) until the close timeout.
+    WiFiClient client = eventServer->detachClient();
+    client.setNoDelay(true);
+    client.write((const uint8_t *)SSE_HEADERS, sizeof(SSE_HEADERS) - 1);
+    client.print("retry: 2000\n\n");
+
+    subscribers[slot] = client;
+    subscriberNextSeq[slot] = eventHead; // New subscribers only see events from now on
+    LOG_INFO("Event subscriber %d connected.\n", slot);
+}
+
+// --- PUBLIC API ---
+
+void setupDeviceEvents(AdmissionWebServer &server)
+{
+    eventServer = &server;
+    server.on("/api/device/events", HTTP_GET, handleDeviceEventsRequest);
+}
+
+void publishDeviceEvent(DeviceEventType type, int32_t value, const char *detail)
+{
+    // Overwrite the oldest entry when the ring is full; consumers see the gap in the ids.
+    if (eventHead - eventTail >= EVENT_QUEUE_SIZE)
+    {
+         eventTail++;
+    }
+
+    QueuedEvent &ev = eventQueue[eventHead % EVENT_QUEUE_SIZE];
+    ev.seq = eventHead;
+    ev.timestamp = millis();
+    ev.type = type;
+    ev.value = value;
+    copyJsonEscaped(ev.detail, sizeof(ev.detail), detail);
+    eventHead++;
+}
+
+void pumpDeviceEvents()
+{
+    unsigned long now = millis();
+    bool keepalive = now - lastKeepalive >= EVENT_KEEPALIVE_MS;
+    if (keepalive)
+    {
+         lastKeepalive = now;
+    }
+
+    for (int i = 0; i < MAX_EVENT_SUBSCRIBERS; i++)
+    {
+         WiFiClient &client = subscribers[i];
+         if (!client)
+         {
+             continue;
+         }
+         if (!client.connected())
+         {
+             client.stop();
+             subscribers[i] = WiFiClient();
+             continue;
+         }
+
+         // Subscribers that fell behind the ring skip straight to the oldest event still queued.
+         uint32_t seq = subscriberNextSeq[i];
+         if (eventHead - seq > eventHead - eventTail)
+         {
+             seq = eventTail;
+         }
+
+         bool ok = true;
+         for (int sent = 0; ok && sent < EVENTS_PER_PUMP && seq != eventHead; sent++, seq++)
+         {
+             ok = writeEvent(client, eventQueue[seq % EVENT_QUEUE_SIZE]);
+         }
+         if (ok && keepalive)
+         {
+             ok = writeNow(client, ": ping\n\n", 8);
+         }
+         subscriberNextSeq[i] = seq;
+
+         if (!ok)
+         {
+             LOG_WARN("Event subscriber %d dropped (too slow or gone).\n", i);
+             client.stop();
+             subscribers[i] = WiFiClient();
+         }
+    }
+}
+
+int deviceEventSubscriberCount()
+{
+    int count = 0;
+    for (int i = 0; i < MAX_EVENT_SUBSCRIBERS; i++)
+    {
+         if (subscribers[i] && subscribers[i].connected())
+         {
+             count++;
+         }
+    }
+    return count;
+}
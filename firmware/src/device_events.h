@@ -0,0 +1,50 @@
+#ifndef DEVICE_EVENTS_H
+#define DEVICE_EVENTS_H
+
+#include <Arduino.h>
+#include <WebServer.h>
+#include "admission.h"
+
+// --- SERVER-SENT EVENT STREAM CONFIGURATION ---
+#define MAX_EVENT_SUBSCRIBERS 4   // Concurrent GET /api/device/events connections
+#define EVENT_QUEUE_SIZE 16       // Pending events waiting to be flushed by loop()
+#define EVENT_DETAIL_LEN 48       // Bytes reserved for the (escaped) job name per event
+#define EVENTS_PER_PUMP 4         // Max events flushed per subscriber per loop() iteration
+#define EVENT_KEEPALIVE_MS 15000  // Comment ping interval, also detects dead subscribers
+
+// Device state transitions pushed to subscribers.
+enum DeviceEventType
+{
+    EVENT_ACCEPTED = 0,   // A job was accepted by POST /api/job/start (value = 1 if queued behind the running one)
+    EVENT_BLINK_PHASE,    // The LED sequence moved to a new phase (value = phase index)
+    EVENT_RENDER_DONE,    // A new job is on screen (value = render time in ms)
+    EVENT_COMPLETION_SENT,// notifyServerOfCompletion returned (value = 1 on success, 0 on failure)
+    EVENT_IDLE            // The device is ready for the next job
+};
+
+/**
+ * @brief Binds the event stream to the job server. Call once, before server.begin().
+ * @param server The server that owns GET /api/device/events; subscriber sockets are detached from it.
+ */
+void setupDeviceEvents(AdmissionWebServer &server);
+
+/**
+ * @brief Queues an event for delivery. Never touches the network, so it is safe on hot paths.
+ * @param type The state transition being reported.
+ * @param value Event specific integer (phase index, duration, success flag).
+ * @param detail Optional job name; copied and JSON-escaped into the queue slot.
+ */
+void publishDeviceEvent(DeviceEventType type, int32_t value = 0, const char *detail = nullptr);
+
+/**
+ * @brief Flushes at most EVENTS_PER_PUMP queued events to every subscriber and drops dead ones.
+ * Called once per loop() iteration.
+ */
+void pumpDeviceEvents();
+
+/**
+ * @brief Number of currently connected event stream subscribers.
+ */
+int deviceEventSubscriberCount();
+
+#endif // DEVICE_EVENTS_H
@@ -0,0 +1,194 @@
+#include "flag_bench.h"
+#include "flag_drawing.h"
+#include "flag_programs.h"
+#include "deferred_log.h"
+
+// ******************************************************
+// ** FLAG RENDER BENCHMARK (GET /api/debug/flags/bench) **
+// ******************************************************
+// Renders into a GFXcanvas16 so the numbers measure the drawing code itself,
+// not the SPI transfer to the panel. The response is streamed row by row; a
+// 250-entry JsonDocument would not fit comfortably in internal RAM. The handler
+// only writes the headers and takes the socket over; pumpFlagBench() then times
+// FLAG_BENCH_FLAGS_PER_PUMP flags per loop() iteration, so jobs keep running.
+
+struct BenchRun
+{
+    WiFiClient client;
+    GFXcanvas16 *canvas;
+    int scale;
+    int iterations;
+    int next;                     // Index of the next program to time
+    uint32_t programBytes;
+    uint32_t handwrittenCount;
+    uint64_t handwrittenTotal;
+    uint64_t bytecodeSameTotal;   // Bytecode time for the codes that also have a hand-written function
+    uint64_t bytecodeTotal;
+};
+
+static const char BENCH_HEADERS[] =
+    "HTTP/1.1 200 OK\r\n"
+    "Content-Type: application/json\r\n"
+    "Cache-Control: no-cache\r\n"
+    "Connection: close\r\n"
+    "\r\n";
+
+static AdmissionWebServer *benchServer = nullptr;
+static BenchRun run;
+static bool running = false;
+
+// Streams one formatted fragment to the bench client; the body ends when the connection closes.
+static void sendFragment(const char *fmt, ...)
+{
+    char line[160];
+    va_list args;
+    va_start(args, fmt);
+    int len = vsnprintf(line, sizeof(line), fmt, args);
+    va_end(args);
+    if (len > 0)
+    {
+         run.client.write((const uint8_t *)line, min<int>(len, sizeof(line) - 1));
+    }
+}
+
+// Mean render time in microseconds over 'iterations' runs; program == nullptr times the hand-written function.
+static uint32_t timeRender(GFXcanvas16 &canvas, const char *code, const uint8_t *program, int scale, int iterations)
+{
+    uint32_t start = micros();
+    for (int i = 0; i < iterations; i++)
+    {
+         if (program)
+         {
+             drawFlagProgram(canvas, program, 0, 0, scale);
+         }
+         else
+         {
+             drawCustomFlag(canvas, code, 0, 0, scale);
+         }
+    }
+    return (micros() - start) / iterations;
+}
+
+// True if an earlier table entry already points at the same program (territory aliases).
+static bool isSharedProgram(int index)
+{
+    for (int i = 0; i < index; i++)
+    {
+         if (FLAG_PROGRAMS[i].ops == FLAG_PROGRAMS[index].ops)
+         {
+             return true;
+         }
+    }
+    return false;
+}
+
+static void finishRun()
+{
+    // Flash for the hand-written functions is not measurable from here; read it from the linker map.
+    sendFragment("],\"programs\":%d,\"program_bytes\":%lu,\"index_bytes\":%u,",
+                 NUM_FLAG_PROGRAMS, (unsigned long)run.programBytes, (unsigned)(NUM_FLAG_PROGRAMS * sizeof(FlagProgram)));
+    sendFragment("\"bytecode_mean_us\":%lu,\"handwritten_codes\":%lu,\"handwritten_mean_us\":%lu,\"bytecode_same_codes_mean_us\":%lu}",
+                 (unsigned long)(run.bytecodeTotal / NUM_FLAG_PROGRAMS), (unsigned long)run.handwrittenCount,
+                 (unsigned long)(run.handwrittenCount ? run.handwrittenTotal / run.handwrittenCount : 0),
+                 (unsigned long)(run.handwrittenCount ? run.bytecodeSameTotal / run.handwrittenCount : 0));
+
+    LOG_INFO("Flag bench: %d programs, %lu bytes, scale %d x %d iterations.\n",
+             NUM_FLAG_PROGRAMS, (unsigned long)run.programBytes, run.scale, run.iterations);
+}
+
+static void endRun()
+{
+    run.client.stop();
+    run.client = WiFiClient();
+    delete run.canvas;
+    run.canvas = nullptr;
+    running = false;
+}
+
+static void handleFlagBench()
+{
+    if (running)
+    {
+         benchServer->send(503, "application/json", "{\"status\": \"busy\", \"message\": \"A flag bench is already running.\"}");
+         return;
+    }
+
+    int iterations = benchServer->hasArg("iterations") ? benchServer->arg("iterations").toInt() : FLAG_BENCH_DEFAULT_ITERATIONS;
+    iterations = constrain(iterations, 1, FLAG_BENCH_MAX_ITERATIONS);
+    int scale = benchServer->hasArg("scale") ? benchServer->arg("scale").toInt() : 4;
+    scale = constrain(scale, 1, 8);
+
+    GFXcanvas16 *canvas = new GFXcanvas16(FLAG_W * scale, FLAG_H * scale);
+    if (!canvas->getBuffer())
+    {
+         delete canvas;
+         benchServer->send(503, "application/json", "{\"status\": \"error\", \"message\": \"No memory for the bench canvas.\"}");
+         return;
+    }
+
+    run = BenchRun();
+    run.client = benchServer->detachClient();
+    run.canvas = canvas;
+    run.scale = scale;
+    run.iterations = iterations;
+    running = true;
+
+    run.client.write((const uint8_t *)BENCH_HEADERS, sizeof(BENCH_HEADERS) - 1);
+    sendFragment("{\"scale\":%d,\"iterations\":%d,\"flags\":[", scale, iterations);
+}
+
+// --- PUBLIC API ---
+
+void setupFlagBench(AdmissionWebServer &server)
+{
+    benchServer = &server;
+    server.on("/api/debug/flags/bench", HTTP_GET, handleFlagBench);
+}
+
+void pumpFlagBench()
+{
+    if (!running)
+    {
+         return;
+    }
+    if (!run.client.connected())
+    {
+         LOG_INFO("Flag bench: client left after %d of %d programs.\n", run.next, NUM_FLAG_PROGRAMS);
+         endRun();
+         return;
+    }
+
+    GFXcanvas16 &canvas = *run.canvas;
+    for (int n = 0; n < FLAG_BENCH_FLAGS_PER_PUMP && run.next < NUM_FLAG_PROGRAMS; n++, run.next++)
+    {
+         int i = run.next;
+         const FlagProgram &entry = FLAG_PROGRAMS[i];
+         bool shared = isSharedProgram(i);
+         if (!shared)
+         {
+             run.programBytes += entry.size;
+         }
+
+         uint32_t bytecodeMicros = timeRender(canvas, entry.code, entry.ops, run.scale, run.iterations);
+         run.bytecodeTotal += bytecodeMicros;
+         sendFragment("%s{\"code\":\"%s\",\"bytes\":%u,\"shared\":%s,\"bytecode_us\":%lu",
+                      i ? "," : "", entry.code, (unsigned)entry.size, shared ? "true" : "false",
+                      (unsigned long)bytecodeMicros);
+
+         if (drawCustomFlag(canvas, entry.code, 0, 0, run.scale))
+         {
+             uint32_t handwrittenMicros = timeRender(canvas, entry.code, nullptr, run.scale, run.iterations);
+             run.handwrittenCount++;
+             run.handwrittenTotal += handwrittenMicros;
+             run.bytecodeSameTotal += bytecodeMicros;
+             sendFragment(",\"handwritten_us\":%lu", (unsigned long)handwrittenMicros);
+         }
+         sendFragment("}");
+    }
+
+    if (run.next >= NUM_FLAG_PROGRAMS)
+    {
+         finishRun();
+         endRun();
+    }
+}
@@ -0,0 +1,26 @@
+#ifndef FLAG_BENCH_H
+#define FLAG_BENCH_H
+
+#include <Arduino.h>
+#include <WebServer.h>
+#include "admission.h"
+
+// --- FLAG BENCHMARK CONFIGURATION ---
+#define FLAG_BENCH_DEFAULT_ITERATIONS 5
+#define FLAG_BENCH_MAX_ITERATIONS 20
+#define FLAG_BENCH_FLAGS_PER_PUMP 2   // Programs timed per loop() iteration
+
+/**
+ * @brief Registers GET /api/debug/flags/bench: bytecode size per flag and off-screen render time
+ * of every program, next to the hand-written function where one exists (?iterations=N, ?scale=N).
+ * The run is spread over loop() iterations by pumpFlagBench(); one run at a time, others get 503.
+ */
+void setupFlagBench(AdmissionWebServer &server);
+
+/**
+ * @brief Times the next FLAG_BENCH_FLAGS_PER_PUMP flags of a running bench and streams their
+ * results. Called once per loop() iteration; returns at once when no bench is running.
+ */
+void pumpFlagBench();
+
+#endif // FLAG_BENCH_H
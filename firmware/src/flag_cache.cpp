@@ -0,0 +1,127 @@
+#include "flag_cache.h"
+#include "deferred_log.h"
+#include "metrics.h"
+#include "flag_pack.h"
+#include "pixel_kernels.h"
+#include "mem_tiers.h"
+#include "span_canvas.h"
+#include <atomic>
+
+// ******************************************************
+// ** PRERENDERED FLAG CACHE (boot-time warm-up) **
+// ******************************************************
+// Flags are drawn once into frames of the PSRAM flag arena on core 0 while the radio associates.
+// The job screen then pushes a cached frame to the panel in a single window write
+// instead of replaying the geometry. Entries are published with a release store,
+// so the render loop can read the cache while the warm-up task is still filling it.
+
+struct FlagCacheEntry
+{
+    char code[3];
+    uint16_t *frame;
+    std::atomic<bool> ready;
+};
+
+static FlagCacheEntry *flagCache = nullptr;
+static std::atomic<bool> prerenderDone(false);
+
+static void prerenderTask(void *)
+{
+    unsigned long start = millis();
+    int rendered = 0;
+    for (int i = 0; i < NUM_CUSTOM_FLAG_CODES; i++)
+    {
+         FlagCacheEntry &entry = flagCache[i];
+         entry.frame = (uint16_t *)memArenaAlloc(ARENA_FLAGS, FLAG_CACHE_FRAME_BYTES);
+         if (entry.frame == nullptr)
+         {
+             LOG_WARN("Flag prerender stopped at %s: flag arena full\n", entry.code);
+             break;
+         }
+         // Pack art at the base 32x20 size is a straight 4x blit; everything else goes through drawFlag
+         const uint8_t *packData;
+         const FlagPackEntry *packEntry = flagPackLookup(entry.code, &packData);
+         if (packEntry && packEntry->kind == FLAG_PACK_BITMAP && packEntry->width == FLAG_W && packEntry->height == FLAG_H)
+         {
+             rgb565ScaleBlit(entry.frame, FLAG_CACHE_WIDTH, (const uint16_t *)packData, FLAG_W, FLAG_H, FLAG_CACHE_SCALE);
+         }
+         else
+         {
+             SpanCanvas16 canvas(FLAG_CACHE_WIDTH, FLAG_CACHE_HEIGHT, entry.frame);
+             canvas.fillScreen(0);
+             drawFlag(canvas, entry.code, 0, 0, FLAG_CACHE_SCALE);
+         }
+         entry.ready.store(true, std::memory_order_release);
+         rendered++;
+         vTaskDelay(1); // Stay out of the way of the WiFi stack on this core
+    }
+
+    unsigned long elapsed = millis() - start;
+    metricsSetGauge(GAUGE_BOOT_PRERENDER_MS, elapsed);
+    LOG_INFO("Boot stage prerender: %d flags in %lu ms\n", rendered, elapsed);
+    prerenderDone.store(true, std::memory_order_release);
+    vTaskDelete(nullptr);
+}
+
+// --- PUBLIC API ---
+
+void startFlagPrerender()
+{
+    if (flagCache != nullptr)
+    {
+         return;
+    }
+    // As many frames as PSRAM holds after the back buffer; flags past that are drawn live
+    size_t frames = min(memPsramAvailable() / FLAG_CACHE_FRAME_BYTES, (size_t)NUM_CUSTOM_FLAG_CODES);
+    if (frames == 0 || !memArenaReserve(ARENA_FLAGS, frames * FLAG_CACHE_FRAME_BYTES))
+    {
+         LOG_WARN("No PSRAM for the flag arena: flag prerender skipped, flags are drawn live.\n");
+         prerenderDone.store(true);
+         return;
+    }
+
+    flagCache = new FlagCacheEntry[NUM_CUSTOM_FLAG_CODES];
+    for (int i = 0; i < NUM_CUSTOM_FLAG_CODES; i++)
+    {
+         memcpy(flagCache[i].code, CUSTOM_FLAG_CODES[i], sizeof(flagCache[i].code));
+         flagCache[i].frame = nullptr;
+         flagCache[i].ready.store(false);
+    }
+    xTaskCreatePinnedToCore(prerenderTask, "flag_prerender", 4096, nullptr, 1, nullptr, 0);
+}
+
+uint16_t *flagCacheLookup(const char *flagCode)
+{
+    if (flagCache == nullptr || flagCode == nullptr || !flagCode[0] || !flagCode[1] || flagCode[2])
+    {
+         return nullptr;
+    }
+    char a = toupper((unsigned char)flagCode[0]);
+    char b = toupper((unsigned char)flagCode[1]);
+    for (int i = 0; i < NUM_CUSTOM_FLAG_CODES; i++)
+    {
+         FlagCacheEntry &entry = flagCache[i];
+         if (entry.code[0] == a && entry.code[1] == b)
+         {
+             return entry.ready.load(std::memory_order_acquire) ? entry.frame : nullptr;
+         }
+    }
+    return nullptr;
+}
+
+bool flagCacheReady()
+{
+    return prerenderDone.load(std::memory_order_acquire);
+}
+
+void flagCacheInvalidate()
+{
+    if (flagCache == nullptr)
+    {
+         return;
+    }
+    for (int i = 0; i < NUM_CUSTOM_FLAG_CODES; i++)
+    {
+         flagCache[i].ready.store(false, std::memory_order_release);
+    }
+}
@@ -0,0 +1,37 @@
+#ifndef FLAG_CACHE_H
+#define FLAG_CACHE_H
+
+#include <Arduino.h>
+#include "flag_drawing.h"
+
+// --- FLAG CACHE CONFIGURATION ---
+// Prerendered flags are stored at the scale the job screen uses (4x = 128x80, 20 KB each, in PSRAM).
+#define FLAG_CACHE_SCALE 4
+#define FLAG_CACHE_WIDTH (FLAG_W * FLAG_CACHE_SCALE)
+#define FLAG_CACHE_HEIGHT (FLAG_H * FLAG_CACHE_SCALE)
+#define FLAG_CACHE_FRAME_BYTES (FLAG_CACHE_WIDTH * FLAG_CACHE_HEIGHT * sizeof(uint16_t))
+
+/**
+ * @brief Reserves the PSRAM flag arena and starts a low-priority task on core 0 that prerenders
+ * every custom flag into it. Returns immediately; does nothing when no PSRAM is present.
+ */
+void startFlagPrerender();
+
+/**
+ * @brief Returns the prerendered FLAG_CACHE_WIDTH x FLAG_CACHE_HEIGHT RGB565 frame for a code, or nullptr
+ * if it is unknown or not rendered yet. Safe to call while the prerender task is running.
+ */
+uint16_t *flagCacheLookup(const char *flagCode);
+
+/**
+ * @brief True once the prerender task has finished (successfully or not).
+ */
+bool flagCacheReady();
+
+/**
+ * @brief Stops serving prerendered frames (after the flag art changed); flags are drawn live from then on.
+ * Only call once flagCacheReady() is true.
+ */
+void flagCacheInvalidate();
+
+#endif // FLAG_CACHE_H
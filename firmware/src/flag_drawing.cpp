@@ -1,4 +1,7 @@
 #include "flag_drawing.h"
+#include "flag_programs.h"
+#include "flag_pack.h"
+#include "trace.h"
 #include <SPI.h> // Required for pgm_read_word
 #include <FS.h>  // Included implicitly via Arduino.h, but good practice
 
@@ -14,8 +17,9 @@
 /**
  * @brief Draws the Brazil Flag (Better Version: Richer Green, Defined Rhombus, Clearer Sphere/Band).
  */
-void drawBRFlag(int x, int y, int scale)
+void drawBRFlag(Adafruit_GFX &gfx, int x, int y, int scale)
 {
+         TRACE_FUNCTION();
          int w = FLAG_W * scale; // 128
          int h = FLAG_H * scale; // 80
          int centerW = x + w / 2;
@@ -23,7 +27,7 @@ void drawBRFlag(int x, int y, int scale)
          int radius = scale * 6; // Blue circle radius (~24px)
 
          // 1. Rich Emerald Green Field
-         tft.fillRect(x, y, w, h, ST77XX_RICH_GREEN);
+         gfx.fillRect(x, y, w, h, ST77XX_RICH_GREEN);
 
          // 2. Deep Gold Yellow Rhombus (Approximation)
          // The rhombus corners are roughly 17% in from the edges.
@@ -31,27 +35,28 @@ void drawBRFlag(int x, int y, int scale)
          int rH = h * 0.45; // Half-height of rhombus (~36px)
 
          // Define vertices for the rhombus (Top, Right, Bottom, Left)
-         tft.fillTriangle(centerW, centerY - rH, centerW + rW, centerY, centerW, centerY + rH, ST77XX_DEEP_YELLOW);
-         tft.fillTriangle(centerW, centerY - rH, centerW - rW, centerY, centerW, centerY + rH, ST77XX_DEEP_YELLOW);
+         gfx.fillTriangle(centerW, centerY - rH, centerW + rW, centerY, centerW, centerY + rH, ST77XX_DEEP_YELLOW);
+         gfx.fillTriangle(centerW, centerY - rH, centerW - rW, centerY, centerW, centerY + rH, ST77XX_DEEP_YELLOW);
          
          // 3. Navy Blue Sphere (Order and Progress)
-         tft.fillCircle(centerW, centerY, radius, ST77XX_BLUE); // Using standard Blue for contrast
+         gfx.fillCircle(centerW, centerY, radius, ST77XX_BLUE); // Using standard Blue for contrast
 
          // 4. White Motto Band (Simplified as a curved arc/sector)
          int bandThickness = scale * 2;
          // Simple white arc line approximation
-         tft.drawFastHLine(centerW - radius, centerY + bandThickness / 2, 2 * radius, ST77XX_WHITE);
-         tft.drawFastHLine(centerW - radius, centerY + bandThickness / 2 + 1, 2 * radius, ST77XX_WHITE);
+         gfx.drawFastHLine(centerW - radius, centerY + bandThickness / 2, 2 * radius, ST77XX_WHITE);
+         gfx.drawFastHLine(centerW - radius, centerY + bandThickness / 2 + 1, 2 * radius, ST77XX_WHITE);
          
          // Draw a small white star placeholder for the Southern Cross 
-         tft.fillCircle(centerW - scale * 3, centerY - scale * 3, 1, ST77XX_WHITE);
+         gfx.fillCircle(centerW - scale * 3, centerY - scale * 3, 1, ST77XX_WHITE);
 }
 
 // ******************************************************
 // ** ARGENTINA FLAG (AR) **
 // ******************************************************
-void drawARFlag(int x, int y, int scale)
+void drawARFlag(Adafruit_GFX &gfx, int x, int y, int scale)
 {
+         TRACE_FUNCTION();
          int w = FLAG_W * scale;
          int h = FLAG_H * scale;
          int stripeH = h / 3;
@@ -59,98 +64,104 @@ void drawARFlag(int x, int y, int scale)
          int centerX = x + w / 2;
          int centerY = y + h / 2;
 
-         tft.fillRect(x, y, w, stripeH, ST77XX_ARG_BLUE);    // Top: Blue
-         tft.fillRect(x, y + stripeH, w, stripeH, ST77XX_WHITE);    // Middle: White
-         tft.fillRect(x, y + 2 * stripeH, w, h - 2 * stripeH, ST77XX_ARG_BLUE);    // Bottom: Blue
+         gfx.fillRect(x, y, w, stripeH, ST77XX_ARG_BLUE);    // Top: Blue
+         gfx.fillRect(x, y + stripeH, w, stripeH, ST77XX_WHITE);    // Middle: White
+         gfx.fillRect(x, y + 2 * stripeH, w, h - 2 * stripeH, ST77XX_ARG_BLUE);    // Bottom: Blue
 
-         tft.fillCircle(centerX, centerY, sunRadius, ST77XX_GOLD); // Sun of May
+         gfx.fillCircle(centerX, centerY, sunRadius, ST77XX_GOLD); // Sun of May
 }
 
 // ******************************************************
 // ** AUSTRIA FLAG (AT) **
 // ******************************************************
-void drawATFlag(int x, int y, int scale)
+void drawATFlag(Adafruit_GFX &gfx, int x, int y, int scale)
 {
+         TRACE_FUNCTION();
          int w = FLAG_W * scale;
          int h = FLAG_H * scale;
          int stripeH = h / 3;
 
-         tft.fillRect(x, y, w, stripeH, ST77XX_RED);
-         tft.fillRect(x, y + stripeH, w, stripeH, ST77XX_WHITE);
-         tft.fillRect(x, y + 2 * stripeH, w, h - 2 * stripeH, ST77XX_RED);
+         gfx.fillRect(x, y, w, stripeH, ST77XX_RED);
+         gfx.fillRect(x, y + stripeH, w, stripeH, ST77XX_WHITE);
+         gfx.fillRect(x, y + 2 * stripeH, w, h - 2 * stripeH, ST77XX_RED);
 }
 
 // ******************************************************
 // ** CHILE FLAG (CL) **
 // ******************************************************
-void drawCLFlag(int x, int y, int scale)
+void drawCLFlag(Adafruit_GFX &gfx, int x, int y, int scale)
 {
+         TRACE_FUNCTION();
          int w = FLAG_W * scale;
          int h = FLAG_H * scale;
          int stripeH = h / 2;
          int cantonSize = stripeH; // Square canton 40x40
 
-         tft.fillRect(x, y, w, stripeH, ST77XX_WHITE);    // Top: White
-         tft.fillRect(x, y + stripeH, w, h - stripeH, ST77XX_RED); // Bottom: Red
+         gfx.fillRect(x, y, w, stripeH, ST77XX_WHITE);    // Top: White
+         gfx.fillRect(x, y + stripeH, w, h - stripeH, ST77XX_RED); // Bottom: Red
 
-         tft.fillRect(x, y, cantonSize, cantonSize, ST77XX_BLUE); // Blue Canton
+         gfx.fillRect(x, y, cantonSize, cantonSize, ST77XX_BLUE); // Blue Canton
 
-         tft.fillCircle(x + cantonSize / 2, y + cantonSize / 2, scale, ST77XX_WHITE); // White Star
+         gfx.fillCircle(x + cantonSize / 2, y + cantonSize / 2, scale, ST77XX_WHITE); // White Star
 }
 
 // ******************************************************
 // ** CHINA FLAG (CN) **
 // ******************************************************
-void drawCNFlag(int x, int y, int scale)
+void drawCNFlag(Adafruit_GFX &gfx, int x, int y, int scale)
 {
+         TRACE_FUNCTION();
          int w = FLAG_W * scale;
          int h = FLAG_H * scale;
          int starSize = scale * 3;
          int starX = x + w / 4;
          int starY = y + h / 4;
 
-         tft.fillRect(x, y, w, h, ST77XX_CHINA_RED); // Red Field
-         tft.fillCircle(starX, starY, starSize, ST77XX_YELLOW); // Simplified Large Star
+         gfx.fillRect(x, y, w, h, ST77XX_CHINA_RED); // Red Field
+         gfx.fillCircle(starX, starY, starSize, ST77XX_YELLOW); // Simplified Large Star
 }
 
 // ******************************************************
 // ** COLOMBIA FLAG (CO) **
 // ******************************************************
-void drawCOFlag(int x, int y, int scale)
+void drawCOFlag(Adafruit_GFX &gfx, int x, int y, int scale)
 {
+         TRACE_FUNCTION();
          int w = FLAG_W * scale;
          int h = FLAG_H * scale;
          int stripeH1 = h / 2;
          int stripeH23 = h / 4;
 
-         tft.fillRect(x, y, w, stripeH1, ST77XX_YELLOW); // Top: Yellow (1/2)
-         tft.fillRect(x, y + stripeH1, w, stripeH23, ST77XX_BLUE); // Middle: Blue (1/4)
-         tft.fillRect(x, y + stripeH1 + stripeH23, w, h - (stripeH1 + stripeH23), ST77XX_RED); // Bottom: Red (1/4)
+         gfx.fillRect(x, y, w, stripeH1, ST77XX_YELLOW); // Top: Yellow (1/2)
+         gfx.fillRect(x, y + stripeH1, w, stripeH23, ST77XX_BLUE); // Middle: Blue (1/4)
+         gfx.fillRect(x, y + stripeH1 + stripeH23, w, h - (stripeH1 + stripeH23), ST77XX_RED); // Bottom: Red (1/4)
 }
 
 // ******************************************************
 // ** DENMARK FLAG (DK) **
 // ******************************************************
-void drawDKFlag(int x, int y, int scale)
+void drawDKFlag(Adafruit_GFX &gfx, int x, int y, int scale)
 {
+         TRACE_FUNCTION();
          int w = FLAG_W * scale;
          int h = FLAG_H * scale;
          int crossW = scale * 2; // Thickness of the white cross (~8px)
          int crossOffset = w / 3; // Cross centered at 1/3rd the width
 
-         tft.fillRect(x, y, w, h, ST77XX_RED); // Red Field
+         gfx.fillRect(x, y, w, h, ST77XX_RED); // Red Field
 
          // White Nordic Cross (Vertical)
-         tft.fillRect(x + crossOffset - crossW / 2, y, crossW, h, ST77XX_WHITE);
+         gfx.fillRect(x + crossOffset - crossW / 2, y, crossW, h, ST77XX_WHITE);
          // White Nordic Cross (Horizontal)
-         tft.fillRect(x, y + h / 2 - crossW / 2, w, crossW, ST77XX_WHITE);
+         gfx.fillRect(x, y + h / 2 - crossW / 2, w, crossW, ST77XX_WHITE);
 }
 
 // ******************************************************
 // ** EGYPT FLAG (EG) **
 // ******************************************************
-void drawEGFlag(int x, int y, int scale)
+void drawEGFlag(Adafruit_GFX &gfx, int x, int y, int scale)
 {
+         TRACE_FUNCTION();
          int w = FLAG_W * scale;
          int h = FLAG_H * scale;
          int stripeH = h / 3;
@@ -158,37 +169,39 @@ void drawEGFlag(int x, int y, int scale)
          int centerX = x + w / 2;
          int centerY = y + h / 2;
 
-         tft.fillRect(x, y, w, stripeH, ST77XX_RED);
-         tft.fillRect(x, y + stripeH, w, stripeH, ST77XX_WHITE);
-         tft.fillRect(x, y + 2 * stripeH, w, h - 2 * stripeH, ST77XX_BLACK);
+         gfx.fillRect(x, y, w, stripeH, ST77XX_RED);
+         gfx.fillRect(x, y + stripeH, w, stripeH, ST77XX_WHITE);
+         gfx.fillRect(x, y + 2 * stripeH, w, h - 2 * stripeH, ST77XX_BLACK);
 
          // Simplified Eagle (Gold circle)
-         tft.fillCircle(centerX, centerY, centerRadius, ST77XX_EGYPT_GOLD);
+         gfx.fillCircle(centerX, centerY, centerRadius, ST77XX_EGYPT_GOLD);
 }
 
 // ******************************************************
 // ** FINLAND FLAG (FI) **
 // ******************************************************
-void drawFIFlag(int x, int y, int scale)
+void drawFIFlag(Adafruit_GFX &gfx, int x, int y, int scale)
 {
+         TRACE_FUNCTION();
          int w = FLAG_W * scale;
          int h = FLAG_H * scale;
          int crossW = scale * 2; // Thickness of the blue cross (~8px)
          int crossOffset = w / 3; // Cross centered at 1/3rd the width
 
-         tft.fillRect(x, y, w, h, ST77XX_WHITE); // White Field
+         gfx.fillRect(x, y, w, h, ST77XX_WHITE); // White Field
 
          // Blue Nordic Cross (Vertical)
-         tft.fillRect(x + crossOffset - crossW / 2, y, crossW, h, ST77XX_BLUE);
+         gfx.fillRect(x + crossOffset - crossW / 2, y, crossW, h, ST77XX_BLUE);
          // Blue Nordic Cross (Horizontal)
-         tft.fillRect(x, y + h / 2 - crossW / 2, w, crossW, ST77XX_BLUE);
+         gfx.fillRect(x, y + h / 2 - crossW / 2, w, crossW, ST77XX_BLUE);
 }
 
 // ******************************************************
 // ** GREECE FLAG (GR) **
 // ******************************************************
-void drawGRFlag(int x, int y, int scale)
+void drawGRFlag(Adafruit_GFX &gfx, int x, int y, int scale)
 {
+         TRACE_FUNCTION();
          int w = FLAG_W * scale;
          int h = FLAG_H * scale;
          int stripeH = h / 9; // 9 stripes total
@@ -198,50 +211,53 @@ void drawGRFlag(int x, int y, int scale)
          for (int i = 0; i < 9; i++)
          {
                   uint16_t color = (i % 2 == 0) ? ST77XX_BLUE : ST77XX_WHITE;
-                  tft.fillRect(x, y + i * stripeH, w, stripeH, color);
+                  gfx.fillRect(x, y + i * stripeH, w, stripeH, color);
          }
 
          // 2. Blue Canton (top left)
-         tft.fillRect(x, y, cantonSize, cantonSize, ST77XX_BLUE);
+         gfx.fillRect(x, y, cantonSize, cantonSize, ST77XX_BLUE);
 
          // 3. White Cross in Canton
          int crossW = stripeH;
-         tft.fillRect(x + cantonSize / 2 - crossW / 2, y, crossW, cantonSize, ST77XX_WHITE);
-         tft.fillRect(x, y + cantonSize / 2 - crossW / 2, cantonSize, crossW, ST77XX_WHITE);
+         gfx.fillRect(x + cantonSize / 2 - crossW / 2, y, crossW, cantonSize, ST77XX_WHITE);
+         gfx.fillRect(x, y + cantonSize / 2 - crossW / 2, cantonSize, crossW, ST77XX_WHITE);
 }
 
 // ******************************************************
 // ** INDONESIA FLAG (ID) **
 // ******************************************************
-void drawIDFlag(int x, int y, int scale)
+void drawIDFlag(Adafruit_GFX &gfx, int x, int y, int scale)
 {
+         TRACE_FUNCTION();
          int w = FLAG_W * scale;
          int h = FLAG_H * scale;
          int stripeH = h / 2;
 
-         tft.fillRect(x, y, w, stripeH, ST77XX_RED);
-         tft.fillRect(x, y + stripeH, w, h - stripeH, ST77XX_WHITE);
+         gfx.fillRect(x, y, w, stripeH, ST77XX_RED);
+         gfx.fillRect(x, y + stripeH, w, h - stripeH, ST77XX_WHITE);
 }
 
 // ******************************************************
 // ** ITALY FLAG (IT) **
 // ******************************************************
-void drawITFlag(int x, int y, int scale)
+void drawITFlag(Adafruit_GFX &gfx, int x, int y, int scale)
 {
+         TRACE_FUNCTION();
          int w = FLAG_W * scale;
          int h = FLAG_H * scale;
          int stripeW = w / 3;
 
-         tft.fillRect(x, y, stripeW, h, ST77XX_GREEN);
-         tft.fillRect(x + stripeW, y, stripeW, h, ST77XX_WHITE);
-         tft.fillRect(x + 2 * stripeW, y, w - 2 * stripeW, h, ST77XX_RED);
+         gfx.fillRect(x, y, stripeW, h, ST77XX_GREEN);
+         gfx.fillRect(x + stripeW, y, stripeW, h, ST77XX_WHITE);
+         gfx.fillRect(x + 2 * stripeW, y, w - 2 * stripeW, h, ST77XX_RED);
 }
 
 // ******************************************************
 // ** KENYA FLAG (KE) **
 // ******************************************************
-void drawKEFlag(int x, int y, int scale)
+void drawKEFlag(Adafruit_GFX &gfx, int x, int y, int scale)
 {
+         TRACE_FUNCTION();
          int w = FLAG_W * scale;
          int h = FLAG_H * scale;
          int stripeH = h / 6;
@@ -250,108 +266,113 @@ void drawKEFlag(int x, int y, int scale)
          int shieldRadius = scale * 5;
 
          // Stripes: Black, White, Red, White, Green
-         tft.fillRect(x, y, w, stripeH * 2, ST77XX_KE_BLACK); // Black
-         tft.fillRect(x, y + stripeH * 2, w, stripeH, ST77XX_WHITE);    // White
-         tft.fillRect(x, y + stripeH * 3, w, stripeH, ST77XX_KE_RED);    // Red
-         tft.fillRect(x, y + stripeH * 4, w, stripeH, ST77XX_WHITE);    // White
-         tft.fillRect(x, y + stripeH * 5, w, h - stripeH * 5, ST77XX_KE_GREEN); // Green
+         gfx.fillRect(x, y, w, stripeH * 2, ST77XX_KE_BLACK); // Black
+         gfx.fillRect(x, y + stripeH * 2, w, stripeH, ST77XX_WHITE);    // White
+         gfx.fillRect(x, y + stripeH * 3, w, stripeH, ST77XX_KE_RED);    // Red
+         gfx.fillRect(x, y + stripeH * 4, w, stripeH, ST77XX_WHITE);    // White
+         gfx.fillRect(x, y + stripeH * 5, w, h - stripeH * 5, ST77XX_KE_GREEN); // Green
 
          // Simplified Shield (Black circle, symbolizing the Masaii shield)
-         tft.fillCircle(centerX, centerY, shieldRadius, ST77XX_BLACK);
+         gfx.fillCircle(centerX, centerY, shieldRadius, ST77XX_BLACK);
 }
 
 // ******************************************************
 // ** MEXICO FLAG (MX) **
 // ******************************************************
-void drawMXFlag(int x, int y, int scale)
+void drawMXFlag(Adafruit_GFX &gfx, int x, int y, int scale)
 {
+         TRACE_FUNCTION();
          int w = FLAG_W * scale;
          int h = FLAG_H * scale;
          int stripeW = w / 3;
          int sealRadius = scale * 3;
          int centerX = x + stripeW + stripeW / 2;
 
-         tft.fillRect(x, y, stripeW, h, ST77XX_GREEN);    // Green
-         tft.fillRect(x + stripeW, y, stripeW, h, ST77XX_WHITE);    // White
-         tft.fillRect(x + 2 * stripeW, y, w - 2 * stripeW, h, ST77XX_RED); // Red
+         gfx.fillRect(x, y, stripeW, h, ST77XX_GREEN);    // Green
+         gfx.fillRect(x + stripeW, y, stripeW, h, ST77XX_WHITE);    // White
+         gfx.fillRect(x + 2 * stripeW, y, w - 2 * stripeW, h, ST77XX_RED); // Red
 
          // Simplified Seal (Green circle in the center)
-         tft.fillCircle(centerX, y + h / 2, sealRadius, ST77XX_GREEN);
+         gfx.fillCircle(centerX, y + h / 2, sealRadius, ST77XX_GREEN);
 }
 
 // ******************************************************
 // ** NEW ZEALAND FLAG (NZ) **
 // ******************************************************
-void drawNZFlag(int x, int y, int scale)
+void drawNZFlag(Adafruit_GFX &gfx, int x, int y, int scale)
 {
+         TRACE_FUNCTION();
          int w = FLAG_W * scale;
          int h = FLAG_H * scale;
          int cantonW = w / 2;
          int cantonH = h / 2;
          int starSize = scale * 2;
 
-         tft.fillRect(x, y, w, h, ST77XX_BLUE); // Background Blue
+         gfx.fillRect(x, y, w, h, ST77XX_BLUE); // Background Blue
 
-         drawGBFlag(x, y, scale); // Simplified Union Jack in Canton (uses overdraw)
+         drawGBFlag(gfx, x, y, scale); // Simplified Union Jack in Canton (uses overdraw)
 
          // Southern Cross (4 red stars with white fimbriation)
          int scX = x + cantonW + (w - cantonW) / 4;
          int scY = y + cantonH + (h - cantonH) / 4;
 
          // Draw 4 white borders (fimbriation)
-         tft.fillCircle(scX, scY, starSize + 1, ST77XX_WHITE);
-         tft.fillCircle(scX + scale * 4, scY, starSize + 1, ST77XX_WHITE);
-         tft.fillCircle(scX, scY + scale * 4, starSize + 1, ST77XX_WHITE);
-         tft.fillCircle(scX + scale * 4, scY + scale * 4, starSize + 1, ST77XX_WHITE);
+         gfx.fillCircle(scX, scY, starSize + 1, ST77XX_WHITE);
+         gfx.fillCircle(scX + scale * 4, scY, starSize + 1, ST77XX_WHITE);
+         gfx.fillCircle(scX, scY + scale * 4, starSize + 1, ST77XX_WHITE);
+         gfx.fillCircle(scX + scale * 4, scY + scale * 4, starSize + 1, ST77XX_WHITE);
 
          // Draw 4 red stars (circles)
-         tft.fillCircle(scX, scY, starSize, ST77XX_RED);
-         tft.fillCircle(scX + scale * 4, scY, starSize, ST77XX_RED);
-         tft.fillCircle(scX, scY + scale * 4, starSize, ST77XX_RED);
-         tft.fillCircle(scX + scale * 4, scY + scale * 4, starSize, ST77XX_RED);
+         gfx.fillCircle(scX, scY, starSize, ST77XX_RED);
+         gfx.fillCircle(scX + scale * 4, scY, starSize, ST77XX_RED);
+         gfx.fillCircle(scX, scY + scale * 4, starSize, ST77XX_RED);
+         gfx.fillCircle(scX + scale * 4, scY + scale * 4, starSize, ST77XX_RED);
 }
 
 // ******************************************************
 // ** NORWAY FLAG (NO) **
 // ******************************************************
-void drawNOFlag(int x, int y, int scale)
+void drawNOFlag(Adafruit_GFX &gfx, int x, int y, int scale)
 {
+         TRACE_FUNCTION();
          int w = FLAG_W * scale;
          int h = FLAG_H * scale;
          int crossW = scale * 4; // Thickness of the total cross (~16px)
          int crossOffset = w / 3; 
 
-         tft.fillRect(x, y, w, h, ST77XX_RED); // Red Field
+         gfx.fillRect(x, y, w, h, ST77XX_RED); // Red Field
 
          // White Nordic Cross (Vertical) - Outer layer
-         tft.fillRect(x + crossOffset - crossW / 2, y, crossW, h, ST77XX_WHITE);
+         gfx.fillRect(x + crossOffset - crossW / 2, y, crossW, h, ST77XX_WHITE);
          // White Nordic Cross (Horizontal) - Outer layer
-         tft.fillRect(x, y + h / 2 - crossW / 2, w, crossW, ST77XX_WHITE);
+         gfx.fillRect(x, y + h / 2 - crossW / 2, w, crossW, ST77XX_WHITE);
 
          // Inner Blue Cross (Vertical)
-         tft.fillRect(x + crossOffset - scale / 2, y, scale, h, ST77XX_BLUE);
+         gfx.fillRect(x + crossOffset - scale / 2, y, scale, h, ST77XX_BLUE);
          // Inner Blue Cross (Horizontal)
-         tft.fillRect(x, y + h / 2 - scale / 2, w, scale, ST77XX_BLUE);
+         gfx.fillRect(x, y + h / 2 - scale / 2, w, scale, ST77XX_BLUE);
 }
 
 // ******************************************************
 // ** POLAND FLAG (PL) **
 // ******************************************************
-void drawPLFlag(int x, int y, int scale)
+void drawPLFlag(Adafruit_GFX &gfx, int x, int y, int scale)
 {
+         TRACE_FUNCTION();
          int w = FLAG_W * scale;
          int h = FLAG_H * scale;
          int stripeH = h / 2;
 
-         tft.fillRect(x, y, w, stripeH, ST77XX_WHITE); // Top: White
-         tft.fillRect(x, y + stripeH, w, h - stripeH, ST77XX_RED); // Bottom: Red
+         gfx.fillRect(x, y, w, stripeH, ST77XX_WHITE); // Top: White
+         gfx.fillRect(x, y + stripeH, w, h - stripeH, ST77XX_RED); // Bottom: Red
 }
 
 // ******************************************************
 // ** PORTUGAL FLAG (PT) **
 // ******************************************************
-void drawPTFlag(int x, int y, int scale)
+void drawPTFlag(Adafruit_GFX &gfx, int x, int y, int scale)
 {
+         TRACE_FUNCTION();
          int w = FLAG_W * scale;
          int h = FLAG_H * scale;
          int greenW = w * 2 / 5;
@@ -360,66 +381,69 @@ void drawPTFlag(int x, int y, int scale)
          int centerY = y + h / 2;
          int shieldRadius = scale * 4;
 
-         tft.fillRect(x, y, greenW, h, ST77XX_PORT_GREEN); // Left: Green
-         tft.fillRect(x + greenW, y, redW, h, ST77XX_PORT_RED); // Right: Red
+         gfx.fillRect(x, y, greenW, h, ST77XX_PORT_GREEN); // Left: Green
+         gfx.fillRect(x + greenW, y, redW, h, ST77XX_PORT_RED); // Right: Red
 
          // Simplified Coat of Arms (Gold circle)
-         tft.fillCircle(centerX, centerY, shieldRadius, ST77XX_GOLD);
+         gfx.fillCircle(centerX, centerY, shieldRadius, ST77XX_GOLD);
 }
 
 // ******************************************************
 // ** SOUTH AFRICA FLAG (ZA) **
 // ******************************************************
-void drawZAFlag(int x, int y, int scale)
+void drawZAFlag(Adafruit_GFX &gfx, int x, int y, int scale)
 {
+         TRACE_FUNCTION();
          int w = FLAG_W * scale;
          int h = FLAG_H * scale;
          int centerY = y + h / 2;
          int stripeH = h / 6;
 
          // 1. Black (Simplified Y-shape)
-         tft.fillTriangle(x, centerY - stripeH, x, centerY + stripeH, x + w / 2, centerY, ST77XX_BLACK);
+         gfx.fillTriangle(x, centerY - stripeH, x, centerY + stripeH, x + w / 2, centerY, ST77XX_BLACK);
          
          // 2. White fimbriation (Around black)
-         tft.fillTriangle(x, centerY - stripeH - 1, x, centerY + stripeH + 1, x + w / 2 + 1, centerY, ST77XX_WHITE);
-         tft.fillTriangle(x, centerY - stripeH, x, centerY + stripeH, x + w / 2, centerY, ST77XX_BLACK); // redraw black
+         gfx.fillTriangle(x, centerY - stripeH - 1, x, centerY + stripeH + 1, x + w / 2 + 1, centerY, ST77XX_WHITE);
+         gfx.fillTriangle(x, centerY - stripeH, x, centerY + stripeH, x + w / 2, centerY, ST77XX_BLACK); // redraw black
 
          // 3. Yellow/Gold fimbriation
-         tft.fillTriangle(x + w / 2, centerY, x + w, y, x + w, h, ST77XX_DEEP_YELLOW);
+         gfx.fillTriangle(x + w / 2, centerY, x + w, y, x + w, h, ST77XX_DEEP_YELLOW);
 
          // 4. Red (Top)
-         tft.fillRect(x + w / 2, y, w - w / 2, centerY - stripeH - 1, ST77XX_RED);
+         gfx.fillRect(x + w / 2, y, w - w / 2, centerY - stripeH - 1, ST77XX_RED);
          // 5. Blue (Bottom)
-         tft.fillRect(x + w / 2, centerY + stripeH + 1, w - w / 2, h - (centerY + stripeH + 1), ST77XX_SA_BLUE);
+         gfx.fillRect(x + w / 2, centerY + stripeH + 1, w - w / 2, h - (centerY + stripeH + 1), ST77XX_SA_BLUE);
 
          // 6. Green fills the black Y
-         tft.fillTriangle(x, centerY - stripeH, x, centerY + stripeH, x + w / 2, centerY, ST77XX_KE_GREEN);
+         gfx.fillTriangle(x, centerY - stripeH, x, centerY + stripeH, x + w / 2, centerY, ST77XX_KE_GREEN);
 }
 
 // ******************************************************
 // ** SOUTH KOREA FLAG (KR) **
 // ******************************************************
-void drawKRFlag(int x, int y, int scale)
+void drawKRFlag(Adafruit_GFX &gfx, int x, int y, int scale)
 {
+         TRACE_FUNCTION();
          int w = FLAG_W * scale;
          int h = FLAG_H * scale;
          int centerX = x + w / 2;
          int centerY = y + h / 2;
          int radius = scale * 5;
 
-         tft.fillRect(x, y, w, h, ST77XX_WHITE); // White Field
+         gfx.fillRect(x, y, w, h, ST77XX_WHITE); // White Field
 
          // Simplified Taegeuk (Red/Blue Circle)
-         tft.fillCircle(centerX, centerY, radius, ST77XX_RED);
-         tft.fillCircle(centerX, centerY - radius / 2, radius / 2, ST77XX_BLUE);
-         tft.fillCircle(centerX, centerY + radius / 2, radius / 2, ST77XX_RED);
+         gfx.fillCircle(centerX, centerY, radius, ST77XX_RED);
+         gfx.fillCircle(centerX, centerY - radius / 2, radius / 2, ST77XX_BLUE);
+         gfx.fillCircle(centerX, centerY + radius / 2, radius / 2, ST77XX_RED);
 }
 
 // ******************************************************
 // ** SPAIN FLAG (ES) **
 // ******************************************************
-void drawESFlag(int x, int y, int scale)
+void drawESFlag(Adafruit_GFX &gfx, int x, int y, int scale)
 {
+         TRACE_FUNCTION();
          int w = FLAG_W * scale;
          int h = FLAG_H * scale;
          int redH = h / 4;
@@ -428,55 +452,58 @@ void drawESFlag(int x, int y, int scale)
          int centerY = y + h / 2;
          int shieldRadius = scale * 3;
 
-         tft.fillRect(x, y, w, redH, ST77XX_RED);    // Top: Red
-         tft.fillRect(x, y + redH, w, yellowH, ST77XX_YELLOW); // Middle: Yellow
-         tft.fillRect(x, y + redH + yellowH, w, h - (redH + yellowH), ST77XX_RED); // Bottom: Red
+         gfx.fillRect(x, y, w, redH, ST77XX_RED);    // Top: Red
+         gfx.fillRect(x, y + redH, w, yellowH, ST77XX_YELLOW); // Middle: Yellow
+         gfx.fillRect(x, y + redH + yellowH, w, h - (redH + yellowH), ST77XX_RED); // Bottom: Red
 
          // Simplified Coat of Arms (Blue circle)
-         tft.fillCircle(centerX, centerY, shieldRadius, ST77XX_BLUE);
+         gfx.fillCircle(centerX, centerY, shieldRadius, ST77XX_BLUE);
 }
 
 // ******************************************************
 // ** SWEDEN FLAG (SE) **
 // ******************************************************
-void drawSEFlag(int x, int y, int scale)
+void drawSEFlag(Adafruit_GFX &gfx, int x, int y, int scale)
 {
+         TRACE_FUNCTION();
          int w = FLAG_W * scale;
          int h = FLAG_H * scale;
          int crossW = scale * 2; // Thickness of the yellow cross (~8px)
          int crossOffset = w / 3; // Cross centered at 1/3rd the width
 
-         tft.fillRect(x, y, w, h, ST77XX_BLUE); // Blue Field
+         gfx.fillRect(x, y, w, h, ST77XX_BLUE); // Blue Field
 
          // Yellow Nordic Cross (Vertical)
-         tft.fillRect(x + crossOffset - crossW / 2, y, crossW, h, ST77XX_YELLOW);
+         gfx.fillRect(x + crossOffset - crossW / 2, y, crossW, h, ST77XX_YELLOW);
          // Yellow Nordic Cross (Horizontal)
-         tft.fillRect(x, y + h / 2 - crossW / 2, w, crossW, ST77XX_YELLOW);
+         gfx.fillRect(x, y + h / 2 - crossW / 2, w, crossW, ST77XX_YELLOW);
 }
 
 // ******************************************************
 // ** SWITZERLAND FLAG (CH) **
 // ******************************************************
-void drawCHFlag(int x, int y, int scale)
+void drawCHFlag(Adafruit_GFX &gfx, int x, int y, int scale)
 {
+         TRACE_FUNCTION();
          int w = FLAG_W * scale;
          int h = FLAG_H * scale;
          int crossSize = scale * 2; 
 
-         tft.fillRect(x, y, w, h, ST77XX_RED); // Red Field
+         gfx.fillRect(x, y, w, h, ST77XX_RED); // Red Field
 
          // White Cross (approx 6:1 ratio, simplified)
          // Vertical bar
-         tft.fillRect(x + w / 2 - crossSize / 2, y + crossSize, crossSize, h - 2 * crossSize, ST77XX_WHITE);
+         gfx.fillRect(x + w / 2 - crossSize / 2, y + crossSize, crossSize, h - 2 * crossSize, ST77XX_WHITE);
          // Horizontal bar
-         tft.fillRect(x + crossSize, y + h / 2 - crossSize / 2, w - 2 * crossSize, crossSize, ST77XX_WHITE);
+         gfx.fillRect(x + crossSize, y + h / 2 - crossSize / 2, w - 2 * crossSize, crossSize, ST77XX_WHITE);
 }
 
 // ******************************************************
 // ** TURKEY FLAG (TR) **
 // ******************************************************
-void drawTRFlag(int x, int y, int scale)
+void drawTRFlag(Adafruit_GFX &gfx, int x, int y, int scale)
 {
+         TRACE_FUNCTION();
          int w = FLAG_W * scale;
          int h = FLAG_H * scale;
          int centerX = x + w / 2;
@@ -485,14 +512,14 @@ void drawTRFlag(int x, int y, int scale)
          int smallR = scale * 5; // Small circle for crescent 'bite'
          int starR = scale * 2; // Star radius
 
-         tft.fillRect(x, y, w, h, ST77XX_TURK_RED); // Red Field
+         gfx.fillRect(x, y, w, h, ST77XX_TURK_RED); // Red Field
 
          // Simplified Crescent (White Circle - Inner Red Circle)
-         tft.fillCircle(centerX - scale * 2, centerY, largeR, ST77XX_WHITE);
-         tft.fillCircle(centerX - scale, centerY, smallR, ST77XX_TURK_RED);
+         gfx.fillCircle(centerX - scale * 2, centerY, largeR, ST77XX_WHITE);
+         gfx.fillCircle(centerX - scale, centerY, smallR, ST77XX_TURK_RED);
 
          // Simplified Star (White Circle)
-         tft.fillCircle(centerX + scale * 4, centerY, starR, ST77XX_WHITE);
+         gfx.fillCircle(centerX + scale * 4, centerY, starR, ST77XX_WHITE);
 }
 
 // ******************************************************
@@ -505,8 +532,9 @@ void drawTRFlag(int x, int y, int scale)
 /**
   * @brief Draws the India Flag (Saffron, White, Green + simplified Chakra).
   */
-void drawINFlag(int x, int y, int scale)
+void drawINFlag(Adafruit_GFX &gfx, int x, int y, int scale)
 {
+         TRACE_FUNCTION();
          int w = FLAG_W * scale;    // 128
          int h = FLAG_H * scale;    // 80
          int stripeH = h / 3;          // 26, 27, 27 (approx for 4x scale)
@@ -515,88 +543,93 @@ void drawINFlag(int x, int y, int scale)
          int centerY = y + h / 2;
 
          // 1. Tricolor Stripes
-         tft.fillRect(x, y, w, stripeH, ST77XX_SAFFRON);    // Top: Saffron
-         tft.fillRect(x, y + stripeH, w, stripeH, ST77XX_WHITE);    // Middle: White
-         tft.fillRect(x, y + 2 * stripeH, w, h - 2 * stripeH, ST77XX_DARKGREEN);    // Bottom: Green
+         gfx.fillRect(x, y, w, stripeH, ST77XX_SAFFRON);    // Top: Saffron
+         gfx.fillRect(x, y + stripeH, w, stripeH, ST77XX_WHITE);    // Middle: White
+         gfx.fillRect(x, y + 2 * stripeH, w, h - 2 * stripeH, ST77XX_DARKGREEN);    // Bottom: Green
 
          // 2. Ashoka Chakra (Simplified as a Navy Blue circle)
-         tft.fillCircle(centerX, centerY, radius, ST77XX_NAVY);
-         tft.drawCircle(centerX, centerY, radius, ST77XX_NAVY);
+         gfx.fillCircle(centerX, centerY, radius, ST77XX_NAVY);
+         gfx.drawCircle(centerX, centerY, radius, ST77XX_NAVY);
 }
 
 /**
   * @brief Draws the Germany Flag (Black, Red, Gold horizontal tricolor).
   */
-void drawDEFlag(int x, int y, int scale)
+void drawDEFlag(Adafruit_GFX &gfx, int x, int y, int scale)
 {
+         TRACE_FUNCTION();
          int w = FLAG_W * scale; // 128
          int h = FLAG_H * scale; // 80
          int stripeH = h / 3;         // 26, 27, 27 (approx for 4x scale)
 
          // 1. Black
-         tft.fillRect(x, y, w, stripeH, ST77XX_BLACK);
+         gfx.fillRect(x, y, w, stripeH, ST77XX_BLACK);
          // 2. Red
-         tft.fillRect(x, y + stripeH, w, stripeH, ST77XX_RED);
+         gfx.fillRect(x, y + stripeH, w, stripeH, ST77XX_RED);
          // 3. Gold
-         tft.fillRect(x, y + 2 * stripeH, w, h - 2 * stripeH, ST77XX_GOLD);
+         gfx.fillRect(x, y + 2 * stripeH, w, h - 2 * stripeH, ST77XX_GOLD);
 }
 
 /**
   * @brief Draws the France Flag (Blue, White, Red vertical tricolor).
   */
-void drawFRFlag(int x, int y, int scale)
+void drawFRFlag(Adafruit_GFX &gfx, int x, int y, int scale)
 {
+         TRACE_FUNCTION();
          int w = FLAG_W * scale; // 128
          int h = FLAG_H * scale; // 80
          int stripeW = w / 3;         // 42, 43, 43 (approx for 4x scale)
 
          // 1. Blue (Paris Blue is traditional)
-         tft.fillRect(x, y, stripeW, h, ST77XX_PARIS_BLUE);
+         gfx.fillRect(x, y, stripeW, h, ST77XX_PARIS_BLUE);
          // 2. White
-         tft.fillRect(x + stripeW, y, stripeW, h, ST77XX_WHITE);
+         gfx.fillRect(x + stripeW, y, stripeW, h, ST77XX_WHITE);
          // 3. Red
-         tft.fillRect(x + 2 * stripeW, y, w - 2 * stripeW, h, ST77XX_RED);
+         gfx.fillRect(x + 2 * stripeW, y, w - 2 * stripeW, h, ST77XX_RED);
 }
 
 /**
   * @brief Draws the Netherlands Flag (Red, White, Blue horizontal tricolor).
   */
-void drawNLFlag(int x, int y, int scale)
+void drawNLFlag(Adafruit_GFX &gfx, int x, int y, int scale)
 {
+         TRACE_FUNCTION();
          int w = FLAG_W * scale; // 128
          int h = FLAG_H * scale; // 80
          int stripeH = h / 3;         // 26, 27, 27 (approx for 4x scale)
 
          // 1. Red
-         tft.fillRect(x, y, w, stripeH, ST77XX_RED);
+         gfx.fillRect(x, y, w, stripeH, ST77XX_RED);
          // 2. White
-         tft.fillRect(x, y + stripeH, w, stripeH, ST77XX_WHITE);
+         gfx.fillRect(x, y + stripeH, w, stripeH, ST77XX_WHITE);
          // 3. Blue
-         tft.fillRect(x, y + 2 * stripeH, w, h - 2 * stripeH, ST77XX_BLUE);
+         gfx.fillRect(x, y + 2 * stripeH, w, h - 2 * stripeH, ST77XX_BLUE);
 }
 
 /**
   * @brief Draws the Ireland Flag (Green, White, Orange vertical tricolor).
   */
-void drawIEFlag(int x, int y, int scale)
+void drawIEFlag(Adafruit_GFX &gfx, int x, int y, int scale)
 {
+         TRACE_FUNCTION();
          int w = FLAG_W * scale; // 128
          int h = FLAG_H * scale; // 80
          int stripeW = w / 3;         // 42, 43, 43 (approx for 4x scale)
 
          // 1. Green
-         tft.fillRect(x, y, stripeW, h, ST77XX_GREEN);
+         gfx.fillRect(x, y, stripeW, h, ST77XX_GREEN);
          // 2. White
-         tft.fillRect(x + stripeW, y, stripeW, h, ST77XX_WHITE);
+         gfx.fillRect(x + stripeW, y, stripeW, h, ST77XX_WHITE);
          // 3. Orange
-         tft.fillRect(x + 2 * stripeW, y, w - 2 * stripeW, h, ST77XX_ORANGE_IE);
+         gfx.fillRect(x + 2 * stripeW, y, w - 2 * stripeW, h, ST77XX_ORANGE_IE);
 }
 
 /**
   * @brief Draws the Japan Flag (White field, Red Hinomaru disc).
   */
-void drawJPFlag(int x, int y, int scale)
+void drawJPFlag(Adafruit_GFX &gfx, int x, int y, int scale)
 {
+         TRACE_FUNCTION();
          int w = FLAG_W * scale;    // 128
          int h = FLAG_H * scale;    // 80
          int radius = scale * 8;    // Radius (32 pixels at 4x scale)
@@ -604,17 +637,18 @@ void drawJPFlag(int x, int y, int scale)
          int centerY = y + h / 2;
 
          // 1. White Field
-         tft.fillRect(x, y, w, h, ST77XX_WHITE);
+         gfx.fillRect(x, y, w, h, ST77XX_WHITE);
 
          // 2. Red Disc (Hinomaru)
-         tft.fillCircle(centerX, centerY, radius, ST77XX_RED);
+         gfx.fillCircle(centerX, centerY, radius, ST77XX_RED);
 }
 
 /**
   * @brief Draws the Australia Flag (Simplified Blue Ensign, stars as circles).
   */
-void drawAUFlag(int x, int y, int scale)
+void drawAUFlag(Adafruit_GFX &gfx, int x, int y, int scale)
 {
+         TRACE_FUNCTION();
          int w = FLAG_W * scale; // 128
          int h = FLAG_H * scale; // 80
          int cantonW = w / 2;
@@ -622,65 +656,68 @@ void drawAUFlag(int x, int y, int scale)
          int starSize = scale * 2;
 
          // 1. Background Blue
-         tft.fillRect(x, y, w, h, ST77XX_BLUE);
+         gfx.fillRect(x, y, w, h, ST77XX_BLUE);
 
          // 2. Simplified Union Jack in Canton (using pre-existing logic)
-         drawGBFlag(x, y, scale);
+         drawGBFlag(gfx, x, y, scale);
 
          // 3. Commonwealth Star (Simplified as a large white circle below the canton)
          int cx = x + cantonW / 2;
          int cy = y + h - (h / 4);
-         tft.fillCircle(cx, cy, starSize + scale, ST77XX_WHITE);
+         gfx.fillCircle(cx, cy, starSize + scale, ST77XX_WHITE);
 
          // 4. Southern Cross (Simplified placement of 5 white circles)
          int scX = x + cantonW + (w - cantonW) / 4;
          int scY = y + cantonH + (h - cantonH) / 4;
-         tft.fillCircle(scX, scY, starSize, ST77XX_WHITE);
-         tft.fillCircle(scX + scale * 4, scY, starSize, ST77XX_WHITE);
-         tft.fillCircle(scX, scY + scale * 4, starSize, ST77XX_WHITE);
-         tft.fillCircle(scX + scale * 4, scY + scale * 4, starSize, ST77XX_WHITE);
-         tft.fillCircle(scX + scale * 2, scY + scale * 8, starSize, ST77XX_WHITE); // Pointer star
+         gfx.fillCircle(scX, scY, starSize, ST77XX_WHITE);
+         gfx.fillCircle(scX + scale * 4, scY, starSize, ST77XX_WHITE);
+         gfx.fillCircle(scX, scY + scale * 4, starSize, ST77XX_WHITE);
+         gfx.fillCircle(scX + scale * 4, scY + scale * 4, starSize, ST77XX_WHITE);
+         gfx.fillCircle(scX + scale * 2, scY + scale * 8, starSize, ST77XX_WHITE); // Pointer star
 }
 
 /**
   * @brief Draws the Belgium Flag (Black, Yellow, Red vertical tricolor).
   */
-void drawBEFlag(int x, int y, int scale)
+void drawBEFlag(Adafruit_GFX &gfx, int x, int y, int scale)
 {
+         TRACE_FUNCTION();
          int w = FLAG_W * scale; // 128
          int h = FLAG_H * scale; // 80
          int stripeW = w / 3;         // 42, 43, 43 (approx for 4x scale)
 
          // 1. Black
-         tft.fillRect(x, y, stripeW, h, ST77XX_BLACK);
+         gfx.fillRect(x, y, stripeW, h, ST77XX_BLACK);
          // 2. Yellow
-         tft.fillRect(x + stripeW, y, stripeW, h, ST77XX_YELLOW);
+         gfx.fillRect(x + stripeW, y, stripeW, h, ST77XX_YELLOW);
          // 3. Red
-         tft.fillRect(x + 2 * stripeW, y, w - 2 * stripeW, h, ST77XX_RED);
+         gfx.fillRect(x + 2 * stripeW, y, w - 2 * stripeW, h, ST77XX_RED);
 }
 
 /**
   * @brief Draws the Russia Flag (White, Blue, Red horizontal tricolor).
   */
-void drawRUFlag(int x, int y, int scale)
+void drawRUFlag(Adafruit_GFX &gfx, int x, int y, int scale)
 {
+         TRACE_FUNCTION();
          int w = FLAG_W * scale; // 128
          int h = FLAG_H * scale; // 80
          int stripeH = h / 3;         // 26, 27, 27 (approx for 4x scale)
 
          // 1. White
-         tft.fillRect(x, y, w, stripeH, ST77XX_WHITE);
+         gfx.fillRect(x, y, w, stripeH, ST77XX_WHITE);
          // 2. Blue
-         tft.fillRect(x, y + stripeH, w, stripeH, ST77XX_BLUE);
+         gfx.fillRect(x, y + stripeH, w, stripeH, ST77XX_BLUE);
          // 3. Red
-         tft.fillRect(x, y + 2 * stripeH, w, h - 2 * stripeH, ST77XX_RED);
+         gfx.fillRect(x, y + 2 * stripeH, w, h - 2 * stripeH, ST77XX_RED);
 }
 
 /**
   * @brief Draws the Canada Flag (Red-White-Red triband with simplified Maple Leaf).
   */
-void drawCAFlag(int x, int y, int scale)
+void drawCAFlag(Adafruit_GFX &gfx, int x, int y, int scale)
 {
+         TRACE_FUNCTION();
          int w = FLAG_W * scale; // 128
          int h = FLAG_H * scale; // 80
          int bandW = w / 4;             // 32 pixels wide for the red bands (1:2:1 ratio)
@@ -690,14 +727,14 @@ void drawCAFlag(int x, int y, int scale)
          int centerY = y + h / 2;
 
          // 1. Left Red Band
-         tft.fillRect(x, y, bandW, h, ST77XX_RED);
+         gfx.fillRect(x, y, bandW, h, ST77XX_RED);
          // 2. White Center Band
-         tft.fillRect(x + bandW, y, centerW, h, ST77XX_WHITE);
+         gfx.fillRect(x + bandW, y, centerW, h, ST77XX_WHITE);
          // 3. Right Red Band
-         tft.fillRect(x + bandW + centerW, y, w - (bandW + centerW), h, ST77XX_RED);
+         gfx.fillRect(x + bandW + centerW, y, w - (bandW + centerW), h, ST77XX_RED);
 
          // 4. Simplified Maple Leaf (Red Circle in the center)
-         tft.fillCircle(centerX, centerY, leafRadius, ST77XX_RED);
+         gfx.fillCircle(centerX, centerY, leafRadius, ST77XX_RED);
 }
 
 
@@ -709,8 +746,9 @@ void drawCAFlag(int x, int y, int scale)
   * @param y Y coordinate.
   * @param scale The scaling factor (e.g., 4x for 128x80 on screen).
   */
-void drawUSFlag(int x, int y, int scale)
+void drawUSFlag(Adafruit_GFX &gfx, int x, int y, int scale)
 {
+         TRACE_FUNCTION();
          int w = FLAG_W * scale;      // 128
          int h = FLAG_H * scale;      // 80
          int stripeH = h / 13;          // Height of one of the 13 stripes (~6 pixels)
@@ -721,14 +759,14 @@ void drawUSFlag(int x, int y, int scale)
          for (int i = 0; i < 13; i++)
          {
                   uint16_t color = (i % 2 == 0) ? ST77XX_RED : ST77XX_WHITE;
-                  tft.fillRect(x, y + i * stripeH, w, stripeH, color);
+                  gfx.fillRect(x, y + i * stripeH, w, stripeH, color);
          }
 
          // Fill the remaining tiny gap at the bottom if 13 doesn't divide evenly
-         tft.fillRect(x, y + 13 * stripeH, w, h - 13 * stripeH, ST77XX_RED);
+         gfx.fillRect(x, y + 13 * stripeH, w, h - 13 * stripeH, ST77XX_RED);
 
          // 2. Draw the Blue Union (Canton)
-         tft.fillRect(x, y, cantonW, cantonH, ST77XX_BLUE);
+         gfx.fillRect(x, y, cantonW, cantonH, ST77XX_BLUE);
 
          // 3. Simple Star Pattern (5 placeholder stars for recognition)
          int starColor = ST77XX_WHITE;
@@ -737,7 +775,7 @@ void drawUSFlag(int x, int y, int scale)
          // Lambda to draw a simple circle as a 'star' placeholder
          auto drawStar = [&](int cx, int cy, int size)
          {
-                  tft.fillCircle(cx, cy, size, starColor);
+                  gfx.fillCircle(cx, cy, size, starColor);
          };
 
          // Star placement coordinates (relative to the canton)
@@ -758,156 +796,330 @@ void drawUSFlag(int x, int y, int scale)
   * @param y Y coordinate.
   * @param scale The scaling factor.
   */
-void drawGBFlag(int x, int y, int scale)
+void drawGBFlag(Adafruit_GFX &gfx, int x, int y, int scale)
 {
+         TRACE_FUNCTION();
          int w = FLAG_W * scale; // 128
          int h = FLAG_H * scale; // 80
 
          // 1. Background Blue
-         tft.fillRect(x, y, w, h, ST77XX_BLUE);
+         gfx.fillRect(x, y, w, h, ST77XX_BLUE);
 
          // 2. Simplified St. Andrew's Cross (White diagonal)
          int stACW = scale * 2;                                                          // Thickness of the white diagonal lines
-         tft.drawLine(x, y, x + w, y + h, ST77XX_WHITE); // Top-Left to Bottom-Right
-         tft.drawLine(x, y + h, x + w, y, ST77XX_WHITE); // Bottom-Left to Top-Right
+         gfx.drawLine(x, y, x + w, y + h, ST77XX_WHITE); // Top-Left to Bottom-Right
+         gfx.drawLine(x, y + h, x + w, y, ST77XX_WHITE); // Bottom-Left to Top-Right
          // Thicken the cross using offsets for better visibility
          for (int i = 1; i < stACW / 2; i++)
          {
-                  tft.drawLine(x, y + i, x + w, y + h + i, ST77XX_WHITE);
-                  tft.drawLine(x + i, y, x + w + i, y + h, ST77XX_WHITE);
-                  tft.drawLine(x, y + h - i, x + w, y - i, ST77XX_WHITE);
-                  tft.drawLine(x + i, y + h, x + w + i, y, ST77XX_WHITE);
+                  gfx.drawLine(x, y + i, x + w, y + h + i, ST77XX_WHITE);
+                  gfx.drawLine(x + i, y, x + w + i, y + h, ST77XX_WHITE);
+                  gfx.drawLine(x, y + h - i, x + w, y - i, ST77XX_WHITE);
+                  gfx.drawLine(x + i, y + h, x + w + i, y, ST77XX_WHITE);
          }
 
          // 3. St. George's Cross (Red vertical/horizontal)
          int stGCW = scale * 3;                                                                                          // Thickness of the red cross
-         tft.fillRect(x, y + h / 2 - stGCW / 2, w, stGCW, ST77XX_RED); // Horizontal
-         tft.fillRect(x + w / 2 - stGCW / 2, y, stGCW, h, ST77XX_RED); // Vertical
+         gfx.fillRect(x, y + h / 2 - stGCW / 2, w, stGCW, ST77XX_RED); // Horizontal
+         gfx.fillRect(x + w / 2 - stGCW / 2, y, stGCW, h, ST77XX_RED); // Vertical
 
          // 4. St. Patrick's Cross (Red diagonal - Thinner, drawn *over* St. Andrew's cross)
          // For simplicity, we draw it as a thin line centered on the existing white cross,
          // which effectively creates the white border around the red diagonal of the actual flag.
          int stPCW = scale;
-         tft.drawLine(x + stACW / 2, y, x + w - stACW / 2, y + h, ST77XX_RED);
-         tft.drawLine(x + stACW / 2, y + h, x + w - stACW / 2, y, ST77XX_RED);
+         gfx.drawLine(x + stACW / 2, y, x + w - stACW / 2, y + h, ST77XX_RED);
+         gfx.drawLine(x + stACW / 2, y + h, x + w - stACW / 2, y, ST77XX_RED);
 }
 
 // ******************************************************
 // ** FLAG DRAWING DISPATCHER (for geometry or bitmap) **
 // ******************************************************
 
+// Keep in sync with drawCustomFlag() below.
+const char *const CUSTOM_FLAG_CODES[] = {
+    "US", "GB", "IN", "DE", "FR", "NL", "IE", "JP", "AU", "BE", "RU", "CA",
+    "BR", "AR", "AT", "CL", "CN", "CO", "DK", "EG", "FI", "GR", "ID", "IT",
+    "KE", "MX", "NZ", "NO", "PL", "PT", "ZA", "KR", "ES", "SE", "CH", "TR"
+};
+const int NUM_CUSTOM_FLAG_CODES = sizeof(CUSTOM_FLAG_CODES) / sizeof(CUSTOM_FLAG_CODES[0]);
+
+// ******************************************************
+// ** FLAG BYTECODE INTERPRETER **
+// ******************************************************
+// Renders the programs in flag_programs.cpp. Operands are flag units, so every
+// coordinate is multiplied by 'scale' once; shapes map 1:1 onto GFX fill calls.
+
+const uint16_t FLAG_PALETTE[NUM_FLAG_COLORS] = {
+    0x0000, // FC_BLACK
+    0xFFFF, // FC_WHITE
+    0xC884, // FC_RED        (206, 17, 38)
+    0x8004, // FC_MAROON     (128, 0, 32)
+    0xFC00, // FC_ORANGE     (255, 130, 0)
+    0xFE82, // FC_YELLOW     (252, 209, 22)
+    0x0468, // FC_GREEN      (0, 140, 69)
+    0x02C5, // FC_DARKGREEN  (0, 90, 40)
+    0x6D5B, // FC_SKY        (108, 171, 221)
+    0x01D5, // FC_BLUE       (0, 56, 168)
+    0x012F, // FC_NAVY       (0, 36, 125)
+    0x04D4, // FC_TEAL       (0, 155, 165)
+    0x1DA7, // FC_LIGHTGREEN (30, 181, 58)
+    0xFCC6, // FC_SAFFRON    (255, 153, 51)
+    0xA514, // FC_GREY       (160, 160, 160)
+    0x8AC5  // FC_BROWN      (140, 90, 40)
+};
+
+// Unit star outline (x, y) * 1024, outer and inner points alternating, first point straight up.
+// The inner radius is 0.382 of the outer one, as on a regular pentagram.
+static const int16_t STAR_POINTS[10][2] = {
+    {0, -1024}, {230, -316}, {974, -316}, {372, 121}, {602, 828},
+    {0, 391}, {-602, 828}, {-372, 121}, {-974, -316}, {-230, -316}
+};
+
+static uint16_t readProgramColor(const uint8_t *&pc)
+{
+    uint8_t index = *pc++;
+    if (index == FC_RGB565)
+    {
+         uint16_t color = (pc[0] << 8) | pc[1];
+         pc += 2;
+         return color;
+    }
+    return index < NUM_FLAG_COLORS ? FLAG_PALETTE[index] : ST77XX_BLACK;
+}
+
+static void fillProgramStar(Adafruit_GFX &gfx, int cx, int cy, int r, uint16_t color)
+{
+    // Fan of triangles from the centre across each pair of neighbouring outline points.
+    for (int i = 0; i < 10; i++)
+    {
+         const int16_t *a = STAR_POINTS[i];
+         const int16_t *b = STAR_POINTS[(i + 1) % 10];
+         gfx.fillTriangle(cx, cy,
+                          cx + (a[0] * r) / 1024, cy + (a[1] * r) / 1024,
+                          cx + (b[0] * r) / 1024, cy + (b[1] * r) / 1024, color);
+    }
+}
+
+void drawFlagProgram(Adafruit_GFX &gfx, const uint8_t *program, int x, int y, int scale)
+{
+    const int w = FLAG_W * scale;
+    const int h = FLAG_H * scale;
+    const uint8_t *pc = program;
+
+    for (;;)
+    {
+         uint8_t op = *pc++;
+         switch (op)
+         {
+         case FOP_FILL:
+         {
+             uint16_t color = readProgramColor(pc);
+             gfx.fillRect(x, y, w, h, color);
+             break;
+         }
+         case FOP_HSTRIPES:
+         case FOP_VSTRIPES:
+         {
+             // Stripe edges are computed from the full size so rounding never leaves a gap.
+             int n = *pc++;
+             int extent = op == FOP_HSTRIPES ? h : w;
+             for (int i = 0; i < n; i++)
+             {
+                 int start = i * extent / n;
+                 int end = (i + 1) * extent / n;
+                 uint16_t color = readProgramColor(pc);
+                 if (op == FOP_HSTRIPES)
+                 {
+                     gfx.fillRect(x, y + start, w, end - start, color);
+                 }
+                 else
+                 {
+                     gfx.fillRect(x + start, y, end - start, h, color);
+                 }
+             }
+             break;
+         }
+         case FOP_RECT:
+         {
+             int rx = pc[0] * scale, ry = pc[1] * scale, rw = pc[2] * scale, rh = pc[3] * scale;
+             pc += 4;
+             gfx.fillRect(x + rx, y + ry, rw, rh, readProgramColor(pc));
+             break;
+         }
+         case FOP_TRIANGLE:
+         {
+             int p[6];
+             for (int i = 0; i < 6; i++)
+             {
+                 p[i] = pc[i] * scale;
+             }
+             pc += 6;
+             gfx.fillTriangle(x + p[0], y + p[1], x + p[2], y + p[3], x + p[4], y + p[5], readProgramColor(pc));
+             break;
+         }
+         case FOP_CIRCLE:
+         case FOP_STAR:
+         {
+             int cx = x + pc[0] * scale, cy = y + pc[1] * scale, r = pc[2] * scale;
+             pc += 3;
+             uint16_t color = readProgramColor(pc);
+             if (op == FOP_CIRCLE)
+             {
+                 gfx.fillCircle(cx, cy, r, color);
+             }
+             else
+             {
+                 fillProgramStar(gfx, cx, cy, r, color);
+             }
+             break;
+         }
+         case FOP_CROSS:
+         {
+             int cx = pc[0] * scale, cy = pc[1] * scale, t = pc[2] * scale;
+             pc += 3;
+             uint16_t color = readProgramColor(pc);
+             gfx.fillRect(x, y + cy - t / 2, w, t, color);
+             gfx.fillRect(x + cx - t / 2, y, t, h, color);
+             break;
+         }
+         case FOP_CANTON:
+         {
+             int cw = pc[0] * scale, ch = pc[1] * scale;
+             pc += 2;
+             gfx.fillRect(x, y, cw, ch, readProgramColor(pc));
+             break;
+         }
+         default: // FOP_END, or an unknown opcode in a corrupt program
+             return;
+         }
+    }
+}
+
+// Draws an RGB565 bitmap (read in place, e.g. from the mapped flag pack) with each pixel
+// enlarged to pixelSize. Runs of one color become a single fillRect, so flat flags stay cheap.
+static void drawFlagBitmap(Adafruit_GFX &gfx, const uint16_t *pixels, int width, int height, int x, int y, int pixelSize)
+{
+    for (int row = 0; row < height; row++)
+    {
+         const uint16_t *line = pixels + row * width;
+         int runStart = 0;
+         for (int col = 1; col <= width; col++)
+         {
+             if (col == width || line[col] != line[runStart])
+             {
+                 gfx.fillRect(x + runStart * pixelSize, y + row * pixelSize, (col - runStart) * pixelSize, pixelSize, line[runStart]);
+                 runStart = col;
+             }
+         }
+    }
+}
+
 /**
- * @brief Draws a flag bitmap from PROGMEM or uses custom geometry for specific flags.
+ * @brief Draws one of the hand-written geometry flags.
+ * @param code Upper-case 2-letter code.
+ * @return false if 'code' has no hand-written implementation.
+ */
+bool drawCustomFlag(Adafruit_GFX &gfx, const char *code, int x, int y, int scale)
+{
+    // --- EXISTING FLAGS ---
+    if (strcmp(code, "US") == 0) { drawUSFlag(gfx, x, y, scale); return true; }
+    if (strcmp(code, "GB") == 0) { drawGBFlag(gfx, x, y, scale); return true; }
+    if (strcmp(code, "IN") == 0) { drawINFlag(gfx, x, y, scale); return true; }
+    if (strcmp(code, "DE") == 0) { drawDEFlag(gfx, x, y, scale); return true; }
+    if (strcmp(code, "FR") == 0) { drawFRFlag(gfx, x, y, scale); return true; }
+    if (strcmp(code, "NL") == 0) { drawNLFlag(gfx, x, y, scale); return true; }
+    if (strcmp(code, "IE") == 0) { drawIEFlag(gfx, x, y, scale); return true; }
+    if (strcmp(code, "JP") == 0) { drawJPFlag(gfx, x, y, scale); return true; }
+    if (strcmp(code, "AU") == 0) { drawAUFlag(gfx, x, y, scale); return true; }
+    if (strcmp(code, "BE") == 0) { drawBEFlag(gfx, x, y, scale); return true; }
+    if (strcmp(code, "RU") == 0) { drawRUFlag(gfx, x, y, scale); return true; }
+    if (strcmp(code, "CA") == 0) { drawCAFlag(gfx, x, y, scale); return true; }
+
+    // --- IMPROVED / NEW FLAGS ---
+    if (strcmp(code, "BR") == 0) { drawBRFlag(gfx, x, y, scale); return true; }
+    if (strcmp(code, "AR") == 0) { drawARFlag(gfx, x, y, scale); return true; }
+    if (strcmp(code, "AT") == 0) { drawATFlag(gfx, x, y, scale); return true; }
+    if (strcmp(code, "CL") == 0) { drawCLFlag(gfx, x, y, scale); return true; }
+    if (strcmp(code, "CN") == 0) { drawCNFlag(gfx, x, y, scale); return true; }
+    if (strcmp(code, "CO") == 0) { drawCOFlag(gfx, x, y, scale); return true; }
+    if (strcmp(code, "DK") == 0) { drawDKFlag(gfx, x, y, scale); return true; }
+    if (strcmp(code, "EG") == 0) { drawEGFlag(gfx, x, y, scale); return true; }
+    if (strcmp(code, "FI") == 0) { drawFIFlag(gfx, x, y, scale); return true; }
+    if (strcmp(code, "GR") == 0) { drawGRFlag(gfx, x, y, scale); return true; }
+    if (strcmp(code, "ID") == 0) { drawIDFlag(gfx, x, y, scale); return true; }
+    if (strcmp(code, "IT") == 0) { drawITFlag(gfx, x, y, scale); return true; }
+    if (strcmp(code, "KE") == 0) { drawKEFlag(gfx, x, y, scale); return true; }
+    if (strcmp(code, "MX") == 0) { drawMXFlag(gfx, x, y, scale); return true; }
+    if (strcmp(code, "NZ") == 0) { drawNZFlag(gfx, x, y, scale); return true; }
+    if (strcmp(code, "NO") == 0) { drawNOFlag(gfx, x, y, scale); return true; }
+    if (strcmp(code, "PL") == 0) { drawPLFlag(gfx, x, y, scale); return true; }
+    if (strcmp(code, "PT") == 0) { drawPTFlag(gfx, x, y, scale); return true; }
+    if (strcmp(code, "ZA") == 0) { drawZAFlag(gfx, x, y, scale); return true; }
+    if (strcmp(code, "KR") == 0) { drawKRFlag(gfx, x, y, scale); return true; }
+    if (strcmp(code, "ES") == 0) { drawESFlag(gfx, x, y, scale); return true; }
+    if (strcmp(code, "SE") == 0) { drawSEFlag(gfx, x, y, scale); return true; }
+    if (strcmp(code, "CH") == 0) { drawCHFlag(gfx, x, y, scale); return true; }
+    if (strcmp(code, "TR") == 0) { drawTRFlag(gfx, x, y, scale); return true; }
+
+    return false;
+}
+
+/**
+ * @brief Draws a flag: flag pack art first, then hand-written geometry, then the bytecode table,
+ * then an 'unknown' box.
+ * @param gfx Target surface: the TFT itself or an off-screen canvas.
  * @param flagCode The 2-letter country code to look up.
  * @param x X coordinate.
  * @param y Y coordinate.
  * @param scale The scaling factor (e.g., 1 for 32x20, 3 for 96x60).
  */
-void drawFlag(const String &flagCode, int x, int y, int scale)
-{
-    // 1. Convert to upper case and check for custom drawn flags
-    String code = flagCode;
-    code.toUpperCase();
-
-    // --- CUSTOM GEOMETRY FLAGS ---
-         // --- EXISTING FLAGS ---
-         if (code.equals("US")) { drawUSFlag(x, y, scale); return; }
-         if (code.equals("GB")) { drawGBFlag(x, y, scale); return; }
-         if (code.equals("IN")) { drawINFlag(x, y, scale); return; }
-         if (code.equals("DE")) { drawDEFlag(x, y, scale); return; }
-         if (code.equals("FR")) { drawFRFlag(x, y, scale); return; }
-         if (code.equals("NL")) { drawNLFlag(x, y, scale); return; }
-         if (code.equals("IE")) { drawIEFlag(x, y, scale); return; }
-         if (code.equals("JP")) { drawJPFlag(x, y, scale); return; }
-         if (code.equals("AU")) { drawAUFlag(x, y, scale); return; }
-         if (code.equals("BE")) { drawBEFlag(x, y, scale); return; }
-         if (code.equals("RU")) { drawRUFlag(x, y, scale); return; }
-         if (code.equals("CA")) { drawCAFlag(x, y, scale); return; }
-
-         // --- IMPROVED / NEW FLAGS ---
-         if (code.equals("BR")) { drawBRFlag(x, y, scale); return; }
-         if (code.equals("AR")) { drawARFlag(x, y, scale); return; }
-         if (code.equals("AT")) { drawATFlag(x, y, scale); return; }
-         if (code.equals("CL")) { drawCLFlag(x, y, scale); return; }
-         if (code.equals("CN")) { drawCNFlag(x, y, scale); return; }
-         if (code.equals("CO")) { drawCOFlag(x, y, scale); return; }
-         if (code.equals("DK")) { drawDKFlag(x, y, scale); return; }
-         if (code.equals("EG")) { drawEGFlag(x, y, scale); return; }
-         if (code.equals("FI")) { drawFIFlag(x, y, scale); return; }
-         if (code.equals("GR")) { drawGRFlag(x, y, scale); return; }
-         if (code.equals("ID")) { drawIDFlag(x, y, scale); return; }
-         if (code.equals("IT")) { drawITFlag(x, y, scale); return; }
-         if (code.equals("KE")) { drawKEFlag(x, y, scale); return; }
-         if (code.equals("MX")) { drawMXFlag(x, y, scale); return; }
-         if (code.equals("NZ")) { drawNZFlag(x, y, scale); return; }
-         if (code.equals("NO")) { drawNOFlag(x, y, scale); return; }
-         if (code.equals("PL")) { drawPLFlag(x, y, scale); return; }
-         if (code.equals("PT")) { drawPTFlag(x, y, scale); return; }
-         if (code.equals("ZA")) { drawZAFlag(x, y, scale); return; }
-         if (code.equals("KR")) { drawKRFlag(x, y, scale); return; }
-         if (code.equals("ES")) { drawESFlag(x, y, scale); return; }
-         if (code.equals("SE")) { drawSEFlag(x, y, scale); return; }
-         if (code.equals("CH")) { drawCHFlag(x, y, scale); return; }
-         if (code.equals("TR")) { drawTRFlag(x, y, scale); return; }
-         else {
-            int scaledW = FLAG_W * scale;
-            int scaledH = FLAG_H * scale;
-            tft.drawRect(x, y, scaledW, scaledH, ST77XX_RED);
-            tft.fillRect(x + 1, y + 1, scaledW - 2, scaledH - 2, ST77XX_BLACK);
-            tft.setCursor(x + 5, y + (scaledH / 2) - 5);
-            tft.setTextSize(1);
-            tft.setTextColor(ST77XX_RED);
-            tft.print(code.c_str());
-            return;
-         }
+void drawFlag(Adafruit_GFX &gfx, const char *flagCode, int x, int y, int scale)
+{
+    // 1. Convert to upper case (on the stack)
+    char code[4] = "";
+    for (int i = 0; i < 3 && flagCode[i]; i++)
+    {
+         code[i] = toupper((unsigned char)flagCode[i]);
+    }
+
+    // 2. Art from the flag pack partition wins, so flags can be changed without a reflash
+    const uint8_t *packData = nullptr;
+    const FlagPackEntry *packEntry = flagPackLookup(code, &packData);
+    if (packEntry && packEntry->kind == FLAG_PACK_PROGRAM)
+    {
+         drawFlagProgram(gfx, packData, x, y, scale);
+         return;
+    }
+    if (packEntry && packEntry->kind == FLAG_PACK_BITMAP)
+    {
+         int pixelSize = max(1, FLAG_W * scale / packEntry->width);
+         drawFlagBitmap(gfx, (const uint16_t *)packData, packEntry->width, packEntry->height, x, y, pixelSize);
+         return;
+    }
+
+    // 3. Built-in art: hand-written geometry, then the bytecode table for every other ISO code
+    if (drawCustomFlag(gfx, code, x, y, scale))
+    {
+         return;
+    }
+    const FlagProgram *program = flagProgramLookup(code);
+    if (program)
+    {
+         drawFlagProgram(gfx, program->ops, x, y, scale);
+         return;
+    }
+
+    int scaledW = FLAG_W * scale;
+    int scaledH = FLAG_H * scale;
+    gfx.drawRect(x, y, scaledW, scaledH, ST77XX_RED);
+    gfx.fillRect(x + 1, y + 1, scaledW - 2, scaledH - 2, ST77XX_BLACK);
+    gfx.setCursor(x + 5, y + (scaledH / 2) - 5);
+    gfx.setTextSize(1);
+    gfx.setTextColor(ST77XX_RED);
+    gfx.print(code);
+}
 
-    // // --- FALLBACK TO BITMAP LOOKUP FOR ALL OTHER FLAGS ---
-    // const uint16_t *bitmapData = nullptr;
-
-    // for (int i = 0; i < NUM_FLAGS; i++)
-    // {
-    //     // Check against the array of bitmap data codes defined in flag_data.h
-    //     if (code.equals(FLAG_LOOKUP[i].code))
-    //     {
-    //         bitmapData = FLAG_LOOKUP[i].bitmap;
-    //         break;
-    //     }
-    // }
-
-    // int scaledW = FLAG_W * scale;
-    // int scaledH = FLAG_H * scale;
-
-    // // Fallback: If code is not found, draw a simple 'Unknown' pattern
-    // if (bitmapData == nullptr)
-    // {
-    //     tft.drawRect(x, y, scaledW, scaledH, ST77XX_RED);
-    //     tft.fillRect(x + 1, y + 1, scaledW - 2, scaledH - 2, ST77XX_BLACK);
-    //     tft.setCursor(x + 5, y + (scaledH / 2) - 5);
-    //     tft.setTextSize(1);
-    //     tft.setTextColor(ST77XX_RED);
-    //     tft.print(code.c_str());
-    //     return;
-    // }
-
-    // // 2. Draw the bitmap using fast pixel writing with scaling
-    // tft.startWrite();
-    // // Set the address window for the entire scaled flag area
-    // tft.setAddrWindow(x, y, x + scaledW - 1, y + scaledH - 1);
-
-    // for (int row = 0; row < FLAG_H; row++)
-    // {
-    //     for (int r = 0; r < scale; r++)
-    //     { // Row scaling loop: Repeat row 'scale' times
-    //         for (int col = 0; col < FLAG_W; col++)
-    //         {
-    //             // Read 16-bit color from PROGMEM (Flash memory)
-    //             uint16_t color = pgm_read_word(&bitmapData[row * FLAG_W + col]);
-
-    //             // Column scaling loop: Write the color 'scale' times
-    //             tft.writeColor(color, scale);
-    //         }
-    //     }
-    // }
-    // tft.endWrite();
-    // tft.setAddrWindow(0, 0, tft.width() - 1, tft.height() - 1); // Reset window
-}
\ No newline at end of file
+void drawFlag(const char *flagCode, int x, int y, int scale)
+{
+    drawFlag(tft, flagCode, x, y, scale);
+}
@@ -49,53 +49,77 @@ extern Adafruit_ST7789 tft;
 #define ST77XX_KE_BLACK   tft.color565(0, 0, 0)
 
 // --- FUNCTION PROTOTYPES ---
+// Every draw*Flag renders onto 'gfx', so flags can be drawn straight to the TFT
+// or prerendered into an off-screen canvas.
 
-void drawUSFlag(int x, int y, int scale);
-void drawBRFlag(int x, int y, int scale); 
-void drawGBFlag(int x, int y, int scale);
-void drawINFlag(int x, int y, int scale);    // India
-void drawDEFlag(int x, int y, int scale);    // Germany
-void drawFRFlag(int x, int y, int scale);    // France
-void drawNLFlag(int x, int y, int scale);    // Netherlands
-void drawIEFlag(int x, int y, int scale);    // Ireland
-void drawJPFlag(int x, int y, int scale);    // Japan
-void drawAUFlag(int x, int y, int scale);    // Australia
-void drawBEFlag(int x, int y, int scale);    // Belgium
-void drawRUFlag(int x, int y, int scale);    // Russia
-void drawCAFlag(int x, int y, int scale);    // Canada
+void drawUSFlag(Adafruit_GFX &gfx, int x, int y, int scale);
+void drawBRFlag(Adafruit_GFX &gfx, int x, int y, int scale); 
+void drawGBFlag(Adafruit_GFX &gfx, int x, int y, int scale);
+void drawINFlag(Adafruit_GFX &gfx, int x, int y, int scale);    // India
+void drawDEFlag(Adafruit_GFX &gfx, int x, int y, int scale);    // Germany
+void drawFRFlag(Adafruit_GFX &gfx, int x, int y, int scale);    // France
+void drawNLFlag(Adafruit_GFX &gfx, int x, int y, int scale);    // Netherlands
+void drawIEFlag(Adafruit_GFX &gfx, int x, int y, int scale);    // Ireland
+void drawJPFlag(Adafruit_GFX &gfx, int x, int y, int scale);    // Japan
+void drawAUFlag(Adafruit_GFX &gfx, int x, int y, int scale);    // Australia
+void drawBEFlag(Adafruit_GFX &gfx, int x, int y, int scale);    // Belgium
+void drawRUFlag(Adafruit_GFX &gfx, int x, int y, int scale);    // Russia
+void drawCAFlag(Adafruit_GFX &gfx, int x, int y, int scale);    // Canada
 
 // New flag drawing prototypes (Requested)
-void drawARFlag(int x, int y, int scale);    // Argentina
-void drawATFlag(int x, int y, int scale);    // Austria
-void drawCLFlag(int x, int y, int scale);    // Chile
-void drawCNFlag(int x, int y, int scale);    // China
-void drawCOFlag(int x, int y, int scale);    // Colombia
-void drawDKFlag(int x, int y, int scale);    // Denmark
-void drawEGFlag(int x, int y, int scale);    // Egypt
-void drawFIFlag(int x, int y, int scale);    // Finland
-void drawGRFlag(int x, int y, int scale);    // Greece
-void drawIDFlag(int x, int y, int scale);    // Indonesia
-void drawITFlag(int x, int y, int scale);    // Italy
-void drawKEFlag(int x, int y, int scale);    // Kenya
-void drawMXFlag(int x, int y, int scale);    // Mexico
-void drawNZFlag(int x, int y, int scale);    // New Zealand
-void drawNOFlag(int x, int y, int scale);    // Norway
-void drawPLFlag(int x, int y, int scale);    // Poland
-void drawPTFlag(int x, int y, int scale);    // Portugal
-void drawZAFlag(int x, int y, int scale);    // South Africa
-void drawKRFlag(int x, int y, int scale);    // South Korea
-void drawESFlag(int x, int y, int scale);    // Spain
-void drawSEFlag(int x, int y, int scale);    // Sweden
-void drawCHFlag(int x, int y, int scale);    // Switzerland
-void drawTRFlag(int x, int y, int scale);    // Turkey
+void drawARFlag(Adafruit_GFX &gfx, int x, int y, int scale);    // Argentina
+void drawATFlag(Adafruit_GFX &gfx, int x, int y, int scale);    // Austria
+void drawCLFlag(Adafruit_GFX &gfx, int x, int y, int scale);    // Chile
+void drawCNFlag(Adafruit_GFX &gfx, int x, int y, int scale);    // China
+void drawCOFlag(Adafruit_GFX &gfx, int x, int y, int scale);    // Colombia
+void drawDKFlag(Adafruit_GFX &gfx, int x, int y, int scale);    // Denmark
+void drawEGFlag(Adafruit_GFX &gfx, int x, int y, int scale);    // Egypt
+void drawFIFlag(Adafruit_GFX &gfx, int x, int y, int scale);    // Finland
+void drawGRFlag(Adafruit_GFX &gfx, int x, int y, int scale);    // Greece
+void drawIDFlag(Adafruit_GFX &gfx, int x, int y, int scale);    // Indonesia
+void drawITFlag(Adafruit_GFX &gfx, int x, int y, int scale);    // Italy
+void drawKEFlag(Adafruit_GFX &gfx, int x, int y, int scale);    // Kenya
+void drawMXFlag(Adafruit_GFX &gfx, int x, int y, int scale);    // Mexico
+void drawNZFlag(Adafruit_GFX &gfx, int x, int y, int scale);    // New Zealand
+void drawNOFlag(Adafruit_GFX &gfx, int x, int y, int scale);    // Norway
+void drawPLFlag(Adafruit_GFX &gfx, int x, int y, int scale);    // Poland
+void drawPTFlag(Adafruit_GFX &gfx, int x, int y, int scale);    // Portugal
+void drawZAFlag(Adafruit_GFX &gfx, int x, int y, int scale);    // South Africa
+void drawKRFlag(Adafruit_GFX &gfx, int x, int y, int scale);    // South Korea
+void drawESFlag(Adafruit_GFX &gfx, int x, int y, int scale);    // Spain
+void drawSEFlag(Adafruit_GFX &gfx, int x, int y, int scale);    // Sweden
+void drawCHFlag(Adafruit_GFX &gfx, int x, int y, int scale);    // Switzerland
+void drawTRFlag(Adafruit_GFX &gfx, int x, int y, int scale);    // Turkey
 
 /**
- * @brief Main dispatcher function: Draws a flag using custom geometry or falls back to bitmap lookup.
+ * @brief Draws one of the hand-written geometry flags above.
+ * @param code Upper-case 2-letter code.
+ * @return false if 'code' has no hand-written implementation (nothing is drawn).
+ */
+bool drawCustomFlag(Adafruit_GFX &gfx, const char *code, int x, int y, int scale);
+
+/**
+ * @brief Runs a flag bytecode program (see flag_programs.h) at the given position and scale.
+ */
+void drawFlagProgram(Adafruit_GFX &gfx, const uint8_t *program, int x, int y, int scale);
+
+/**
+ * @brief Main dispatcher function: Draws a flag using custom geometry, then the bytecode table (every ISO code).
+ * @param gfx Target surface: the TFT itself or an off-screen canvas (safe to use from another task).
  * @param flagCode The 2-letter country code (e.g., "US", "BR").
  * @param x X coordinate.
  * @param y Y coordinate.
  * @param scale The scaling factor (e.g., 4x for 128x80 on screen).
  */
-void drawFlag(const String &flagCode, int x, int y, int scale);
+void drawFlag(Adafruit_GFX &gfx, const char *flagCode, int x, int y, int scale);
+
+/**
+ * @brief Same as above, drawing directly on the TFT.
+ */
+void drawFlag(const char *flagCode, int x, int y, int scale);
+
+// Every code with a custom geometry implementation (upper case), e.g. for cache warm-up.
+extern const char *const CUSTOM_FLAG_CODES[];
+extern const int NUM_CUSTOM_FLAG_CODES;
 
 #endif // FLAG_DRAWING_H
\ No newline at end of file
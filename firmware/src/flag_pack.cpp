@@ -0,0 +1,365 @@
+#include "flag_pack.h"
+#include <string.h>
+#include <ctype.h>
+
+#ifdef ESP_PLATFORM
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <esp_partition.h>
+#include "deferred_log.h"
+#include "flag_cache.h"
+#else
+// Host build: the pack is a plain file mapped with mmap(2)
+#include <stdio.h>
+#include <stdlib.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define LOG_INFO(...) fprintf(stderr, __VA_ARGS__)
+#define LOG_WARN(...) fprintf(stderr, __VA_ARGS__)
+#define LOG_ERROR(...) fprintf(stderr, __VA_ARGS__)
+#endif
+
+// ******************************************************
+// ** FLAG ASSET PACK (memory-mapped flash partition) **
+// ******************************************************
+// The whole partition is mapped into the data address space once. Lookups index
+// the 26x26 slot table directly and hand out pointers into the mapping, so flag
+// art is never copied into RAM. All bounds are checked once, when the pack is mapped.
+
+static const uint8_t *packBase = nullptr; // Start of the mapping (the pack header)
+static size_t packSize = 0;               // Mapped bytes
+static const FlagPackEntry *packIndex = nullptr;
+static int packFlags = 0;
+
+#ifdef ESP_PLATFORM
+static const esp_partition_t *packPartition = nullptr;
+static spi_flash_mmap_handle_t packHandle;
+#endif
+
+static const size_t PACK_DATA_START = sizeof(FlagPackHeader) + FLAG_PACK_SLOTS * sizeof(FlagPackEntry);
+
+// CRC-32 as computed by zlib.crc32() in the pack builder. Only runs when a pack is mapped.
+static uint32_t packCrc32(const uint8_t *data, size_t len)
+{
+    uint32_t crc = 0xFFFFFFFF;
+    while (len--)
+    {
+         crc ^= *data++;
+         for (int k = 0; k < 8; k++)
+         {
+             crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+         }
+    }
+    return ~crc;
+}
+
+static bool mapStore()
+{
+#ifdef ESP_PLATFORM
+    packPartition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, (esp_partition_subtype_t)FLAG_PACK_SUBTYPE, FLAG_PACK_PARTITION);
+    if (!packPartition)
+    {
+         LOG_WARN("No '%s' partition: flags use the built-in art.\n", FLAG_PACK_PARTITION);
+         return false;
+    }
+    const void *ptr = nullptr;
+    esp_err_t err = esp_partition_mmap(packPartition, 0, packPartition->size, SPI_FLASH_MMAP_DATA, &ptr, &packHandle);
+    if (err != ESP_OK)
+    {
+         LOG_ERROR("Flag pack mmap failed: %s\n", esp_err_to_name(err));
+         return false;
+    }
+    packBase = (const uint8_t *)ptr;
+    packSize = packPartition->size;
+    return true;
+#else
+    const char *path = getenv(FLAG_PACK_HOST_PATH_ENV);
+    if (!path)
+    {
+         path = "flagpack.bin";
+    }
+    int fd = open(path, O_RDONLY);
+    if (fd < 0)
+    {
+         LOG_WARN("No flag pack at %s: flags use the built-in art.\n", path);
+         return false;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size == 0)
+    {
+         close(fd);
+         return false;
+    }
+    void *ptr = mmap(nullptr, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd); // The mapping keeps the file referenced
+    if (ptr == MAP_FAILED)
+    {
+         LOG_ERROR("Flag pack mmap of %s failed.\n", path);
+         return false;
+    }
+    packBase = (const uint8_t *)ptr;
+    packSize = st.st_size;
+    return true;
+#endif
+}
+
+static void unmapStore()
+{
+#ifdef ESP_PLATFORM
+    spi_flash_munmap(packHandle);
+#else
+    munmap((void *)packBase, packSize);
+#endif
+    packBase = nullptr;
+    packSize = 0;
+}
+
+// Checks everything a lookup relies on, so the hot path can trust the mapping.
+static bool validatePack(int *flagCount)
+{
+    if (packSize < PACK_DATA_START)
+    {
+         return false;
+    }
+    const FlagPackHeader *header = (const FlagPackHeader *)packBase;
+    if (memcmp(header->magic, FLAG_PACK_MAGIC, 4) != 0)
+    {
+         LOG_WARN("Flag pack: no pack written (bad magic).\n");
+         return false;
+    }
+    if (header->version != FLAG_PACK_VERSION || header->totalSize < PACK_DATA_START || header->totalSize > packSize)
+    {
+         LOG_WARN("Flag pack: unsupported version %u or bad size %lu.\n", (unsigned)header->version, (unsigned long)header->totalSize);
+         return false;
+    }
+    uint32_t crc = packCrc32(packBase + sizeof(FlagPackHeader), header->totalSize - sizeof(FlagPackHeader));
+    if (crc != header->crc32)
+    {
+         LOG_WARN("Flag pack: CRC mismatch (%08lx != %08lx).\n", (unsigned long)crc, (unsigned long)header->crc32);
+         return false;
+    }
+
+    const FlagPackEntry *index = (const FlagPackEntry *)(packBase + sizeof(FlagPackHeader));
+    int count = 0;
+    for (int i = 0; i < FLAG_PACK_SLOTS; i++)
+    {
+         const FlagPackEntry &entry = index[i];
+         if (entry.kind == FLAG_PACK_EMPTY)
+         {
+             continue;
+         }
+         bool inBounds = entry.offset >= PACK_DATA_START && entry.length > 0 &&
+                         (uint64_t)entry.offset + entry.length <= header->totalSize;
+         bool valid = false;
+         if (entry.kind == FLAG_PACK_BITMAP)
+         {
+             valid = entry.width && entry.height && entry.offset % 2 == 0 &&
+                     entry.length == (uint32_t)entry.width * entry.height * 2;
+         }
+         else if (entry.kind == FLAG_PACK_PROGRAM)
+         {
+             valid = inBounds && packBase[entry.offset + entry.length - 1] == 0; // Ends with FOP_END
+         }
+         if (!inBounds || !valid)
+         {
+             LOG_WARN("Flag pack: slot %c%c is malformed.\n", 'A' + i / 26, 'A' + i % 26);
+             return false;
+         }
+         count++;
+    }
+    *flagCount = count;
+    return true;
+}
+
+// --- PUBLIC API ---
+
+bool flagPackBegin()
+{
+    flagPackEnd();
+    if (!mapStore())
+    {
+         return false;
+    }
+    int count = 0;
+    if (!validatePack(&count))
+    {
+         unmapStore();
+         return false;
+    }
+    packIndex = (const FlagPackEntry *)(packBase + sizeof(FlagPackHeader));
+    packFlags = count;
+    LOG_INFO("Flag pack mapped: %d flags, %lu bytes.\n", count, (unsigned long)((const FlagPackHeader *)packBase)->totalSize);
+    return true;
+}
+
+void flagPackEnd()
+{
+    packIndex = nullptr;
+    packFlags = 0;
+    if (packBase)
+    {
+         unmapStore();
+    }
+}
+
+const FlagPackEntry *flagPackLookup(const char *code, const uint8_t **data)
+{
+    if (!packIndex || !code[0] || !code[1] || code[2])
+    {
+         return nullptr;
+    }
+    int a = toupper((unsigned char)code[0]) - 'A';
+    int b = toupper((unsigned char)code[1]) - 'A';
+    if (a < 0 || a >= 26 || b < 0 || b >= 26)
+    {
+         return nullptr;
+    }
+    const FlagPackEntry *entry = &packIndex[a * 26 + b];
+    if (entry->kind == FLAG_PACK_EMPTY)
+    {
+         return nullptr;
+    }
+    *data = packBase + entry->offset;
+    return entry;
+}
+
+int flagPackCount()
+{
+    return packFlags;
+}
+
+#ifdef ESP_PLATFORM
+// --- PACK UPDATE (POST /api/flags/pack) ---
+// The upload is streamed straight into the partition, erasing one sector ahead of the
+// write position. The old pack is unmapped first; if the new one does not validate,
+// drawFlag falls back to the built-in art until a good pack is uploaded.
+
+static const size_t FLASH_SECTOR_SIZE = 4096;
+
+static WebServer *packServer = nullptr;
+static size_t uploadWritten = 0;
+static size_t uploadErased = 0;
+static const char *uploadError = nullptr;
+
+static void handlePackUpload()
+{
+    HTTPUpload &upload = packServer->upload();
+    switch (upload.status)
+    {
+    case UPLOAD_FILE_START:
+         uploadWritten = 0;
+         uploadErased = 0;
+         uploadError = nullptr;
+         if (!packPartition)
+         {
+             uploadError = "No flag pack partition in this partition table.";
+         }
+         else if (!flagCacheReady())
+         {
+             uploadError = "Flag prerender still running, retry in a few seconds.";
+         }
+         else
+         {
+             flagPackEnd();
+             flagCacheInvalidate(); // Prerendered frames may show the old art
+             LOG_INFO("Flag pack upload started (%s).\n", upload.filename.c_str());
+         }
+         break;
+
+    case UPLOAD_FILE_WRITE:
+    {
+         if (uploadError)
+         {
+             break;
+         }
+         size_t end = uploadWritten + upload.currentSize;
+         if (end > packPartition->size)
+         {
+             uploadError = "Pack is larger than the partition.";
+             break;
+         }
+         while (uploadErased < end)
+         {
+             if (esp_partition_erase_range(packPartition, uploadErased, FLASH_SECTOR_SIZE) != ESP_OK)
+             {
+                 uploadError = "Flash erase failed.";
+                 return;
+             }
+             uploadErased += FLASH_SECTOR_SIZE;
+         }
+         if (esp_partition_write(packPartition, uploadWritten, upload.buf, upload.currentSize) != ESP_OK)
+         {
+             uploadError = "Flash write failed.";
+             break;
+         }
+         uploadWritten = end;
+         break;
+    }
+
+    case UPLOAD_FILE_END:
+         break;
+
+    default: // UPLOAD_FILE_ABORTED
+         uploadError = "Upload aborted.";
+         break;
+    }
+}
+
+static void handlePackUploadDone()
+{
+    JsonDocument doc;
+    int status = 200;
+    if (uploadError)
+    {
+         status = 400;
+         doc["status"] = "error";
+         doc["message"] = uploadError;
+         flagPackBegin(); // Remap whatever is there now (the old pack, unless writing had begun)
+    }
+    else if (!flagPackBegin())
+    {
+         status = 422;
+         doc["status"] = "error";
+         doc["message"] = "Pack written but failed validation; using the built-in art.";
+    }
+    else
+    {
+         doc["status"] = "ok";
+         doc["flags"] = packFlags;
+    }
+    doc["bytes_written"] = uploadWritten;
+
+    String body;
+    serializeJson(doc, body);
+    packServer->send(status, "application/json", body);
+}
+
+static void handlePackInfo()
+{
+    JsonDocument doc;
+    doc["mapped"] = packIndex != nullptr;
+    doc["flags"] = packFlags;
+    doc["partition_size"] = packPartition ? packPartition->size : 0;
+    if (packIndex)
+    {
+         const FlagPackHeader *header = (const FlagPackHeader *)packBase;
+         char crc[9];
+         snprintf(crc, sizeof(crc), "%08lx", (unsigned long)header->crc32);
+         doc["size"] = header->totalSize;
+         doc["crc32"] = crc;
+    }
+
+    String body;
+    serializeJson(doc, body);
+    packServer->send(200, "application/json", body);
+}
+
+void setupFlagPack(WebServer &server)
+{
+    packServer = &server;
+    server.on("/api/flags/pack", HTTP_GET, handlePackInfo);
+    server.on("/api/flags/pack", HTTP_POST, handlePackUploadDone, handlePackUpload);
+}
+#endif
@@ -0,0 +1,85 @@
+#ifndef FLAG_PACK_H
+#define FLAG_PACK_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// --- FLAG PACK FORMAT ---
+// Flag art lives in its own flash partition ("flagpack", see partitions_flagpack.csv) so it
+// can be replaced without reflashing the firmware. Layout, all little-endian:
+//   FlagPackHeader
+//   FlagPackEntry[26 * 26]   Direct table: slot = (first letter - 'A') * 26 + (second letter - 'A')
+//   entry data               Referenced by offset from the start of the pack
+// The pack is built on the host by firmware/tools/build_flag_pack.py.
+#define FLAG_PACK_MAGIC "W2FP"
+#define FLAG_PACK_VERSION 1
+#define FLAG_PACK_SLOTS (26 * 26)
+#define FLAG_PACK_PARTITION "flagpack"
+#define FLAG_PACK_SUBTYPE 0x40                 // Custom data subtype
+#define FLAG_PACK_PARTITION_SIZE 0xE0000       // As laid out in partitions_flagpack.csv
+#define FLAG_PACK_HOST_PATH_ENV "FLAG_PACK_PATH" // Host build: file to map (default "flagpack.bin")
+
+enum FlagPackKind : uint8_t
+{
+    FLAG_PACK_EMPTY = 0,
+    FLAG_PACK_BITMAP,   // width x height RGB565 pixels, row-major
+    FLAG_PACK_PROGRAM   // Flag bytecode (flag_programs.h), drawn in FLAG_W x FLAG_H units
+};
+
+struct FlagPackHeader
+{
+    char magic[4];        // FLAG_PACK_MAGIC
+    uint16_t version;     // FLAG_PACK_VERSION
+    uint16_t flagCount;   // Non-empty slots
+    uint32_t totalSize;   // Header + index + data
+    uint32_t crc32;       // CRC-32 (zlib) of everything after the header
+};
+
+struct FlagPackEntry
+{
+    uint8_t kind;         // FlagPackKind
+    uint8_t width;        // Bitmap only
+    uint8_t height;       // Bitmap only
+    uint8_t reserved;
+    uint32_t offset;      // From the start of the pack
+    uint32_t length;      // Bytes
+};
+
+static_assert(sizeof(FlagPackHeader) == 16, "FlagPackHeader layout is part of the pack format");
+static_assert(sizeof(FlagPackEntry) == 12, "FlagPackEntry layout is part of the pack format");
+
+/**
+ * @brief Maps the pack (esp_partition_mmap on the device, mmap over a file on the host)
+ * and validates header, CRC and entry bounds. Safe to call again to remap after an update.
+ * @return true if a valid pack is mapped; without one, lookups return nullptr.
+ */
+bool flagPackBegin();
+
+/**
+ * @brief Releases the mapping. Lookups return nullptr until the next flagPackBegin().
+ */
+void flagPackEnd();
+
+/**
+ * @brief O(1) lookup of a 2-letter code (either case) in the mapped pack.
+ * @param data Set to the entry's bytes, pointing straight into the mapping (no copy).
+ * @return The entry, or nullptr if there is no pack or no art for this code.
+ */
+const FlagPackEntry *flagPackLookup(const char *code, const uint8_t **data);
+
+/**
+ * @brief Number of flags in the mapped pack (0 when none is mapped).
+ */
+int flagPackCount();
+
+#ifdef ESP_PLATFORM
+#include <WebServer.h>
+
+/**
+ * @brief Registers GET /api/flags/pack (pack info) and POST /api/flags/pack (multipart upload
+ * of a new pack; written to the partition, verified and remapped in place).
+ */
+void setupFlagPack(WebServer &server);
+#endif
+
+#endif // FLAG_PACK_H
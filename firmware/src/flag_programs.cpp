@@ -0,0 +1,1455 @@
+#include "flag_programs.h"
+
+// ******************************************************
+// ** FLAG PROGRAMS (ISO 3166-1 alpha-2) **
+// ******************************************************
+// One bytecode program per flag, in 32x20 flag units (see flag_programs.h for the
+// opcodes). Designs are simplified to what reads at 128x80: emblems become a disc
+// or a star, Union Jack cantons share one shape. Territories that fly another
+// country's flag point at that program instead of carrying a copy.
+
+static const uint8_t FP_AD[] = {
+    FOP_VSTRIPES, 3, FC_BLUE, FC_YELLOW, FC_RED, FOP_CIRCLE, 16, 10, 2, FC_BROWN, FOP_END
+};
+
+static const uint8_t FP_AE[] = {
+    FOP_HSTRIPES, 3, FC_GREEN, FC_WHITE, FC_BLACK, FOP_RECT, 0, 0, 8, 20, FC_RED, FOP_END
+};
+
+static const uint8_t FP_AF[] = {
+    FOP_VSTRIPES, 3, FC_BLACK, FC_RED, FC_GREEN, FOP_CIRCLE, 16, 10, 3, FC_WHITE, FOP_END
+};
+
+static const uint8_t FP_AG[] = {
+    FOP_FILL, FC_RED, FOP_TRIANGLE, 0, 0, 32, 0, 16, 20, FC_BLACK, FOP_TRIANGLE, 5, 8, 27, 8, 16, 20, FC_BLUE,
+    FOP_TRIANGLE, 9, 12, 23, 12, 16, 20, FC_WHITE, FOP_STAR, 16, 6, 3, FC_YELLOW, FOP_END
+};
+
+static const uint8_t FP_AI[] = {
+    FOP_FILL, FC_NAVY, FOP_CANTON, 16, 10, FC_NAVY, FOP_RECT, 6, 0, 4, 10, FC_WHITE, FOP_RECT, 0, 3, 16, 4,
+    FC_WHITE, FOP_RECT, 7, 0, 2, 10, FC_RED, FOP_RECT, 0, 4, 16, 2, FC_RED, FOP_RECT, 21, 5, 6, 9, FC_WHITE,
+    FOP_CIRCLE, 24, 11, 2, FC_ORANGE, FOP_END
+};
+
+static const uint8_t FP_AL[] = {
+    FOP_FILL, FC_RED, FOP_TRIANGLE, 10, 4, 22, 4, 16, 16, FC_BLACK, FOP_CIRCLE, 16, 6, 2, FC_BLACK, FOP_END
+};
+
+static const uint8_t FP_AM[] = {
+    FOP_HSTRIPES, 3, FC_RED, FC_BLUE, FC_ORANGE, FOP_END
+};
+
+static const uint8_t FP_AO[] = {
+    FOP_HSTRIPES, 2, FC_RED, FC_BLACK, FOP_STAR, 16, 10, 3, FC_YELLOW, FOP_END
+};
+
+static const uint8_t FP_AQ[] = {
+    FOP_FILL, FC_BLUE, FOP_CIRCLE, 16, 10, 6, FC_WHITE, FOP_END
+};
+
+static const uint8_t FP_AR[] = {
+    FOP_HSTRIPES, 3, FC_SKY, FC_WHITE, FC_SKY, FOP_CIRCLE, 16, 10, 2, FC_YELLOW, FOP_END
+};
+
+static const uint8_t FP_AS[] = {
+    FOP_FILL, FC_NAVY, FOP_TRIANGLE, 32, 0, 32, 20, 4, 10, FC_WHITE, FOP_TRIANGLE, 32, 3, 32, 17, 10, 10,
+    FC_RED, FOP_CIRCLE, 22, 10, 2, FC_BROWN, FOP_END
+};
+
+static const uint8_t FP_AT[] = {
+    FOP_HSTRIPES, 3, FC_RED, FC_WHITE, FC_RED, FOP_END
+};
+
+static const uint8_t FP_AU[] = {
+    FOP_FILL, FC_NAVY, FOP_CANTON, 16, 10, FC_NAVY, FOP_RECT, 6, 0, 4, 10, FC_WHITE, FOP_RECT, 0, 3, 16, 4,
+    FC_WHITE, FOP_RECT, 7, 0, 2, 10, FC_RED, FOP_RECT, 0, 4, 16, 2, FC_RED, FOP_STAR, 8, 15, 3, FC_WHITE,
+    FOP_STAR, 24, 4, 1, FC_WHITE, FOP_STAR, 28, 9, 1, FC_WHITE, FOP_STAR, 21, 9, 1, FC_WHITE, FOP_STAR, 24, 16,
+    1, FC_WHITE, FOP_END
+};
+
+static const uint8_t FP_AW[] = {
+    FOP_FILL, FC_SKY, FOP_RECT, 0, 13, 32, 1, FC_YELLOW, FOP_RECT, 0, 15, 32, 1, FC_YELLOW, FOP_STAR, 6, 5, 2,
+    FC_RED, FOP_END
+};
+
+static const uint8_t FP_AX[] = {
+    FOP_FILL, FC_BLUE, FOP_CROSS, 11, 10, 4, FC_YELLOW, FOP_CROSS, 11, 10, 2, FC_RED, FOP_END
+};
+
+static const uint8_t FP_AZ[] = {
+    FOP_HSTRIPES, 3, FC_SKY, FC_RED, FC_GREEN, FOP_CIRCLE, 15, 10, 3, FC_WHITE, FOP_CIRCLE, 16, 10, 2, FC_RED,
+    FOP_STAR, 19, 10, 1, FC_WHITE, FOP_END
+};
+
+static const uint8_t FP_BA[] = {
+    FOP_FILL, FC_BLUE, FOP_TRIANGLE, 9, 0, 23, 0, 23, 20, FC_YELLOW, FOP_STAR, 7, 2, 1, FC_WHITE, FOP_STAR, 10,
+    6, 1, FC_WHITE, FOP_STAR, 13, 10, 1, FC_WHITE, FOP_STAR, 16, 14, 1, FC_WHITE, FOP_STAR, 19, 18, 1,
+    FC_WHITE, FOP_END
+};
+
+static const uint8_t FP_BB[] = {
+    FOP_VSTRIPES, 3, FC_NAVY, FC_YELLOW, FC_NAVY, FOP_RECT, 15, 5, 2, 10, FC_BLACK, FOP_RECT, 12, 7, 8, 1,
+    FC_BLACK, FOP_RECT, 12, 5, 1, 3, FC_BLACK, FOP_RECT, 19, 5, 1, 3, FC_BLACK, FOP_END
+};
+
+static const uint8_t FP_BD[] = {
+    FOP_FILL, FC_DARKGREEN, FOP_CIRCLE, 14, 10, 6, FC_RED, FOP_END
+};
+
+static const uint8_t FP_BE[] = {
+    FOP_VSTRIPES, 3, FC_BLACK, FC_YELLOW, FC_RED, FOP_END
+};
+
+static const uint8_t FP_BF[] = {
+    FOP_HSTRIPES, 2, FC_RED, FC_GREEN, FOP_STAR, 16, 10, 3, FC_YELLOW, FOP_END
+};
+
+static const uint8_t FP_BG[] = {
+    FOP_HSTRIPES, 3, FC_WHITE, FC_GREEN, FC_RED, FOP_END
+};
+
+static const uint8_t FP_BH[] = {
+    FOP_FILL, FC_RED, FOP_RECT, 0, 0, 9, 20, FC_WHITE, FOP_TRIANGLE, 9, 0, 12, 2, 9, 4, FC_WHITE, FOP_TRIANGLE,
+    9, 4, 12, 6, 9, 8, FC_WHITE, FOP_TRIANGLE, 9, 8, 12, 10, 9, 12, FC_WHITE, FOP_TRIANGLE, 9, 12, 12, 14, 9,
+    16, FC_WHITE, FOP_TRIANGLE, 9, 16, 12, 18, 9, 20, FC_WHITE, FOP_END
+};
+
+static const uint8_t FP_BI[] = {
+    FOP_FILL, FC_GREEN, FOP_TRIANGLE, 0, 0, 32, 0, 16, 10, FC_RED, FOP_TRIANGLE, 0, 20, 32, 20, 16, 10, FC_RED,
+    FOP_CIRCLE, 16, 10, 5, FC_WHITE, FOP_STAR, 16, 10, 1, FC_RED, FOP_END
+};
+
+static const uint8_t FP_BJ[] = {
+    FOP_FILL, FC_YELLOW, FOP_RECT, 0, 10, 32, 10, FC_RED, FOP_RECT, 0, 0, 12, 20, FC_GREEN, FOP_END
+};
+
+static const uint8_t FP_BM[] = {
+    FOP_FILL, FC_RED, FOP_CANTON, 16, 10, FC_NAVY, FOP_RECT, 6, 0, 4, 10, FC_WHITE, FOP_RECT, 0, 3, 16, 4,
+    FC_WHITE, FOP_RECT, 7, 0, 2, 10, FC_RED, FOP_RECT, 0, 4, 16, 2, FC_RED, FOP_CIRCLE, 24, 10, 3, FC_WHITE,
+    FOP_END
+};
+
+static const uint8_t FP_BN[] = {
+    FOP_FILL, FC_YELLOW, FOP_TRIANGLE, 0, 4, 32, 14, 32, 18, FC_WHITE, FOP_TRIANGLE, 0, 4, 32, 18, 0, 8,
+    FC_WHITE, FOP_TRIANGLE, 0, 8, 32, 18, 32, 20, FC_BLACK, FOP_TRIANGLE, 0, 8, 32, 20, 0, 11, FC_BLACK,
+    FOP_CIRCLE, 16, 10, 3, FC_RED, FOP_END
+};
+
+static const uint8_t FP_BO[] = {
+    FOP_HSTRIPES, 3, FC_RED, FC_YELLOW, FC_GREEN, FOP_END
+};
+
+static const uint8_t FP_BQ[] = {
+    FOP_FILL, FC_WHITE, FOP_TRIANGLE, 0, 0, 13, 0, 0, 8, FC_YELLOW, FOP_TRIANGLE, 32, 4, 32, 20, 6, 20,
+    FC_BLUE, FOP_STAR, 11, 9, 2, FC_RED, FOP_END
+};
+
+static const uint8_t FP_BR[] = {
+    FOP_FILL, FC_GREEN, FOP_TRIANGLE, 16, 2, 30, 10, 16, 18, FC_YELLOW, FOP_TRIANGLE, 16, 2, 2, 10, 16, 18,
+    FC_YELLOW, FOP_CIRCLE, 16, 10, 5, FC_NAVY, FOP_END
+};
+
+static const uint8_t FP_BS[] = {
+    FOP_HSTRIPES, 3, FC_TEAL, FC_YELLOW, FC_TEAL, FOP_TRIANGLE, 0, 0, 0, 20, 12, 10, FC_BLACK, FOP_END
+};
+
+static const uint8_t FP_BT[] = {
+    FOP_TRIANGLE, 0, 0, 32, 0, 0, 20, FC_YELLOW, FOP_TRIANGLE, 32, 0, 32, 20, 0, 20, FC_ORANGE, FOP_CIRCLE, 16,
+    10, 4, FC_WHITE, FOP_END
+};
+
+static const uint8_t FP_BW[] = {
+    FOP_FILL, FC_SKY, FOP_RECT, 0, 8, 32, 4, FC_WHITE, FOP_RECT, 0, 9, 32, 2, FC_BLACK, FOP_END
+};
+
+static const uint8_t FP_BY[] = {
+    FOP_FILL, FC_RED, FOP_RECT, 0, 13, 32, 7, FC_GREEN, FOP_RECT, 0, 0, 4, 20, FC_WHITE, FOP_RECT, 1, 0, 2, 20,
+    FC_RED, FOP_END
+};
+
+static const uint8_t FP_BZ[] = {
+    FOP_FILL, FC_BLUE, FOP_RECT, 0, 0, 32, 2, FC_RED, FOP_RECT, 0, 18, 32, 2, FC_RED, FOP_CIRCLE, 16, 10, 5,
+    FC_WHITE, FOP_END
+};
+
+static const uint8_t FP_CA[] = {
+    FOP_VSTRIPES, 4, FC_RED, FC_WHITE, FC_WHITE, FC_RED, FOP_STAR, 16, 10, 5, FC_RED, FOP_END
+};
+
+static const uint8_t FP_CC[] = {
+    FOP_FILL, FC_GREEN, FOP_CIRCLE, 8, 10, 4, FC_YELLOW, FOP_CIRCLE, 9, 10, 3, FC_GREEN, FOP_STAR, 24, 4, 1,
+    FC_YELLOW, FOP_STAR, 28, 9, 1, FC_YELLOW, FOP_STAR, 24, 16, 1, FC_YELLOW, FOP_STAR, 20, 10, 1, FC_YELLOW,
+    FOP_CIRCLE, 15, 5, 2, FC_YELLOW, FOP_END
+};
+
+static const uint8_t FP_CD[] = {
+    FOP_FILL, FC_SKY, FOP_TRIANGLE, 0, 11, 32, 0, 32, 9, FC_YELLOW, FOP_TRIANGLE, 0, 11, 32, 9, 0, 20,
+    FC_YELLOW, FOP_TRIANGLE, 0, 14, 32, 0, 32, 6, FC_RED, FOP_TRIANGLE, 0, 14, 32, 6, 0, 20, FC_RED, FOP_STAR,
+    5, 4, 3, FC_YELLOW, FOP_END
+};
+
+static const uint8_t FP_CF[] = {
+    FOP_HSTRIPES, 4, FC_BLUE, FC_WHITE, FC_GREEN, FC_YELLOW, FOP_RECT, 13, 0, 6, 20, FC_RED, FOP_STAR, 5, 2, 1,
+    FC_YELLOW, FOP_END
+};
+
+static const uint8_t FP_CG[] = {
+    FOP_FILL, FC_YELLOW, FOP_TRIANGLE, 0, 0, 24, 0, 0, 15, FC_GREEN, FOP_TRIANGLE, 32, 20, 8, 20, 32, 5,
+    FC_RED, FOP_END
+};
+
+static const uint8_t FP_CH[] = {
+    FOP_FILL, FC_RED, FOP_RECT, 14, 4, 4, 12, FC_WHITE, FOP_RECT, 10, 8, 12, 4, FC_WHITE, FOP_END
+};
+
+static const uint8_t FP_CI[] = {
+    FOP_VSTRIPES, 3, FC_ORANGE, FC_WHITE, FC_GREEN, FOP_END
+};
+
+static const uint8_t FP_CK[] = {
+    FOP_FILL, FC_NAVY, FOP_CANTON, 16, 10, FC_NAVY, FOP_RECT, 6, 0, 4, 10, FC_WHITE, FOP_RECT, 0, 3, 16, 4,
+    FC_WHITE, FOP_RECT, 7, 0, 2, 10, FC_RED, FOP_RECT, 0, 4, 16, 2, FC_RED, FOP_CIRCLE, 24, 10, 5, FC_WHITE,
+    FOP_CIRCLE, 24, 10, 4, FC_NAVY, FOP_END
+};
+
+static const uint8_t FP_CL[] = {
+    FOP_FILL, FC_WHITE, FOP_RECT, 0, 10, 32, 10, FC_RED, FOP_RECT, 0, 0, 11, 10, FC_BLUE, FOP_STAR, 5, 5, 3,
+    FC_WHITE, FOP_END
+};
+
+static const uint8_t FP_CM[] = {
+    FOP_VSTRIPES, 3, FC_GREEN, FC_RED, FC_YELLOW, FOP_STAR, 16, 10, 3, FC_YELLOW, FOP_END
+};
+
+static const uint8_t FP_CN[] = {
+    FOP_FILL, FC_RED, FOP_STAR, 6, 5, 3, FC_YELLOW, FOP_STAR, 11, 2, 1, FC_YELLOW, FOP_STAR, 13, 4, 1,
+    FC_YELLOW, FOP_STAR, 13, 7, 1, FC_YELLOW, FOP_STAR, 11, 9, 1, FC_YELLOW, FOP_END
+};
+
+static const uint8_t FP_CO[] = {
+    FOP_FILL, FC_YELLOW, FOP_RECT, 0, 10, 32, 5, FC_BLUE, FOP_RECT, 0, 15, 32, 5, FC_RED, FOP_END
+};
+
+static const uint8_t FP_CR[] = {
+    FOP_HSTRIPES, 6, FC_BLUE, FC_WHITE, FC_RED, FC_RED, FC_WHITE, FC_BLUE, FOP_END
+};
+
+static const uint8_t FP_CU[] = {
+    FOP_HSTRIPES, 5, FC_BLUE, FC_WHITE, FC_BLUE, FC_WHITE, FC_BLUE, FOP_TRIANGLE, 0, 0, 0, 20, 14, 10, FC_RED,
+    FOP_STAR, 5, 10, 2, FC_WHITE, FOP_END
+};
+
+static const uint8_t FP_CV[] = {
+    FOP_FILL, FC_BLUE, FOP_RECT, 0, 10, 32, 4, FC_WHITE, FOP_RECT, 0, 11, 32, 2, FC_RED, FOP_CIRCLE, 12, 12, 5,
+    FC_YELLOW, FOP_CIRCLE, 12, 12, 4, FC_BLUE, FOP_END
+};
+
+static const uint8_t FP_CW[] = {
+    FOP_FILL, FC_BLUE, FOP_RECT, 0, 13, 32, 2, FC_YELLOW, FOP_STAR, 4, 4, 2, FC_WHITE, FOP_STAR, 8, 7, 2,
+    FC_WHITE, FOP_END
+};
+
+static const uint8_t FP_CX[] = {
+    FOP_FILL, FC_BLUE, FOP_TRIANGLE, 0, 0, 32, 0, 32, 20, FC_GREEN, FOP_CIRCLE, 16, 10, 3, FC_YELLOW, FOP_STAR,
+    5, 12, 1, FC_WHITE, FOP_STAR, 9, 15, 1, FC_WHITE, FOP_STAR, 4, 17, 1, FC_WHITE, FOP_STAR, 25, 4, 2,
+    FC_YELLOW, FOP_END
+};
+
+static const uint8_t FP_CY[] = {
+    FOP_FILL, FC_WHITE, FOP_CIRCLE, 16, 9, 4, FC_ORANGE, FOP_RECT, 11, 15, 10, 1, FC_GREEN, FOP_END
+};
+
+static const uint8_t FP_CZ[] = {
+    FOP_HSTRIPES, 2, FC_WHITE, FC_RED, FOP_TRIANGLE, 0, 0, 0, 20, 16, 10, FC_BLUE, FOP_END
+};
+
+static const uint8_t FP_DE[] = {
+    FOP_HSTRIPES, 3, FC_BLACK, FC_RED, FC_YELLOW, FOP_END
+};
+
+static const uint8_t FP_DJ[] = {
+    FOP_HSTRIPES, 2, FC_SKY, FC_GREEN, FOP_TRIANGLE, 0, 0, 0, 20, 16, 10, FC_WHITE, FOP_STAR, 5, 10, 2, FC_RED,
+    FOP_END
+};
+
+static const uint8_t FP_DK[] = {
+    FOP_FILL, FC_RED, FOP_CROSS, 11, 10, 3, FC_WHITE, FOP_END
+};
+
+static const uint8_t FP_DM[] = {
+    FOP_FILL, FC_GREEN, FOP_CROSS, 16, 10, 4, FC_YELLOW, FOP_CROSS, 16, 10, 2, FC_BLACK, FOP_CIRCLE, 16, 10, 5,
+    FC_RED, FOP_STAR, 16, 10, 2, FC_GREEN, FOP_END
+};
+
+static const uint8_t FP_DO[] = {
+    FOP_FILL, FC_WHITE, FOP_RECT, 0, 0, 14, 8, FC_BLUE, FOP_RECT, 18, 0, 14, 8, FC_RED, FOP_RECT, 0, 12, 14, 8,
+    FC_RED, FOP_RECT, 18, 12, 14, 8, FC_BLUE, FOP_END
+};
+
+static const uint8_t FP_DZ[] = {
+    FOP_VSTRIPES, 2, FC_GREEN, FC_WHITE, FOP_CIRCLE, 16, 10, 5, FC_RED, FOP_CIRCLE, 18, 10, 4, FC_WHITE,
+    FOP_STAR, 19, 10, 2, FC_RED, FOP_END
+};
+
+static const uint8_t FP_EC[] = {
+    FOP_FILL, FC_YELLOW, FOP_RECT, 0, 10, 32, 5, FC_BLUE, FOP_RECT, 0, 15, 32, 5, FC_RED, FOP_CIRCLE, 16, 10,
+    3, FC_BROWN, FOP_END
+};
+
+static const uint8_t FP_EE[] = {
+    FOP_HSTRIPES, 3, FC_BLUE, FC_BLACK, FC_WHITE, FOP_END
+};
+
+static const uint8_t FP_EG[] = {
+    FOP_HSTRIPES, 3, FC_RED, FC_WHITE, FC_BLACK, FOP_CIRCLE, 16, 10, 2, FC_YELLOW, FOP_END
+};
+
+static const uint8_t FP_EH[] = {
+    FOP_HSTRIPES, 3, FC_BLACK, FC_WHITE, FC_GREEN, FOP_TRIANGLE, 0, 0, 0, 20, 11, 10, FC_RED, FOP_CIRCLE, 16,
+    10, 3, FC_RED, FOP_CIRCLE, 17, 10, 2, FC_WHITE, FOP_STAR, 18, 10, 1, FC_RED, FOP_END
+};
+
+static const uint8_t FP_ER[] = {
+    FOP_RECT, 0, 0, 32, 10, FC_GREEN, FOP_RECT, 0, 10, 32, 10, FC_BLUE, FOP_TRIANGLE, 0, 0, 32, 10, 0, 20,
+    FC_RED, FOP_CIRCLE, 7, 10, 3, FC_YELLOW, FOP_END
+};
+
+static const uint8_t FP_ES[] = {
+    FOP_FILL, FC_RED, FOP_RECT, 0, 5, 32, 10, FC_YELLOW, FOP_RECT, 7, 8, 3, 4, FC_RED, FOP_END
+};
+
+static const uint8_t FP_ET[] = {
+    FOP_HSTRIPES, 3, FC_GREEN, FC_YELLOW, FC_RED, FOP_CIRCLE, 16, 10, 4, FC_BLUE, FOP_STAR, 16, 10, 3,
+    FC_YELLOW, FOP_END
+};
+
+static const uint8_t FP_FI[] = {
+    FOP_FILL, FC_WHITE, FOP_CROSS, 11, 10, 4, FC_BLUE, FOP_END
+};
+
+static const uint8_t FP_FJ[] = {
+    FOP_FILL, FC_SKY, FOP_CANTON, 16, 10, FC_NAVY, FOP_RECT, 6, 0, 4, 10, FC_WHITE, FOP_RECT, 0, 3, 16, 4,
+    FC_WHITE, FOP_RECT, 7, 0, 2, 10, FC_RED, FOP_RECT, 0, 4, 16, 2, FC_RED, FOP_RECT, 21, 6, 6, 8, FC_WHITE,
+    FOP_RECT, 21, 6, 6, 2, FC_RED, FOP_END
+};
+
+static const uint8_t FP_FK[] = {
+    FOP_FILL, FC_NAVY, FOP_CANTON, 16, 10, FC_NAVY, FOP_RECT, 6, 0, 4, 10, FC_WHITE, FOP_RECT, 0, 3, 16, 4,
+    FC_WHITE, FOP_RECT, 7, 0, 2, 10, FC_RED, FOP_RECT, 0, 4, 16, 2, FC_RED, FOP_RECT, 21, 6, 6, 8, FC_WHITE,
+    FOP_RECT, 21, 11, 6, 3, FC_BLUE, FOP_END
+};
+
+static const uint8_t FP_FM[] = {
+    FOP_FILL, FC_SKY, FOP_STAR, 16, 4, 2, FC_WHITE, FOP_STAR, 11, 10, 2, FC_WHITE, FOP_STAR, 21, 10, 2,
+    FC_WHITE, FOP_STAR, 16, 16, 2, FC_WHITE, FOP_END
+};
+
+static const uint8_t FP_FO[] = {
+    FOP_FILL, FC_WHITE, FOP_CROSS, 11, 10, 4, FC_BLUE, FOP_CROSS, 11, 10, 2, FC_RED, FOP_END
+};
+
+static const uint8_t FP_FR[] = {
+    FOP_VSTRIPES, 3, FC_BLUE, FC_WHITE, FC_RED, FOP_END
+};
+
+static const uint8_t FP_GA[] = {
+    FOP_HSTRIPES, 3, FC_GREEN, FC_YELLOW, FC_BLUE, FOP_END
+};
+
+static const uint8_t FP_GB[] = {
+    FOP_FILL, FC_NAVY, FOP_TRIANGLE, 0, 0, 32, 15, 32, 20, FC_WHITE, FOP_TRIANGLE, 0, 0, 32, 20, 0, 5,
+    FC_WHITE, FOP_TRIANGLE, 0, 15, 32, 0, 32, 5, FC_WHITE, FOP_TRIANGLE, 0, 15, 32, 5, 0, 20, FC_WHITE,
+    FOP_CROSS, 16, 10, 6, FC_WHITE, FOP_CROSS, 16, 10, 4, FC_RED, FOP_END
+};
+
+static const uint8_t FP_GD[] = {
+    FOP_FILL, FC_RED, FOP_RECT, 3, 2, 26, 16, FC_YELLOW, FOP_TRIANGLE, 3, 2, 29, 2, 16, 10, FC_GREEN,
+    FOP_TRIANGLE, 3, 18, 29, 18, 16, 10, FC_GREEN, FOP_CIRCLE, 16, 10, 3, FC_RED, FOP_STAR, 16, 10, 2,
+    FC_YELLOW, FOP_END
+};
+
+static const uint8_t FP_GE[] = {
+    FOP_FILL, FC_WHITE, FOP_CROSS, 16, 10, 3, FC_RED, FOP_RECT, 6, 2, 2, 4, FC_RED, FOP_RECT, 5, 3, 4, 2,
+    FC_RED, FOP_RECT, 24, 2, 2, 4, FC_RED, FOP_RECT, 23, 3, 4, 2, FC_RED, FOP_RECT, 6, 14, 2, 4, FC_RED,
+    FOP_RECT, 5, 15, 4, 2, FC_RED, FOP_RECT, 24, 14, 2, 4, FC_RED, FOP_RECT, 23, 15, 4, 2, FC_RED, FOP_END
+};
+
+static const uint8_t FP_GF[] = {
+    FOP_FILL, FC_YELLOW, FOP_TRIANGLE, 0, 0, 32, 0, 0, 20, FC_GREEN, FOP_STAR, 16, 10, 3, FC_RED, FOP_END
+};
+
+static const uint8_t FP_GG[] = {
+    FOP_FILL, FC_WHITE, FOP_CROSS, 16, 10, 4, FC_RED, FOP_CROSS, 16, 10, 2, FC_YELLOW, FOP_END
+};
+
+static const uint8_t FP_GH[] = {
+    FOP_HSTRIPES, 3, FC_RED, FC_YELLOW, FC_GREEN, FOP_STAR, 16, 10, 3, FC_BLACK, FOP_END
+};
+
+static const uint8_t FP_GI[] = {
+    FOP_FILL, FC_WHITE, FOP_RECT, 0, 14, 32, 6, FC_RED, FOP_RECT, 11, 5, 10, 7, FC_RED, FOP_END
+};
+
+static const uint8_t FP_GL[] = {
+    FOP_HSTRIPES, 2, FC_WHITE, FC_RED, FOP_CIRCLE, 12, 10, 6, FC_RED, FOP_RECT, 6, 10, 12, 5, FC_WHITE,
+    FOP_END
+};
+
+static const uint8_t FP_GM[] = {
+    FOP_HSTRIPES, 3, FC_RED, FC_BLUE, FC_GREEN, FOP_RECT, 0, 6, 32, 1, FC_WHITE, FOP_RECT, 0, 13, 32, 1,
+    FC_WHITE, FOP_END
+};
+
+static const uint8_t FP_GN[] = {
+    FOP_VSTRIPES, 3, FC_RED, FC_YELLOW, FC_GREEN, FOP_END
+};
+
+static const uint8_t FP_GQ[] = {
+    FOP_HSTRIPES, 3, FC_GREEN, FC_WHITE, FC_RED, FOP_TRIANGLE, 0, 0, 0, 20, 8, 10, FC_BLUE, FOP_END
+};
+
+static const uint8_t FP_GR[] = {
+    FOP_HSTRIPES, 9, FC_BLUE, FC_WHITE, FC_BLUE, FC_WHITE, FC_BLUE, FC_WHITE, FC_BLUE, FC_WHITE, FC_BLUE,
+    FOP_CANTON, 12, 11, FC_BLUE, FOP_RECT, 5, 0, 2, 11, FC_WHITE, FOP_RECT, 0, 4, 12, 2, FC_WHITE, FOP_END
+};
+
+static const uint8_t FP_GS[] = {
+    FOP_FILL, FC_NAVY, FOP_CANTON, 16, 10, FC_NAVY, FOP_RECT, 6, 0, 4, 10, FC_WHITE, FOP_RECT, 0, 3, 16, 4,
+    FC_WHITE, FOP_RECT, 7, 0, 2, 10, FC_RED, FOP_RECT, 0, 4, 16, 2, FC_RED, FOP_CIRCLE, 24, 10, 4, FC_WHITE,
+    FOP_END
+};
+
+static const uint8_t FP_GT[] = {
+    FOP_VSTRIPES, 3, FC_SKY, FC_WHITE, FC_SKY, FOP_CIRCLE, 16, 10, 3, FC_GREEN, FOP_END
+};
+
+static const uint8_t FP_GU[] = {
+    FOP_FILL, FC_RED, FOP_RECT, 1, 1, 30, 18, FC_BLUE, FOP_CIRCLE, 16, 10, 5, FC_SKY, FOP_END
+};
+
+static const uint8_t FP_GW[] = {
+    FOP_HSTRIPES, 2, FC_YELLOW, FC_GREEN, FOP_RECT, 0, 0, 11, 20, FC_RED, FOP_STAR, 5, 10, 3, FC_BLACK,
+    FOP_END
+};
+
+static const uint8_t FP_GY[] = {
+    FOP_FILL, FC_GREEN, FOP_TRIANGLE, 0, 0, 32, 10, 0, 20, FC_WHITE, FOP_TRIANGLE, 0, 1, 30, 10, 0, 19,
+    FC_YELLOW, FOP_TRIANGLE, 0, 0, 16, 10, 0, 20, FC_BLACK, FOP_TRIANGLE, 0, 1, 14, 10, 0, 19, FC_RED, FOP_END
+};
+
+static const uint8_t FP_HK[] = {
+    FOP_FILL, FC_RED, FOP_STAR, 16, 10, 5, FC_WHITE, FOP_STAR, 16, 10, 2, FC_RED, FOP_END
+};
+
+static const uint8_t FP_HN[] = {
+    FOP_HSTRIPES, 3, FC_BLUE, FC_WHITE, FC_BLUE, FOP_STAR, 16, 10, 1, FC_BLUE, FOP_STAR, 12, 8, 1, FC_BLUE,
+    FOP_STAR, 20, 8, 1, FC_BLUE, FOP_STAR, 12, 12, 1, FC_BLUE, FOP_STAR, 20, 12, 1, FC_BLUE, FOP_END
+};
+
+static const uint8_t FP_HR[] = {
+    FOP_HSTRIPES, 3, FC_RED, FC_WHITE, FC_BLUE, FOP_RECT, 13, 5, 6, 8, FC_WHITE, FOP_RECT, 13, 5, 2, 2, FC_RED,
+    FOP_RECT, 17, 5, 2, 2, FC_RED, FOP_RECT, 15, 7, 2, 2, FC_RED, FOP_RECT, 13, 9, 2, 2, FC_RED, FOP_RECT, 17,
+    9, 2, 2, FC_RED, FOP_RECT, 15, 11, 2, 2, FC_RED, FOP_END
+};
+
+static const uint8_t FP_HT[] = {
+    FOP_HSTRIPES, 2, FC_BLUE, FC_RED, FOP_RECT, 12, 7, 8, 6, FC_WHITE, FOP_END
+};
+
+static const uint8_t FP_HU[] = {
+    FOP_HSTRIPES, 3, FC_RED, FC_WHITE, FC_GREEN, FOP_END
+};
+
+static const uint8_t FP_ID[] = {
+    FOP_HSTRIPES, 2, FC_RED, FC_WHITE, FOP_END
+};
+
+static const uint8_t FP_IE[] = {
+    FOP_VSTRIPES, 3, FC_GREEN, FC_WHITE, FC_ORANGE, FOP_END
+};
+
+static const uint8_t FP_IL[] = {
+    FOP_FILL, FC_WHITE, FOP_RECT, 0, 2, 32, 3, FC_BLUE, FOP_RECT, 0, 15, 32, 3, FC_BLUE, FOP_TRIANGLE, 16, 5,
+    20, 12, 12, 12, FC_BLUE, FOP_TRIANGLE, 16, 15, 12, 8, 20, 8, FC_BLUE, FOP_CIRCLE, 16, 10, 2, FC_WHITE,
+    FOP_END
+};
+
+static const uint8_t FP_IM[] = {
+    FOP_FILL, FC_RED, FOP_CIRCLE, 16, 10, 3, FC_WHITE, FOP_END
+};
+
+static const uint8_t FP_IN[] = {
+    FOP_HSTRIPES, 3, FC_SAFFRON, FC_WHITE, FC_GREEN, FOP_CIRCLE, 16, 10, 3, FC_NAVY, FOP_CIRCLE, 16, 10, 2,
+    FC_WHITE, FOP_END
+};
+
+static const uint8_t FP_IO[] = {
+    FOP_HSTRIPES, 12, FC_WHITE, FC_BLUE, FC_WHITE, FC_BLUE, FC_WHITE, FC_BLUE, FC_WHITE, FC_BLUE, FC_WHITE,
+    FC_BLUE, FC_WHITE, FC_BLUE, FOP_CANTON, 16, 10, FC_NAVY, FOP_RECT, 6, 0, 4, 10, FC_WHITE, FOP_RECT, 0, 3,
+    16, 4, FC_WHITE, FOP_RECT, 7, 0, 2, 10, FC_RED, FOP_RECT, 0, 4, 16, 2, FC_RED, FOP_RECT, 22, 6, 1, 12,
+    FC_GREEN, FOP_END
+};
+
+static const uint8_t FP_IQ[] = {
+    FOP_HSTRIPES, 3, FC_RED, FC_WHITE, FC_BLACK, FOP_RECT, 11, 9, 10, 2, FC_GREEN, FOP_END
+};
+
+static const uint8_t FP_IR[] = {
+    FOP_HSTRIPES, 3, FC_GREEN, FC_WHITE, FC_RED, FOP_CIRCLE, 16, 10, 2, FC_RED, FOP_END
+};
+
+static const uint8_t FP_IS[] = {
+    FOP_FILL, FC_BLUE, FOP_CROSS, 11, 10, 5, FC_WHITE, FOP_CROSS, 11, 10, 3, FC_RED, FOP_END
+};
+
+static const uint8_t FP_IT[] = {
+    FOP_VSTRIPES, 3, FC_GREEN, FC_WHITE, FC_RED, FOP_END
+};
+
+static const uint8_t FP_JE[] = {
+    FOP_FILL, FC_WHITE, FOP_TRIANGLE, 0, 0, 32, 17, 32, 20, FC_RED, FOP_TRIANGLE, 0, 0, 32, 20, 0, 3, FC_RED,
+    FOP_TRIANGLE, 0, 17, 32, 0, 32, 3, FC_RED, FOP_TRIANGLE, 0, 17, 32, 3, 0, 20, FC_RED, FOP_RECT, 14, 2, 4,
+    4, FC_RED, FOP_END
+};
+
+static const uint8_t FP_JM[] = {
+    FOP_FILL, FC_YELLOW, FOP_TRIANGLE, 2, 0, 30, 0, 16, 8, FC_GREEN, FOP_TRIANGLE, 2, 20, 30, 20, 16, 12,
+    FC_GREEN, FOP_TRIANGLE, 0, 2, 0, 18, 13, 10, FC_BLACK, FOP_TRIANGLE, 32, 2, 32, 18, 19, 10, FC_BLACK,
+    FOP_END
+};
+
+static const uint8_t FP_JO[] = {
+    FOP_HSTRIPES, 3, FC_BLACK, FC_WHITE, FC_GREEN, FOP_TRIANGLE, 0, 0, 0, 20, 14, 10, FC_RED, FOP_STAR, 5, 10,
+    1, FC_WHITE, FOP_END
+};
+
+static const uint8_t FP_JP[] = {
+    FOP_FILL, FC_WHITE, FOP_CIRCLE, 16, 10, 6, FC_RED, FOP_END
+};
+
+static const uint8_t FP_KE[] = {
+    FOP_HSTRIPES, 3, FC_BLACK, FC_RED, FC_GREEN, FOP_RECT, 0, 6, 32, 1, FC_WHITE, FOP_RECT, 0, 13, 32, 1,
+    FC_WHITE, FOP_RECT, 13, 3, 6, 14, FC_BLACK, FOP_RECT, 14, 5, 4, 10, FC_RED, FOP_END
+};
+
+static const uint8_t FP_KG[] = {
+    FOP_FILL, FC_RED, FOP_CIRCLE, 16, 10, 5, FC_YELLOW, FOP_CIRCLE, 16, 10, 3, FC_RED, FOP_CIRCLE, 16, 10, 2,
+    FC_YELLOW, FOP_END
+};
+
+static const uint8_t FP_KH[] = {
+    FOP_HSTRIPES, 4, FC_BLUE, FC_RED, FC_RED, FC_BLUE, FOP_RECT, 12, 6, 8, 8, FC_WHITE, FOP_END
+};
+
+static const uint8_t FP_KI[] = {
+    FOP_FILL, FC_RED, FOP_CIRCLE, 16, 11, 5, FC_YELLOW, FOP_RECT, 0, 11, 32, 9, FC_BLUE, FOP_RECT, 0, 13, 32,
+    1, FC_WHITE, FOP_RECT, 0, 16, 32, 1, FC_WHITE, FOP_END
+};
+
+static const uint8_t FP_KM[] = {
+    FOP_HSTRIPES, 4, FC_YELLOW, FC_WHITE, FC_RED, FC_BLUE, FOP_TRIANGLE, 0, 0, 0, 20, 14, 10, FC_GREEN,
+    FOP_CIRCLE, 5, 10, 3, FC_WHITE, FOP_CIRCLE, 6, 10, 2, FC_GREEN, FOP_END
+};
+
+static const uint8_t FP_KN[] = {
+    FOP_TRIANGLE, 0, 0, 32, 0, 0, 20, FC_GREEN, FOP_TRIANGLE, 32, 0, 32, 20, 0, 20, FC_RED, FOP_TRIANGLE, 0,
+    11, 32, 0, 32, 9, FC_YELLOW, FOP_TRIANGLE, 0, 11, 32, 9, 0, 20, FC_YELLOW, FOP_TRIANGLE, 0, 14, 32, 0, 32,
+    6, FC_BLACK, FOP_TRIANGLE, 0, 14, 32, 6, 0, 20, FC_BLACK, FOP_STAR, 12, 12, 1, FC_WHITE, FOP_STAR, 20, 8,
+    1, FC_WHITE, FOP_END
+};
+
+static const uint8_t FP_KP[] = {
+    FOP_FILL, FC_RED, FOP_RECT, 0, 0, 32, 3, FC_BLUE, FOP_RECT, 0, 17, 32, 3, FC_BLUE, FOP_RECT, 0, 4, 32, 1,
+    FC_WHITE, FOP_RECT, 0, 15, 32, 1, FC_WHITE, FOP_CIRCLE, 11, 10, 4, FC_WHITE, FOP_STAR, 11, 10, 4, FC_RED,
+    FOP_END
+};
+
+static const uint8_t FP_KR[] = {
+    FOP_FILL, FC_WHITE, FOP_CIRCLE, 16, 10, 5, FC_RED, FOP_CIRCLE, 16, 12, 3, FC_BLUE, FOP_RECT, 4, 3, 5, 3,
+    FC_BLACK, FOP_RECT, 23, 3, 5, 3, FC_BLACK, FOP_RECT, 4, 14, 5, 3, FC_BLACK, FOP_RECT, 23, 14, 5, 3,
+    FC_BLACK, FOP_END
+};
+
+static const uint8_t FP_KW[] = {
+    FOP_HSTRIPES, 3, FC_GREEN, FC_WHITE, FC_RED, FOP_RECT, 0, 7, 8, 6, FC_BLACK, FOP_TRIANGLE, 0, 0, 8, 7, 0,
+    7, FC_BLACK, FOP_TRIANGLE, 0, 20, 8, 13, 0, 13, FC_BLACK, FOP_END
+};
+
+static const uint8_t FP_KY[] = {
+    FOP_FILL, FC_NAVY, FOP_CANTON, 16, 10, FC_NAVY, FOP_RECT, 6, 0, 4, 10, FC_WHITE, FOP_RECT, 0, 3, 16, 4,
+    FC_WHITE, FOP_RECT, 7, 0, 2, 10, FC_RED, FOP_RECT, 0, 4, 16, 2, FC_RED, FOP_RECT, 22, 6, 5, 8, FC_WHITE,
+    FOP_RECT, 22, 6, 5, 2, FC_RED, FOP_END
+};
+
+static const uint8_t FP_KZ[] = {
+    FOP_FILL, FC_SKY, FOP_CIRCLE, 16, 9, 4, FC_YELLOW, FOP_RECT, 2, 2, 1, 16, FC_YELLOW, FOP_END
+};
+
+static const uint8_t FP_LA[] = {
+    FOP_HSTRIPES, 4, FC_RED, FC_BLUE, FC_BLUE, FC_RED, FOP_CIRCLE, 16, 10, 4, FC_WHITE, FOP_END
+};
+
+static const uint8_t FP_LB[] = {
+    FOP_FILL, FC_WHITE, FOP_RECT, 0, 0, 32, 5, FC_RED, FOP_RECT, 0, 15, 32, 5, FC_RED, FOP_TRIANGLE, 16, 6, 12,
+    14, 20, 14, FC_GREEN, FOP_END
+};
+
+static const uint8_t FP_LC[] = {
+    FOP_FILL, FC_SKY, FOP_TRIANGLE, 16, 3, 22, 17, 10, 17, FC_WHITE, FOP_TRIANGLE, 16, 5, 21, 17, 11, 17,
+    FC_BLACK, FOP_TRIANGLE, 16, 10, 22, 17, 10, 17, FC_YELLOW, FOP_END
+};
+
+static const uint8_t FP_LI[] = {
+    FOP_HSTRIPES, 2, FC_BLUE, FC_RED, FOP_CIRCLE, 7, 5, 2, FC_YELLOW, FOP_END
+};
+
+static const uint8_t FP_LK[] = {
+    FOP_FILL, FC_YELLOW, FOP_RECT, 1, 1, 3, 18, FC_GREEN, FOP_RECT, 4, 1, 3, 18, FC_ORANGE, FOP_RECT, 8, 1, 23,
+    18, FC_MAROON, FOP_CIRCLE, 19, 10, 4, FC_YELLOW, FOP_END
+};
+
+static const uint8_t FP_LR[] = {
+    FOP_HSTRIPES, 11, FC_RED, FC_WHITE, FC_RED, FC_WHITE, FC_RED, FC_WHITE, FC_RED, FC_WHITE, FC_RED, FC_WHITE,
+    FC_RED, FOP_CANTON, 9, 9, FC_BLUE, FOP_STAR, 4, 4, 2, FC_WHITE, FOP_END
+};
+
+static const uint8_t FP_LS[] = {
+    FOP_HSTRIPES, 3, FC_BLUE, FC_WHITE, FC_GREEN, FOP_TRIANGLE, 16, 6, 12, 13, 20, 13, FC_BLACK, FOP_END
+};
+
+static const uint8_t FP_LT[] = {
+    FOP_HSTRIPES, 3, FC_YELLOW, FC_GREEN, FC_RED, FOP_END
+};
+
+static const uint8_t FP_LU[] = {
+    FOP_HSTRIPES, 3, FC_RED, FC_WHITE, FC_SKY, FOP_END
+};
+
+static const uint8_t FP_LV[] = {
+    FOP_FILL, FC_MAROON, FOP_RECT, 0, 8, 32, 4, FC_WHITE, FOP_END
+};
+
+static const uint8_t FP_LY[] = {
+    FOP_HSTRIPES, 4, FC_RED, FC_BLACK, FC_BLACK, FC_GREEN, FOP_CIRCLE, 15, 10, 3, FC_WHITE, FOP_CIRCLE, 16, 10,
+    2, FC_BLACK, FOP_STAR, 19, 10, 1, FC_WHITE, FOP_END
+};
+
+static const uint8_t FP_MA[] = {
+    FOP_FILL, FC_RED, FOP_STAR, 16, 10, 5, FC_GREEN, FOP_END
+};
+
+static const uint8_t FP_MC[] = {
+    FOP_HSTRIPES, 2, FC_RED, FC_WHITE, FOP_END
+};
+
+static const uint8_t FP_MD[] = {
+    FOP_VSTRIPES, 3, FC_BLUE, FC_YELLOW, FC_RED, FOP_CIRCLE, 16, 10, 3, FC_BROWN, FOP_END
+};
+
+static const uint8_t FP_ME[] = {
+    FOP_FILL, FC_YELLOW, FOP_RECT, 1, 1, 30, 18, FC_RED, FOP_CIRCLE, 16, 10, 4, FC_YELLOW, FOP_END
+};
+
+static const uint8_t FP_MG[] = {
+    FOP_FILL, FC_RED, FOP_RECT, 0, 10, 32, 10, FC_GREEN, FOP_RECT, 0, 0, 11, 20, FC_WHITE, FOP_END
+};
+
+static const uint8_t FP_MH[] = {
+    FOP_FILL, FC_BLUE, FOP_TRIANGLE, 0, 14, 32, 0, 32, 6, FC_ORANGE, FOP_TRIANGLE, 0, 14, 32, 6, 0, 20,
+    FC_ORANGE, FOP_TRIANGLE, 0, 17, 32, 0, 32, 3, FC_WHITE, FOP_TRIANGLE, 0, 17, 32, 3, 0, 20, FC_WHITE,
+    FOP_STAR, 6, 5, 3, FC_WHITE, FOP_END
+};
+
+static const uint8_t FP_MK[] = {
+    FOP_FILL, FC_RED, FOP_TRIANGLE, 16, 10, 12, 0, 20, 0, FC_YELLOW, FOP_TRIANGLE, 16, 10, 12, 20, 20, 20,
+    FC_YELLOW, FOP_TRIANGLE, 16, 10, 0, 7, 0, 13, FC_YELLOW, FOP_TRIANGLE, 16, 10, 32, 7, 32, 13, FC_YELLOW,
+    FOP_TRIANGLE, 16, 10, 0, 0, 4, 0, FC_YELLOW, FOP_TRIANGLE, 16, 10, 28, 0, 32, 0, FC_YELLOW, FOP_TRIANGLE,
+    16, 10, 0, 20, 4, 20, FC_YELLOW, FOP_TRIANGLE, 16, 10, 28, 20, 32, 20, FC_YELLOW, FOP_CIRCLE, 16, 10, 3,
+    FC_YELLOW, FOP_END
+};
+
+static const uint8_t FP_ML[] = {
+    FOP_VSTRIPES, 3, FC_GREEN, FC_YELLOW, FC_RED, FOP_END
+};
+
+static const uint8_t FP_MM[] = {
+    FOP_HSTRIPES, 3, FC_YELLOW, FC_GREEN, FC_RED, FOP_STAR, 16, 11, 6, FC_WHITE, FOP_END
+};
+
+static const uint8_t FP_MN[] = {
+    FOP_VSTRIPES, 3, FC_RED, FC_BLUE, FC_RED, FOP_RECT, 3, 5, 3, 10, FC_YELLOW, FOP_END
+};
+
+static const uint8_t FP_MO[] = {
+    FOP_FILL, FC_GREEN, FOP_CIRCLE, 16, 12, 4, FC_WHITE, FOP_STAR, 16, 4, 2, FC_YELLOW, FOP_STAR, 11, 6, 1,
+    FC_YELLOW, FOP_STAR, 21, 6, 1, FC_YELLOW, FOP_STAR, 13, 8, 1, FC_YELLOW, FOP_STAR, 19, 8, 1, FC_YELLOW,
+    FOP_END
+};
+
+static const uint8_t FP_MP[] = {
+    FOP_FILL, FC_BLUE, FOP_CIRCLE, 16, 10, 6, FC_GREY, FOP_CIRCLE, 16, 10, 5, FC_BLUE, FOP_STAR, 16, 10, 4,
+    FC_WHITE, FOP_END
+};
+
+static const uint8_t FP_MQ[] = {
+    FOP_HSTRIPES, 2, FC_GREEN, FC_BLACK, FOP_TRIANGLE, 0, 0, 0, 20, 14, 10, FC_RED, FOP_END
+};
+
+static const uint8_t FP_MR[] = {
+    FOP_FILL, FC_GREEN, FOP_RECT, 0, 0, 32, 3, FC_RED, FOP_RECT, 0, 17, 32, 3, FC_RED, FOP_CIRCLE, 16, 9, 5,
+    FC_YELLOW, FOP_CIRCLE, 16, 7, 5, FC_GREEN, FOP_STAR, 16, 6, 2, FC_YELLOW, FOP_END
+};
+
+static const uint8_t FP_MS[] = {
+    FOP_FILL, FC_NAVY, FOP_CANTON, 16, 10, FC_NAVY, FOP_RECT, 6, 0, 4, 10, FC_WHITE, FOP_RECT, 0, 3, 16, 4,
+    FC_WHITE, FOP_RECT, 7, 0, 2, 10, FC_RED, FOP_RECT, 0, 4, 16, 2, FC_RED, FOP_RECT, 22, 6, 5, 8, FC_BLUE,
+    FOP_RECT, 22, 11, 5, 3, FC_GREEN, FOP_END
+};
+
+static const uint8_t FP_MT[] = {
+    FOP_VSTRIPES, 2, FC_WHITE, FC_RED, FOP_RECT, 3, 2, 4, 4, FC_GREY, FOP_END
+};
+
+static const uint8_t FP_MU[] = {
+    FOP_HSTRIPES, 4, FC_RED, FC_BLUE, FC_YELLOW, FC_GREEN, FOP_END
+};
+
+static const uint8_t FP_MV[] = {
+    FOP_FILL, FC_RED, FOP_RECT, 5, 4, 22, 12, FC_GREEN, FOP_CIRCLE, 16, 10, 4, FC_WHITE, FOP_CIRCLE, 17, 10, 3,
+    FC_GREEN, FOP_END
+};
+
+static const uint8_t FP_MW[] = {
+    FOP_HSTRIPES, 3, FC_BLACK, FC_RED, FC_GREEN, FOP_CIRCLE, 16, 7, 3, FC_RED, FOP_RECT, 0, 7, 32, 6, FC_RED,
+    FOP_END
+};
+
+static const uint8_t FP_MX[] = {
+    FOP_VSTRIPES, 3, FC_GREEN, FC_WHITE, FC_RED, FOP_CIRCLE, 16, 10, 3, FC_BROWN, FOP_END
+};
+
+static const uint8_t FP_MY[] = {
+    FOP_HSTRIPES, 14, FC_RED, FC_WHITE, FC_RED, FC_WHITE, FC_RED, FC_WHITE, FC_RED, FC_WHITE, FC_RED, FC_WHITE,
+    FC_RED, FC_WHITE, FC_RED, FC_WHITE, FOP_CANTON, 16, 11, FC_NAVY, FOP_CIRCLE, 6, 5, 3, FC_YELLOW,
+    FOP_CIRCLE, 7, 5, 2, FC_NAVY, FOP_STAR, 11, 5, 2, FC_YELLOW, FOP_END
+};
+
+static const uint8_t FP_MZ[] = {
+    FOP_HSTRIPES, 3, FC_GREEN, FC_BLACK, FC_YELLOW, FOP_RECT, 0, 6, 32, 1, FC_WHITE, FOP_RECT, 0, 13, 32, 1,
+    FC_WHITE, FOP_TRIANGLE, 0, 0, 0, 20, 14, 10, FC_RED, FOP_STAR, 5, 10, 3, FC_YELLOW, FOP_END
+};
+
+static const uint8_t FP_NA[] = {
+    FOP_FILL, FC_BLUE, FOP_TRIANGLE, 0, 20, 32, 0, 32, 20, FC_GREEN, FOP_TRIANGLE, 0, 11, 32, 0, 32, 9,
+    FC_WHITE, FOP_TRIANGLE, 0, 11, 32, 9, 0, 20, FC_WHITE, FOP_TRIANGLE, 0, 14, 32, 0, 32, 6, FC_RED,
+    FOP_TRIANGLE, 0, 14, 32, 6, 0, 20, FC_RED, FOP_STAR, 6, 5, 3, FC_YELLOW, FOP_END
+};
+
+static const uint8_t FP_NC[] = {
+    FOP_HSTRIPES, 3, FC_BLUE, FC_RED, FC_GREEN, FOP_CIRCLE, 11, 10, 6, FC_YELLOW, FOP_RECT, 10, 6, 2, 8,
+    FC_BLACK, FOP_END
+};
+
+static const uint8_t FP_NE[] = {
+    FOP_HSTRIPES, 3, FC_ORANGE, FC_WHITE, FC_GREEN, FOP_CIRCLE, 16, 10, 2, FC_ORANGE, FOP_END
+};
+
+static const uint8_t FP_NF[] = {
+    FOP_VSTRIPES, 3, FC_GREEN, FC_WHITE, FC_GREEN, FOP_TRIANGLE, 16, 4, 12, 16, 20, 16, FC_GREEN, FOP_END
+};
+
+static const uint8_t FP_NG[] = {
+    FOP_VSTRIPES, 3, FC_GREEN, FC_WHITE, FC_GREEN, FOP_END
+};
+
+static const uint8_t FP_NI[] = {
+    FOP_HSTRIPES, 3, FC_BLUE, FC_WHITE, FC_BLUE, FOP_CIRCLE, 16, 10, 2, FC_YELLOW, FOP_END
+};
+
+static const uint8_t FP_NL[] = {
+    FOP_HSTRIPES, 3, FC_RED, FC_WHITE, FC_BLUE, FOP_END
+};
+
+static const uint8_t FP_NO[] = {
+    FOP_FILL, FC_RED, FOP_CROSS, 11, 10, 4, FC_WHITE, FOP_CROSS, 11, 10, 2, FC_BLUE, FOP_END
+};
+
+static const uint8_t FP_NP[] = {
+    FOP_FILL, FC_WHITE, FOP_TRIANGLE, 1, 0, 22, 10, 1, 10, FC_BLUE, FOP_TRIANGLE, 1, 8, 22, 20, 1, 20, FC_BLUE,
+    FOP_TRIANGLE, 2, 2, 18, 9, 2, 9, FC_RED, FOP_TRIANGLE, 2, 10, 18, 19, 2, 19, FC_RED, FOP_CIRCLE, 6, 6, 1,
+    FC_WHITE, FOP_CIRCLE, 6, 15, 2, FC_WHITE, FOP_END
+};
+
+static const uint8_t FP_NR[] = {
+    FOP_FILL, FC_BLUE, FOP_RECT, 0, 9, 32, 2, FC_YELLOW, FOP_STAR, 8, 14, 3, FC_WHITE, FOP_END
+};
+
+static const uint8_t FP_NU[] = {
+    FOP_FILL, FC_YELLOW, FOP_CANTON, 16, 10, FC_NAVY, FOP_RECT, 6, 0, 4, 10, FC_WHITE, FOP_RECT, 0, 3, 16, 4,
+    FC_WHITE, FOP_RECT, 7, 0, 2, 10, FC_RED, FOP_RECT, 0, 4, 16, 2, FC_RED, FOP_STAR, 8, 5, 2, FC_WHITE,
+    FOP_END
+};
+
+static const uint8_t FP_NZ[] = {
+    FOP_FILL, FC_NAVY, FOP_CANTON, 16, 10, FC_NAVY, FOP_RECT, 6, 0, 4, 10, FC_WHITE, FOP_RECT, 0, 3, 16, 4,
+    FC_WHITE, FOP_RECT, 7, 0, 2, 10, FC_RED, FOP_RECT, 0, 4, 16, 2, FC_RED, FOP_STAR, 24, 5, 1, FC_RED,
+    FOP_STAR, 27, 10, 1, FC_RED, FOP_STAR, 21, 11, 1, FC_RED, FOP_STAR, 24, 15, 1, FC_RED, FOP_END
+};
+
+static const uint8_t FP_OM[] = {
+    FOP_HSTRIPES, 3, FC_WHITE, FC_RED, FC_GREEN, FOP_RECT, 0, 0, 9, 20, FC_RED, FOP_END
+};
+
+static const uint8_t FP_PA[] = {
+    FOP_FILL, FC_WHITE, FOP_RECT, 16, 0, 16, 10, FC_RED, FOP_RECT, 0, 10, 16, 10, FC_BLUE, FOP_STAR, 8, 5, 2,
+    FC_BLUE, FOP_STAR, 24, 15, 2, FC_RED, FOP_END
+};
+
+static const uint8_t FP_PE[] = {
+    FOP_VSTRIPES, 3, FC_RED, FC_WHITE, FC_RED, FOP_END
+};
+
+static const uint8_t FP_PF[] = {
+    FOP_FILL, FC_RED, FOP_RECT, 0, 5, 32, 10, FC_WHITE, FOP_CIRCLE, 16, 10, 3, FC_YELLOW, FOP_RECT, 13, 11, 6,
+    2, FC_BLUE, FOP_END
+};
+
+static const uint8_t FP_PG[] = {
+    FOP_TRIANGLE, 0, 0, 32, 0, 32, 20, FC_RED, FOP_TRIANGLE, 0, 0, 0, 20, 32, 20, FC_BLACK, FOP_STAR, 22, 6, 2,
+    FC_YELLOW, FOP_STAR, 6, 12, 1, FC_WHITE, FOP_STAR, 10, 15, 1, FC_WHITE, FOP_STAR, 4, 16, 1, FC_WHITE,
+    FOP_END
+};
+
+static const uint8_t FP_PH[] = {
+    FOP_HSTRIPES, 2, FC_BLUE, FC_RED, FOP_TRIANGLE, 0, 0, 0, 20, 16, 10, FC_WHITE, FOP_CIRCLE, 5, 10, 2,
+    FC_YELLOW, FOP_STAR, 2, 3, 1, FC_YELLOW, FOP_STAR, 2, 17, 1, FC_YELLOW, FOP_STAR, 12, 10, 1, FC_YELLOW,
+    FOP_END
+};
+
+static const uint8_t FP_PK[] = {
+    FOP_FILL, FC_DARKGREEN, FOP_RECT, 0, 0, 8, 20, FC_WHITE, FOP_CIRCLE, 20, 10, 6, FC_WHITE, FOP_CIRCLE, 22,
+    10, 5, FC_DARKGREEN, FOP_STAR, 23, 7, 2, FC_WHITE, FOP_END
+};
+
+static const uint8_t FP_PL[] = {
+    FOP_HSTRIPES, 2, FC_WHITE, FC_RED, FOP_END
+};
+
+static const uint8_t FP_PM[] = {
+    FOP_FILL, FC_SKY, FOP_RECT, 0, 14, 32, 6, FC_BLUE, FOP_RECT, 12, 6, 8, 6, FC_YELLOW, FOP_END
+};
+
+static const uint8_t FP_PN[] = {
+    FOP_FILL, FC_NAVY, FOP_CANTON, 16, 10, FC_NAVY, FOP_RECT, 6, 0, 4, 10, FC_WHITE, FOP_RECT, 0, 3, 16, 4,
+    FC_WHITE, FOP_RECT, 7, 0, 2, 10, FC_RED, FOP_RECT, 0, 4, 16, 2, FC_RED, FOP_RECT, 22, 5, 5, 9, FC_GREEN,
+    FOP_RECT, 22, 10, 5, 4, FC_BLUE, FOP_END
+};
+
+static const uint8_t FP_PR[] = {
+    FOP_HSTRIPES, 5, FC_RED, FC_WHITE, FC_RED, FC_WHITE, FC_RED, FOP_TRIANGLE, 0, 0, 0, 20, 16, 10, FC_BLUE,
+    FOP_STAR, 5, 10, 3, FC_WHITE, FOP_END
+};
+
+static const uint8_t FP_PS[] = {
+    FOP_HSTRIPES, 3, FC_BLACK, FC_WHITE, FC_GREEN, FOP_TRIANGLE, 0, 0, 0, 20, 12, 10, FC_RED, FOP_END
+};
+
+static const uint8_t FP_PT[] = {
+    FOP_FILL, FC_RED, FOP_RECT, 0, 0, 13, 20, FC_GREEN, FOP_CIRCLE, 13, 10, 5, FC_YELLOW, FOP_CIRCLE, 13, 10,
+    3, FC_WHITE, FOP_END
+};
+
+static const uint8_t FP_PW[] = {
+    FOP_FILL, FC_SKY, FOP_CIRCLE, 14, 10, 6, FC_YELLOW, FOP_END
+};
+
+static const uint8_t FP_PY[] = {
+    FOP_HSTRIPES, 3, FC_RED, FC_WHITE, FC_BLUE, FOP_CIRCLE, 16, 10, 2, FC_YELLOW, FOP_END
+};
+
+static const uint8_t FP_QA[] = {
+    FOP_FILL, FC_MAROON, FOP_RECT, 0, 0, 10, 20, FC_WHITE, FOP_TRIANGLE, 10, 0, 13, 1, 10, 2, FC_WHITE,
+    FOP_TRIANGLE, 10, 2, 13, 3, 10, 4, FC_WHITE, FOP_TRIANGLE, 10, 4, 13, 5, 10, 7, FC_WHITE, FOP_TRIANGLE, 10,
+    7, 13, 8, 10, 9, FC_WHITE, FOP_TRIANGLE, 10, 9, 13, 10, 10, 11, FC_WHITE, FOP_TRIANGLE, 10, 11, 13, 12, 10,
+    13, FC_WHITE, FOP_TRIANGLE, 10, 13, 13, 14, 10, 16, FC_WHITE, FOP_TRIANGLE, 10, 16, 13, 17, 10, 18,
+    FC_WHITE, FOP_TRIANGLE, 10, 18, 13, 19, 10, 20, FC_WHITE, FOP_END
+};
+
+static const uint8_t FP_RO[] = {
+    FOP_VSTRIPES, 3, FC_BLUE, FC_YELLOW, FC_RED, FOP_END
+};
+
+static const uint8_t FP_RS[] = {
+    FOP_HSTRIPES, 3, FC_RED, FC_BLUE, FC_WHITE, FOP_RECT, 7, 5, 6, 8, FC_RED, FOP_CIRCLE, 10, 7, 2, FC_WHITE,
+    FOP_END
+};
+
+static const uint8_t FP_RU[] = {
+    FOP_HSTRIPES, 3, FC_WHITE, FC_BLUE, FC_RED, FOP_END
+};
+
+static const uint8_t FP_RW[] = {
+    FOP_FILL, FC_SKY, FOP_RECT, 0, 10, 32, 5, FC_YELLOW, FOP_RECT, 0, 15, 32, 5, FC_GREEN, FOP_STAR, 26, 5, 3,
+    FC_YELLOW, FOP_END
+};
+
+static const uint8_t FP_SA[] = {
+    FOP_FILL, FC_DARKGREEN, FOP_RECT, 8, 6, 16, 3, FC_WHITE, FOP_RECT, 9, 12, 14, 1, FC_WHITE, FOP_END
+};
+
+static const uint8_t FP_SB[] = {
+    FOP_FILL, FC_BLUE, FOP_TRIANGLE, 0, 20, 32, 0, 32, 20, FC_GREEN, FOP_TRIANGLE, 0, 18, 32, 0, 32, 2,
+    FC_YELLOW, FOP_TRIANGLE, 0, 18, 32, 2, 0, 20, FC_YELLOW, FOP_STAR, 4, 3, 1, FC_WHITE, FOP_STAR, 8, 3, 1,
+    FC_WHITE, FOP_STAR, 6, 5, 1, FC_WHITE, FOP_STAR, 4, 7, 1, FC_WHITE, FOP_STAR, 8, 7, 1, FC_WHITE, FOP_END
+};
+
+static const uint8_t FP_SC[] = {
+    FOP_FILL, FC_GREEN, FOP_TRIANGLE, 0, 20, 0, 0, 10, 0, FC_BLUE, FOP_TRIANGLE, 0, 20, 10, 0, 21, 0,
+    FC_YELLOW, FOP_TRIANGLE, 0, 20, 21, 0, 32, 0, FC_RED, FOP_TRIANGLE, 0, 20, 32, 0, 32, 7, FC_RED,
+    FOP_TRIANGLE, 0, 20, 32, 7, 32, 14, FC_WHITE, FOP_END
+};
+
+static const uint8_t FP_SD[] = {
+    FOP_HSTRIPES, 3, FC_RED, FC_WHITE, FC_BLACK, FOP_TRIANGLE, 0, 0, 0, 20, 11, 10, FC_GREEN, FOP_END
+};
+
+static const uint8_t FP_SE[] = {
+    FOP_FILL, FC_BLUE, FOP_CROSS, 11, 10, 4, FC_YELLOW, FOP_END
+};
+
+static const uint8_t FP_SG[] = {
+    FOP_HSTRIPES, 2, FC_RED, FC_WHITE, FOP_CIRCLE, 7, 5, 3, FC_WHITE, FOP_CIRCLE, 8, 5, 2, FC_RED, FOP_STAR,
+    11, 5, 1, FC_WHITE, FOP_END
+};
+
+static const uint8_t FP_SH[] = {
+    FOP_FILL, FC_NAVY, FOP_CANTON, 16, 10, FC_NAVY, FOP_RECT, 6, 0, 4, 10, FC_WHITE, FOP_RECT, 0, 3, 16, 4,
+    FC_WHITE, FOP_RECT, 7, 0, 2, 10, FC_RED, FOP_RECT, 0, 4, 16, 2, FC_RED, FOP_RECT, 22, 5, 5, 9, FC_SKY,
+    FOP_RECT, 22, 5, 5, 3, FC_YELLOW, FOP_END
+};
+
+static const uint8_t FP_SI[] = {
+    FOP_HSTRIPES, 3, FC_WHITE, FC_BLUE, FC_RED, FOP_RECT, 7, 4, 6, 6, FC_BLUE, FOP_TRIANGLE, 7, 10, 13, 10, 10,
+    13, FC_BLUE, FOP_TRIANGLE, 8, 9, 12, 9, 10, 6, FC_WHITE, FOP_END
+};
+
+static const uint8_t FP_SK[] = {
+    FOP_HSTRIPES, 3, FC_WHITE, FC_BLUE, FC_RED, FOP_RECT, 7, 5, 7, 8, FC_WHITE, FOP_RECT, 8, 6, 5, 6, FC_RED,
+    FOP_TRIANGLE, 8, 12, 13, 12, 10, 15, FC_RED, FOP_RECT, 10, 7, 1, 4, FC_WHITE, FOP_RECT, 9, 8, 3, 1,
+    FC_WHITE, FOP_END
+};
+
+static const uint8_t FP_SL[] = {
+    FOP_HSTRIPES, 3, FC_LIGHTGREEN, FC_WHITE, FC_SKY, FOP_END
+};
+
+static const uint8_t FP_SM[] = {
+    FOP_HSTRIPES, 2, FC_WHITE, FC_SKY, FOP_CIRCLE, 16, 10, 3, FC_YELLOW, FOP_END
+};
+
+static const uint8_t FP_SN[] = {
+    FOP_VSTRIPES, 3, FC_GREEN, FC_YELLOW, FC_RED, FOP_STAR, 16, 10, 3, FC_GREEN, FOP_END
+};
+
+static const uint8_t FP_SO[] = {
+    FOP_FILL, FC_SKY, FOP_STAR, 16, 10, 5, FC_WHITE, FOP_END
+};
+
+static const uint8_t FP_SR[] = {
+    FOP_FILL, FC_RED, FOP_RECT, 0, 0, 32, 4, FC_GREEN, FOP_RECT, 0, 4, 32, 2, FC_WHITE, FOP_RECT, 0, 14, 32, 2,
+    FC_WHITE, FOP_RECT, 0, 16, 32, 4, FC_GREEN, FOP_STAR, 16, 10, 3, FC_YELLOW, FOP_END
+};
+
+static const uint8_t FP_SS[] = {
+    FOP_HSTRIPES, 3, FC_BLACK, FC_RED, FC_GREEN, FOP_RECT, 0, 6, 32, 1, FC_WHITE, FOP_RECT, 0, 13, 32, 1,
+    FC_WHITE, FOP_TRIANGLE, 0, 0, 0, 20, 14, 10, FC_BLUE, FOP_STAR, 5, 10, 3, FC_YELLOW, FOP_END
+};
+
+static const uint8_t FP_ST[] = {
+    FOP_FILL, FC_GREEN, FOP_RECT, 0, 6, 32, 8, FC_YELLOW, FOP_TRIANGLE, 0, 0, 0, 20, 9, 10, FC_RED, FOP_STAR,
+    15, 10, 2, FC_BLACK, FOP_STAR, 23, 10, 2, FC_BLACK, FOP_END
+};
+
+static const uint8_t FP_SV[] = {
+    FOP_HSTRIPES, 3, FC_BLUE, FC_WHITE, FC_BLUE, FOP_CIRCLE, 16, 10, 2, FC_YELLOW, FOP_END
+};
+
+static const uint8_t FP_SX[] = {
+    FOP_HSTRIPES, 2, FC_RED, FC_BLUE, FOP_TRIANGLE, 0, 0, 0, 20, 16, 10, FC_WHITE, FOP_CIRCLE, 6, 10, 3,
+    FC_YELLOW, FOP_END
+};
+
+static const uint8_t FP_SY[] = {
+    FOP_HSTRIPES, 3, FC_RED, FC_WHITE, FC_BLACK, FOP_STAR, 12, 10, 2, FC_GREEN, FOP_STAR, 20, 10, 2, FC_GREEN,
+    FOP_END
+};
+
+static const uint8_t FP_SZ[] = {
+    FOP_FILL, FC_BLUE, FOP_RECT, 0, 5, 32, 10, FC_YELLOW, FOP_RECT, 0, 6, 32, 8, FC_RED, FOP_RECT, 11, 7, 10,
+    6, FC_WHITE, FOP_RECT, 16, 7, 5, 6, FC_BLACK, FOP_END
+};
+
+static const uint8_t FP_TC[] = {
+    FOP_FILL, FC_NAVY, FOP_CANTON, 16, 10, FC_NAVY, FOP_RECT, 6, 0, 4, 10, FC_WHITE, FOP_RECT, 0, 3, 16, 4,
+    FC_WHITE, FOP_RECT, 7, 0, 2, 10, FC_RED, FOP_RECT, 0, 4, 16, 2, FC_RED, FOP_RECT, 22, 5, 5, 9, FC_YELLOW,
+    FOP_END
+};
+
+static const uint8_t FP_TD[] = {
+    FOP_VSTRIPES, 3, FC_NAVY, FC_YELLOW, FC_RED, FOP_END
+};
+
+static const uint8_t FP_TF[] = {
+    FOP_FILL, FC_NAVY, FOP_RECT, 0, 0, 4, 8, FC_NAVY, FOP_RECT, 4, 0, 4, 8, FC_WHITE, FOP_RECT, 8, 0, 4, 8,
+    FC_RED, FOP_STAR, 22, 12, 3, FC_WHITE, FOP_STAR, 26, 7, 1, FC_WHITE, FOP_END
+};
+
+static const uint8_t FP_TG[] = {
+    FOP_HSTRIPES, 5, FC_GREEN, FC_YELLOW, FC_GREEN, FC_YELLOW, FC_GREEN, FOP_CANTON, 12, 12, FC_RED, FOP_STAR,
+    6, 6, 3, FC_WHITE, FOP_END
+};
+
+static const uint8_t FP_TH[] = {
+    FOP_HSTRIPES, 6, FC_RED, FC_WHITE, FC_NAVY, FC_NAVY, FC_WHITE, FC_RED, FOP_END
+};
+
+static const uint8_t FP_TJ[] = {
+    FOP_FILL, FC_WHITE, FOP_RECT, 0, 0, 32, 6, FC_RED, FOP_RECT, 0, 14, 32, 6, FC_GREEN, FOP_CIRCLE, 16, 10, 2,
+    FC_YELLOW, FOP_END
+};
+
+static const uint8_t FP_TK[] = {
+    FOP_FILL, FC_BLUE, FOP_RECT, 8, 14, 16, 2, FC_YELLOW, FOP_STAR, 7, 5, 1, FC_WHITE, FOP_STAR, 10, 9, 1,
+    FC_WHITE, FOP_STAR, 5, 11, 1, FC_WHITE, FOP_STAR, 8, 2, 1, FC_WHITE, FOP_END
+};
+
+static const uint8_t FP_TL[] = {
+    FOP_FILL, FC_RED, FOP_TRIANGLE, 0, 0, 0, 20, 16, 10, FC_YELLOW, FOP_TRIANGLE, 0, 0, 0, 20, 11, 10,
+    FC_BLACK, FOP_STAR, 4, 10, 2, FC_WHITE, FOP_END
+};
+
+static const uint8_t FP_TM[] = {
+    FOP_FILL, FC_GREEN, FOP_RECT, 4, 0, 5, 20, FC_MAROON, FOP_CIRCLE, 14, 5, 3, FC_WHITE, FOP_CIRCLE, 15, 5, 2,
+    FC_GREEN, FOP_END
+};
+
+static const uint8_t FP_TN[] = {
+    FOP_FILL, FC_RED, FOP_CIRCLE, 16, 10, 5, FC_WHITE, FOP_CIRCLE, 16, 10, 4, FC_RED, FOP_CIRCLE, 17, 10, 3,
+    FC_WHITE, FOP_STAR, 17, 10, 2, FC_RED, FOP_END
+};
+
+static const uint8_t FP_TO[] = {
+    FOP_FILL, FC_RED, FOP_CANTON, 13, 9, FC_WHITE, FOP_RECT, 5, 1, 3, 7, FC_RED, FOP_RECT, 3, 3, 7, 3, FC_RED,
+    FOP_END
+};
+
+static const uint8_t FP_TR[] = {
+    FOP_FILL, FC_RED, FOP_CIRCLE, 12, 10, 5, FC_WHITE, FOP_CIRCLE, 13, 10, 4, FC_RED, FOP_STAR, 18, 10, 2,
+    FC_WHITE, FOP_END
+};
+
+static const uint8_t FP_TT[] = {
+    FOP_FILL, FC_RED, FOP_TRIANGLE, 0, 0, 32, 10, 32, 20, FC_WHITE, FOP_TRIANGLE, 0, 0, 32, 20, 0, 10,
+    FC_WHITE, FOP_TRIANGLE, 0, 0, 32, 13, 32, 20, FC_BLACK, FOP_TRIANGLE, 0, 0, 32, 20, 0, 7, FC_BLACK,
+    FOP_END
+};
+
+static const uint8_t FP_TV[] = {
+    FOP_FILL, FC_SKY, FOP_CANTON, 16, 10, FC_NAVY, FOP_RECT, 6, 0, 4, 10, FC_WHITE, FOP_RECT, 0, 3, 16, 4,
+    FC_WHITE, FOP_RECT, 7, 0, 2, 10, FC_RED, FOP_RECT, 0, 4, 16, 2, FC_RED, FOP_STAR, 22, 5, 1, FC_YELLOW,
+    FOP_STAR, 26, 8, 1, FC_YELLOW, FOP_STAR, 24, 13, 1, FC_YELLOW, FOP_STAR, 28, 16, 1, FC_YELLOW, FOP_STAR,
+    20, 16, 1, FC_YELLOW, FOP_END
+};
+
+static const uint8_t FP_TW[] = {
+    FOP_FILL, FC_RED, FOP_CANTON, 16, 10, FC_BLUE, FOP_STAR, 8, 5, 4, FC_WHITE, FOP_CIRCLE, 8, 5, 2, FC_BLUE,
+    FOP_CIRCLE, 8, 5, 1, FC_WHITE, FOP_END
+};
+
+static const uint8_t FP_TZ[] = {
+    FOP_TRIANGLE, 0, 0, 32, 0, 0, 20, FC_GREEN, FOP_TRIANGLE, 32, 0, 32, 20, 0, 20, FC_SKY, FOP_TRIANGLE, 0,
+    11, 32, 0, 32, 9, FC_YELLOW, FOP_TRIANGLE, 0, 11, 32, 9, 0, 20, FC_YELLOW, FOP_TRIANGLE, 0, 14, 32, 0, 32,
+    6, FC_BLACK, FOP_TRIANGLE, 0, 14, 32, 6, 0, 20, FC_BLACK, FOP_END
+};
+
+static const uint8_t FP_UA[] = {
+    FOP_HSTRIPES, 2, FC_BLUE, FC_YELLOW, FOP_END
+};
+
+static const uint8_t FP_UG[] = {
+    FOP_HSTRIPES, 6, FC_BLACK, FC_YELLOW, FC_RED, FC_BLACK, FC_YELLOW, FC_RED, FOP_CIRCLE, 16, 10, 4, FC_WHITE,
+    FOP_END
+};
+
+static const uint8_t FP_US[] = {
+    FOP_HSTRIPES, 13, FC_RED, FC_WHITE, FC_RED, FC_WHITE, FC_RED, FC_WHITE, FC_RED, FC_WHITE, FC_RED, FC_WHITE,
+    FC_RED, FC_WHITE, FC_RED, FOP_CANTON, 13, 11, FC_NAVY, FOP_STAR, 3, 3, 1, FC_WHITE, FOP_STAR, 9, 3, 1,
+    FC_WHITE, FOP_STAR, 6, 6, 1, FC_WHITE, FOP_STAR, 3, 9, 1, FC_WHITE, FOP_STAR, 9, 9, 1, FC_WHITE, FOP_END
+};
+
+static const uint8_t FP_UY[] = {
+    FOP_HSTRIPES, 9, FC_WHITE, FC_BLUE, FC_WHITE, FC_BLUE, FC_WHITE, FC_BLUE, FC_WHITE, FC_BLUE, FC_WHITE,
+    FOP_CANTON, 11, 11, FC_WHITE, FOP_STAR, 5, 5, 3, FC_YELLOW, FOP_CIRCLE, 5, 5, 2, FC_YELLOW, FOP_END
+};
+
+static const uint8_t FP_UZ[] = {
+    FOP_HSTRIPES, 3, FC_TEAL, FC_WHITE, FC_GREEN, FOP_RECT, 0, 6, 32, 1, FC_RED, FOP_RECT, 0, 13, 32, 1,
+    FC_RED, FOP_CIRCLE, 6, 3, 2, FC_WHITE, FOP_CIRCLE, 7, 3, 1, FC_TEAL, FOP_END
+};
+
+static const uint8_t FP_VA[] = {
+    FOP_VSTRIPES, 2, FC_YELLOW, FC_WHITE, FOP_RECT, 22, 8, 4, 4, FC_YELLOW, FOP_END
+};
+
+static const uint8_t FP_VC[] = {
+    FOP_FILL, FC_YELLOW, FOP_RECT, 0, 0, 8, 20, FC_BLUE, FOP_RECT, 24, 0, 8, 20, FC_GREEN, FOP_TRIANGLE, 16, 5,
+    13, 9, 19, 9, FC_GREEN, FOP_TRIANGLE, 13, 9, 19, 9, 16, 13, FC_GREEN, FOP_END
+};
+
+static const uint8_t FP_VE[] = {
+    FOP_HSTRIPES, 3, FC_YELLOW, FC_BLUE, FC_RED, FOP_STAR, 10, 10, 1, FC_WHITE, FOP_STAR, 13, 8, 1, FC_WHITE,
+    FOP_STAR, 16, 7, 1, FC_WHITE, FOP_STAR, 19, 8, 1, FC_WHITE, FOP_STAR, 22, 10, 1, FC_WHITE, FOP_END
+};
+
+static const uint8_t FP_VG[] = {
+    FOP_FILL, FC_NAVY, FOP_CANTON, 16, 10, FC_NAVY, FOP_RECT, 6, 0, 4, 10, FC_WHITE, FOP_RECT, 0, 3, 16, 4,
+    FC_WHITE, FOP_RECT, 7, 0, 2, 10, FC_RED, FOP_RECT, 0, 4, 16, 2, FC_RED, FOP_RECT, 22, 5, 5, 9, FC_GREEN,
+    FOP_END
+};
+
+static const uint8_t FP_VI[] = {
+    FOP_FILL, FC_WHITE, FOP_CIRCLE, 16, 10, 4, FC_YELLOW, FOP_RECT, 14, 8, 4, 5, FC_BLUE, FOP_END
+};
+
+static const uint8_t FP_VN[] = {
+    FOP_FILL, FC_RED, FOP_STAR, 16, 10, 6, FC_YELLOW, FOP_END
+};
+
+static const uint8_t FP_VU[] = {
+    FOP_HSTRIPES, 2, FC_RED, FC_GREEN, FOP_RECT, 0, 8, 32, 4, FC_YELLOW, FOP_RECT, 0, 9, 32, 2, FC_BLACK,
+    FOP_TRIANGLE, 0, 0, 0, 20, 15, 10, FC_YELLOW, FOP_TRIANGLE, 0, 2, 0, 18, 12, 10, FC_BLACK, FOP_CIRCLE, 5,
+    10, 2, FC_YELLOW, FOP_END
+};
+
+static const uint8_t FP_WF[] = {
+    FOP_FILL, FC_RED, FOP_CANTON, 12, 8, FC_WHITE, FOP_RECT, 0, 0, 4, 7, FC_BLUE, FOP_RECT, 8, 0, 4, 7, FC_RED,
+    FOP_TRIANGLE, 20, 6, 28, 14, 26, 14, FC_WHITE, FOP_TRIANGLE, 20, 14, 28, 6, 26, 6, FC_WHITE, FOP_END
+};
+
+static const uint8_t FP_WS[] = {
+    FOP_FILL, FC_RED, FOP_CANTON, 16, 10, FC_BLUE, FOP_STAR, 8, 3, 1, FC_WHITE, FOP_STAR, 5, 5, 1, FC_WHITE,
+    FOP_STAR, 11, 5, 1, FC_WHITE, FOP_STAR, 8, 8, 1, FC_WHITE, FOP_END
+};
+
+static const uint8_t FP_XK[] = {
+    FOP_FILL, FC_BLUE, FOP_RECT, 12, 7, 8, 7, FC_YELLOW, FOP_STAR, 9, 4, 1, FC_WHITE, FOP_STAR, 13, 3, 1,
+    FC_WHITE, FOP_STAR, 17, 3, 1, FC_WHITE, FOP_STAR, 21, 3, 1, FC_WHITE, FOP_STAR, 25, 4, 1, FC_WHITE,
+    FOP_END
+};
+
+static const uint8_t FP_YE[] = {
+    FOP_HSTRIPES, 3, FC_RED, FC_WHITE, FC_BLACK, FOP_END
+};
+
+static const uint8_t FP_ZA[] = {
+    FOP_FILL, FC_WHITE, FOP_RECT, 0, 0, 32, 7, FC_RED, FOP_RECT, 0, 13, 32, 7, FC_BLUE, FOP_RECT, 0, 8, 32, 4,
+    FC_GREEN, FOP_TRIANGLE, 0, 2, 12, 10, 0, 18, FC_YELLOW, FOP_TRIANGLE, 0, 4, 9, 10, 0, 16, FC_BLACK,
+    FOP_END
+};
+
+static const uint8_t FP_ZM[] = {
+    FOP_FILL, FC_GREEN, FOP_RECT, 20, 8, 4, 12, FC_RED, FOP_RECT, 24, 8, 4, 12, FC_BLACK, FOP_RECT, 28, 8, 4,
+    12, FC_ORANGE, FOP_CIRCLE, 26, 4, 2, FC_ORANGE, FOP_END
+};
+
+static const uint8_t FP_ZW[] = {
+    FOP_HSTRIPES, 7, FC_GREEN, FC_YELLOW, FC_RED, FC_BLACK, FC_RED, FC_YELLOW, FC_GREEN, FOP_TRIANGLE, 0, 0, 0,
+    20, 14, 10, FC_BLACK, FOP_TRIANGLE, 0, 1, 0, 19, 12, 10, FC_WHITE, FOP_STAR, 5, 10, 2, FC_RED, FOP_END
+};
+
+// --- LOOKUP TABLE (sorted by code for binary search) ---
+
+const FlagProgram FLAG_PROGRAMS[] = {
+    {"AD", FP_AD, sizeof(FP_AD)},
+    {"AE", FP_AE, sizeof(FP_AE)},
+    {"AF", FP_AF, sizeof(FP_AF)},
+    {"AG", FP_AG, sizeof(FP_AG)},
+    {"AI", FP_AI, sizeof(FP_AI)},
+    {"AL", FP_AL, sizeof(FP_AL)},
+    {"AM", FP_AM, sizeof(FP_AM)},
+    {"AO", FP_AO, sizeof(FP_AO)},
+    {"AQ", FP_AQ, sizeof(FP_AQ)},
+    {"AR", FP_AR, sizeof(FP_AR)},
+    {"AS", FP_AS, sizeof(FP_AS)},
+    {"AT", FP_AT, sizeof(FP_AT)},
+    {"AU", FP_AU, sizeof(FP_AU)},
+    {"AW", FP_AW, sizeof(FP_AW)},
+    {"AX", FP_AX, sizeof(FP_AX)},
+    {"AZ", FP_AZ, sizeof(FP_AZ)},
+    {"BA", FP_BA, sizeof(FP_BA)},
+    {"BB", FP_BB, sizeof(FP_BB)},
+    {"BD", FP_BD, sizeof(FP_BD)},
+    {"BE", FP_BE, sizeof(FP_BE)},
+    {"BF", FP_BF, sizeof(FP_BF)},
+    {"BG", FP_BG, sizeof(FP_BG)},
+    {"BH", FP_BH, sizeof(FP_BH)},
+    {"BI", FP_BI, sizeof(FP_BI)},
+    {"BJ", FP_BJ, sizeof(FP_BJ)},
+    {"BL", FP_FR, sizeof(FP_FR)},
+    {"BM", FP_BM, sizeof(FP_BM)},
+    {"BN", FP_BN, sizeof(FP_BN)},
+    {"BO", FP_BO, sizeof(FP_BO)},
+    {"BQ", FP_BQ, sizeof(FP_BQ)},
+    {"BR", FP_BR, sizeof(FP_BR)},
+    {"BS", FP_BS, sizeof(FP_BS)},
+    {"BT", FP_BT, sizeof(FP_BT)},
+    {"BV", FP_NO, sizeof(FP_NO)},
+    {"BW", FP_BW, sizeof(FP_BW)},
+    {"BY", FP_BY, sizeof(FP_BY)},
+    {"BZ", FP_BZ, sizeof(FP_BZ)},
+    {"CA", FP_CA, sizeof(FP_CA)},
+    {"CC", FP_CC, sizeof(FP_CC)},
+    {"CD", FP_CD, sizeof(FP_CD)},
+    {"CF", FP_CF, sizeof(FP_CF)},
+    {"CG", FP_CG, sizeof(FP_CG)},
+    {"CH", FP_CH, sizeof(FP_CH)},
+    {"CI", FP_CI, sizeof(FP_CI)},
+    {"CK", FP_CK, sizeof(FP_CK)},
+    {"CL", FP_CL, sizeof(FP_CL)},
+    {"CM", FP_CM, sizeof(FP_CM)},
+    {"CN", FP_CN, sizeof(FP_CN)},
+    {"CO", FP_CO, sizeof(FP_CO)},
+    {"CR", FP_CR, sizeof(FP_CR)},
+    {"CU", FP_CU, sizeof(FP_CU)},
+    {"CV", FP_CV, sizeof(FP_CV)},
+    {"CW", FP_CW, sizeof(FP_CW)},
+    {"CX", FP_CX, sizeof(FP_CX)},
+    {"CY", FP_CY, sizeof(FP_CY)},
+    {"CZ", FP_CZ, sizeof(FP_CZ)},
+    {"DE", FP_DE, sizeof(FP_DE)},
+    {"DJ", FP_DJ, sizeof(FP_DJ)},
+    {"DK", FP_DK, sizeof(FP_DK)},
+    {"DM", FP_DM, sizeof(FP_DM)},
+    {"DO", FP_DO, sizeof(FP_DO)},
+    {"DZ", FP_DZ, sizeof(FP_DZ)},
+    {"EC", FP_EC, sizeof(FP_EC)},
+    {"EE", FP_EE, sizeof(FP_EE)},
+    {"EG", FP_EG, sizeof(FP_EG)},
+    {"EH", FP_EH, sizeof(FP_EH)},
+    {"ER", FP_ER, sizeof(FP_ER)},
+    {"ES", FP_ES, sizeof(FP_ES)},
+    {"ET", FP_ET, sizeof(FP_ET)},
+    {"FI", FP_FI, sizeof(FP_FI)},
+    {"FJ", FP_FJ, sizeof(FP_FJ)},
+    {"FK", FP_FK, sizeof(FP_FK)},
+    {"FM", FP_FM, sizeof(FP_FM)},
+    {"FO", FP_FO, sizeof(FP_FO)},
+    {"FR", FP_FR, sizeof(FP_FR)},
+    {"GA", FP_GA, sizeof(FP_GA)},
+    {"GB", FP_GB, sizeof(FP_GB)},
+    {"GD", FP_GD, sizeof(FP_GD)},
+    {"GE", FP_GE, sizeof(FP_GE)},
+    {"GF", FP_GF, sizeof(FP_GF)},
+    {"GG", FP_GG, sizeof(FP_GG)},
+    {"GH", FP_GH, sizeof(FP_GH)},
+    {"GI", FP_GI, sizeof(FP_GI)},
+    {"GL", FP_GL, sizeof(FP_GL)},
+    {"GM", FP_GM, sizeof(FP_GM)},
+    {"GN", FP_GN, sizeof(FP_GN)},
+    {"GP", FP_FR, sizeof(FP_FR)},
+    {"GQ", FP_GQ, sizeof(FP_GQ)},
+    {"GR", FP_GR, sizeof(FP_GR)},
+    {"GS", FP_GS, sizeof(FP_GS)},
+    {"GT", FP_GT, sizeof(FP_GT)},
+    {"GU", FP_GU, sizeof(FP_GU)},
+    {"GW", FP_GW, sizeof(FP_GW)},
+    {"GY", FP_GY, sizeof(FP_GY)},
+    {"HK", FP_HK, sizeof(FP_HK)},
+    {"HM", FP_AU, sizeof(FP_AU)},
+    {"HN", FP_HN, sizeof(FP_HN)},
+    {"HR", FP_HR, sizeof(FP_HR)},
+    {"HT", FP_HT, sizeof(FP_HT)},
+    {"HU", FP_HU, sizeof(FP_HU)},
+    {"ID", FP_ID, sizeof(FP_ID)},
+    {"IE", FP_IE, sizeof(FP_IE)},
+    {"IL", FP_IL, sizeof(FP_IL)},
+    {"IM", FP_IM, sizeof(FP_IM)},
+    {"IN", FP_IN, sizeof(FP_IN)},
+    {"IO", FP_IO, sizeof(FP_IO)},
+    {"IQ", FP_IQ, sizeof(FP_IQ)},
+    {"IR", FP_IR, sizeof(FP_IR)},
+    {"IS", FP_IS, sizeof(FP_IS)},
+    {"IT", FP_IT, sizeof(FP_IT)},
+    {"JE", FP_JE, sizeof(FP_JE)},
+    {"JM", FP_JM, sizeof(FP_JM)},
+    {"JO", FP_JO, sizeof(FP_JO)},
+    {"JP", FP_JP, sizeof(FP_JP)},
+    {"KE", FP_KE, sizeof(FP_KE)},
+    {"KG", FP_KG, sizeof(FP_KG)},
+    {"KH", FP_KH, sizeof(FP_KH)},
+    {"KI", FP_KI, sizeof(FP_KI)},
+    {"KM", FP_KM, sizeof(FP_KM)},
+    {"KN", FP_KN, sizeof(FP_KN)},
+    {"KP", FP_KP, sizeof(FP_KP)},
+    {"KR", FP_KR, sizeof(FP_KR)},
+    {"KW", FP_KW, sizeof(FP_KW)},
+    {"KY", FP_KY, sizeof(FP_KY)},
+    {"KZ", FP_KZ, sizeof(FP_KZ)},
+    {"LA", FP_LA, sizeof(FP_LA)},
+    {"LB", FP_LB, sizeof(FP_LB)},
+    {"LC", FP_LC, sizeof(FP_LC)},
+    {"LI", FP_LI, sizeof(FP_LI)},
+    {"LK", FP_LK, sizeof(FP_LK)},
+    {"LR", FP_LR, sizeof(FP_LR)},
+    {"LS", FP_LS, sizeof(FP_LS)},
+    {"LT", FP_LT, sizeof(FP_LT)},
+    {"LU", FP_LU, sizeof(FP_LU)},
+    {"LV", FP_LV, sizeof(FP_LV)},
+    {"LY", FP_LY, sizeof(FP_LY)},
+    {"MA", FP_MA, sizeof(FP_MA)},
+    {"MC", FP_MC, sizeof(FP_MC)},
+    {"MD", FP_MD, sizeof(FP_MD)},
+    {"ME", FP_ME, sizeof(FP_ME)},
+    {"MF", FP_FR, sizeof(FP_FR)},
+    {"MG", FP_MG, sizeof(FP_MG)},
+    {"MH", FP_MH, sizeof(FP_MH)},
+    {"MK", FP_MK, sizeof(FP_MK)},
+    {"ML", FP_ML, sizeof(FP_ML)},
+    {"MM", FP_MM, sizeof(FP_MM)},
+    {"MN", FP_MN, sizeof(FP_MN)},
+    {"MO", FP_MO, sizeof(FP_MO)},
+    {"MP", FP_MP, sizeof(FP_MP)},
+    {"MQ", FP_MQ, sizeof(FP_MQ)},
+    {"MR", FP_MR, sizeof(FP_MR)},
+    {"MS", FP_MS, sizeof(FP_MS)},
+    {"MT", FP_MT, sizeof(FP_MT)},
+    {"MU", FP_MU, sizeof(FP_MU)},
+    {"MV", FP_MV, sizeof(FP_MV)},
+    {"MW", FP_MW, sizeof(FP_MW)},
+    {"MX", FP_MX, sizeof(FP_MX)},
+    {"MY", FP_MY, sizeof(FP_MY)},
+    {"MZ", FP_MZ, sizeof(FP_MZ)},
+    {"NA", FP_NA, sizeof(FP_NA)},
+    {"NC", FP_NC, sizeof(FP_NC)},
+    {"NE", FP_NE, sizeof(FP_NE)},
+    {"NF", FP_NF, sizeof(FP_NF)},
+    {"NG", FP_NG, sizeof(FP_NG)},
+    {"NI", FP_NI, sizeof(FP_NI)},
+    {"NL", FP_NL, sizeof(FP_NL)},
+    {"NO", FP_NO, sizeof(FP_NO)},
+    {"NP", FP_NP, sizeof(FP_NP)},
+    {"NR", FP_NR, sizeof(FP_NR)},
+    {"NU", FP_NU, sizeof(FP_NU)},
+    {"NZ", FP_NZ, sizeof(FP_NZ)},
+    {"OM", FP_OM, sizeof(FP_OM)},
+    {"PA", FP_PA, sizeof(FP_PA)},
+    {"PE", FP_PE, sizeof(FP_PE)},
+    {"PF", FP_PF, sizeof(FP_PF)},
+    {"PG", FP_PG, sizeof(FP_PG)},
+    {"PH", FP_PH, sizeof(FP_PH)},
+    {"PK", FP_PK, sizeof(FP_PK)},
+    {"PL", FP_PL, sizeof(FP_PL)},
+    {"PM", FP_PM, sizeof(FP_PM)},
+    {"PN", FP_PN, sizeof(FP_PN)},
+    {"PR", FP_PR, sizeof(FP_PR)},
+    {"PS", FP_PS, sizeof(FP_PS)},
+    {"PT", FP_PT, sizeof(FP_PT)},
+    {"PW", FP_PW, sizeof(FP_PW)},
+    {"PY", FP_PY, sizeof(FP_PY)},
+    {"QA", FP_QA, sizeof(FP_QA)},
+    {"RE", FP_FR, sizeof(FP_FR)},
+    {"RO", FP_RO, sizeof(FP_RO)},
+    {"RS", FP_RS, sizeof(FP_RS)},
+    {"RU", FP_RU, sizeof(FP_RU)},
+    {"RW", FP_RW, sizeof(FP_RW)},
+    {"SA", FP_SA, sizeof(FP_SA)},
+    {"SB", FP_SB, sizeof(FP_SB)},
+    {"SC", FP_SC, sizeof(FP_SC)},
+    {"SD", FP_SD, sizeof(FP_SD)},
+    {"SE", FP_SE, sizeof(FP_SE)},
+    {"SG", FP_SG, sizeof(FP_SG)},
+    {"SH", FP_SH, sizeof(FP_SH)},
+    {"SI", FP_SI, sizeof(FP_SI)},
+    {"SJ", FP_NO, sizeof(FP_NO)},
+    {"SK", FP_SK, sizeof(FP_SK)},
+    {"SL", FP_SL, sizeof(FP_SL)},
+    {"SM", FP_SM, sizeof(FP_SM)},
+    {"SN", FP_SN, sizeof(FP_SN)},
+    {"SO", FP_SO, sizeof(FP_SO)},
+    {"SR", FP_SR, sizeof(FP_SR)},
+    {"SS", FP_SS, sizeof(FP_SS)},
+    {"ST", FP_ST, sizeof(FP_ST)},
+    {"SV", FP_SV, sizeof(FP_SV)},
+    {"SX", FP_SX, sizeof(FP_SX)},
+    {"SY", FP_SY, sizeof(FP_SY)},
+    {"SZ", FP_SZ, sizeof(FP_SZ)},
+    {"TC", FP_TC, sizeof(FP_TC)},
+    {"TD", FP_TD, sizeof(FP_TD)},
+    {"TF", FP_TF, sizeof(FP_TF)},
+    {"TG", FP_TG, sizeof(FP_TG)},
+    {"TH", FP_TH, sizeof(FP_TH)},
+    {"TJ", FP_TJ, sizeof(FP_TJ)},
+    {"TK", FP_TK, sizeof(FP_TK)},
+    {"TL", FP_TL, sizeof(FP_TL)},
+    {"TM", FP_TM, sizeof(FP_TM)},
+    {"TN", FP_TN, sizeof(FP_TN)},
+    {"TO", FP_TO, sizeof(FP_TO)},
+    {"TR", FP_TR, sizeof(FP_TR)},
+    {"TT", FP_TT, sizeof(FP_TT)},
+    {"TV", FP_TV, sizeof(FP_TV)},
+    {"TW", FP_TW, sizeof(FP_TW)},
+    {"TZ", FP_TZ, sizeof(FP_TZ)},
+    {"UA", FP_UA, sizeof(FP_UA)},
+    {"UG", FP_UG, sizeof(FP_UG)},
+    {"UM", FP_US, sizeof(FP_US)},
+    {"US", FP_US, sizeof(FP_US)},
+    {"UY", FP_UY, sizeof(FP_UY)},
+    {"UZ", FP_UZ, sizeof(FP_UZ)},
+    {"VA", FP_VA, sizeof(FP_VA)},
+    {"VC", FP_VC, sizeof(FP_VC)},
+    {"VE", FP_VE, sizeof(FP_VE)},
+    {"VG", FP_VG, sizeof(FP_VG)},
+    {"VI", FP_VI, sizeof(FP_VI)},
+    {"VN", FP_VN, sizeof(FP_VN)},
+    {"VU", FP_VU, sizeof(FP_VU)},
+    {"WF", FP_WF, sizeof(FP_WF)},
+    {"WS", FP_WS, sizeof(FP_WS)},
+    {"XK", FP_XK, sizeof(FP_XK)},
+    {"YE", FP_YE, sizeof(FP_YE)},
+    {"YT", FP_FR, sizeof(FP_FR)},
+    {"ZA", FP_ZA, sizeof(FP_ZA)},
+    {"ZM", FP_ZM, sizeof(FP_ZM)},
+    {"ZW", FP_ZW, sizeof(FP_ZW)},
+};
+
+const int NUM_FLAG_PROGRAMS = sizeof(FLAG_PROGRAMS) / sizeof(FLAG_PROGRAMS[0]);
+
+// --- PUBLIC API ---
+
+const FlagProgram *flagProgramLookup(const char *code)
+{
+    int lo = 0;
+    int hi = NUM_FLAG_PROGRAMS - 1;
+    while (lo <= hi)
+    {
+         int mid = (lo + hi) / 2;
+         int cmp = strncmp(code, FLAG_PROGRAMS[mid].code, 2);
+         if (cmp == 0 && code[2] == '\0')
+         {
+             return &FLAG_PROGRAMS[mid];
+         }
+         if (cmp == 0)
+         {
+             return nullptr; // Longer than two letters
+         }
+         if (cmp < 0)
+         {
+             hi = mid - 1;
+         }
+         else
+         {
+             lo = mid + 1;
+         }
+    }
+    return nullptr;
+}
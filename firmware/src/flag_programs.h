@@ -0,0 +1,67 @@
+#ifndef FLAG_PROGRAMS_H
+#define FLAG_PROGRAMS_H
+
+#include <Arduino.h>
+
+// --- FLAG BYTECODE ---
+// A flag program is a flat byte string: an opcode, its operands in flag units
+// (0..FLAG_W, 0..FLAG_H, scaled at draw time) and a color, repeated until FOP_END.
+// Operands that follow each opcode:
+enum FlagOpcode : uint8_t
+{
+    FOP_END = 0,   // -
+    FOP_FILL,      // color                      Whole flag
+    FOP_HSTRIPES,  // n, color x n               Equal horizontal stripes, top to bottom
+    FOP_VSTRIPES,  // n, color x n               Equal vertical stripes, hoist to fly
+    FOP_RECT,      // x, y, w, h, color
+    FOP_TRIANGLE,  // x0, y0, x1, y1, x2, y2, color
+    FOP_CIRCLE,    // cx, cy, r, color
+    FOP_STAR,      // cx, cy, r, color            Five points, one pointing up
+    FOP_CROSS,     // cx, cy, thickness, color    Full-width bar at cy plus full-height bar at cx
+    FOP_CANTON     // w, h, color                 Rectangle in the upper hoist corner
+};
+
+// A color byte is an index into FLAG_PALETTE, or FC_RGB565 followed by the raw
+// color as two bytes (high byte first) for the odd shade the palette lacks.
+enum FlagColor : uint8_t
+{
+    FC_BLACK = 0,
+    FC_WHITE,
+    FC_RED,
+    FC_MAROON,
+    FC_ORANGE,
+    FC_YELLOW,
+    FC_GREEN,
+    FC_DARKGREEN,
+    FC_SKY,
+    FC_BLUE,
+    FC_NAVY,
+    FC_TEAL,
+    FC_LIGHTGREEN,
+    FC_SAFFRON,
+    FC_GREY,
+    FC_BROWN,
+    NUM_FLAG_COLORS,
+    FC_RGB565 = 0xFF
+};
+
+extern const uint16_t FLAG_PALETTE[NUM_FLAG_COLORS];
+
+struct FlagProgram
+{
+    char code[3];          // Upper-case ISO 3166-1 alpha-2 code
+    const uint8_t *ops;
+    uint16_t size;         // Bytes of bytecode, including FOP_END
+};
+
+// Every ISO 3166-1 alpha-2 code (plus XK), sorted by code.
+extern const FlagProgram FLAG_PROGRAMS[];
+extern const int NUM_FLAG_PROGRAMS;
+
+/**
+ * @brief Finds the program for an upper-case 2-letter code (binary search).
+ * @return The table entry, or nullptr if the code has no program.
+ */
+const FlagProgram *flagProgramLookup(const char *code);
+
+#endif // FLAG_PROGRAMS_H
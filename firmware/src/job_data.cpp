@@ -0,0 +1,26 @@
+#include "job_data.h"
+#include <string.h>
+
+// Plain C and ArduinoJson only: the host test (tools/job_data_alloc_test.cpp) links this
+// file as is to check that a job's parse/copy cycle never touches the heap.
+
+void copyJobText(char *dst, size_t capacity, const char *src)
+{
+    size_t len = strnlen(src, capacity - 1);
+    if (src[len] != '\0')
+    {
+         while (len > 0 && ((uint8_t)src[len] & 0xC0) == 0x80)
+         {
+             len--; // Back up to the lead byte of the character that did not fit
+         }
+    }
+    memcpy(dst, src, len);
+    dst[len] = '\0';
+}
+
+void jobDataFromJson(JobData &job, JsonVariantConst doc)
+{
+    copyJobText(job.name, sizeof(job.name), doc["name"] | "Unknown Task");
+    copyJobText(job.country, sizeof(job.country), doc["country"] | "Unknown Location");
+    copyJobText(job.flag, sizeof(job.flag), doc["flag"] | "??"); // Default to a simple unknown code
+}
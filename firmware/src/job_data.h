@@ -0,0 +1,36 @@
+#ifndef JOB_DATA_H
+#define JOB_DATA_H
+
+#include <stddef.h>
+#include <type_traits>
+#include "job_latency.h"
+
+// --- JOB DATA STRUCTURE ---
+// Fixed capacity with inline UTF-8 buffers, so a job travels through the pipeline
+// by plain assignment and never touches the heap (no fragmentation after days of uptime).
+const size_t JOB_NAME_LEN = 64;
+const size_t JOB_COUNTRY_LEN = 48;
+
+struct JobData
+{
+    char name[JOB_NAME_LEN];
+    char country[JOB_COUNTRY_LEN];
+    char flag[4]; // Country code (e.g., "FR", "DE", "US"), NUL-terminated
+    JobLatency latency; // Stage stamps, reported with the completion
+};
+static_assert(std::is_trivially_copyable<JobData>::value, "JobData must stay a POD so copies never allocate");
+
+/**
+ * @brief Copies UTF-8 text into a fixed buffer, cutting before a partial multi-byte character.
+ * Always NUL-terminates 'dst'.
+ */
+void copyJobText(char *dst, size_t capacity, const char *src);
+
+/**
+ * @brief Fills name, country and flag from a parsed job payload, with the defaults for missing
+ * fields. Leaves 'latency' alone. No Arduino dependencies, so it also runs in the host test
+ * (tools/job_data_alloc_test.cpp).
+ */
+void jobDataFromJson(JobData &job, JsonVariantConst doc);
+
+#endif // JOB_DATA_H
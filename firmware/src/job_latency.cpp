@@ -0,0 +1,111 @@
+#include "job_latency.h"
+#include <Arduino.h>
+#include <esp_timer.h>
+#include <sys/time.h>
+
+// ******************************************************
+// ** END-TO-END JOB LATENCY (stage stamps + wall clock) **
+// ******************************************************
+// Each job carries monotonic stamps for the stages it passes on the device. They are
+// converted to wall-clock time once, when the completion is built, so the backend can
+// line them up with the 'timestamp' it gave the job and compute queue-to-pixel latency.
+// Wall time comes from SNTP when it has synced; before that (or without internet) from
+// the backend's 'sent_at', which is off by the one-way network delay (a few ms on a LAN).
+
+static const char *STAGE_NAMES[NUM_LATENCY_STAGES] = {
+    "accepted",
+    "parsed",
+    "first_pixel",
+    "frame_done",
+    "led_end",
+    "completion_sent"
+};
+
+static int64_t backendOffsetUs = 0; // Unix time minus esp_timer time, from the last 'sent_at'
+static bool backendOffsetValid = false;
+
+// Wall-clock time (unix ms) of a monotonic stamp. Returns the clock source, or nullptr if there is none yet.
+static const char *wallClockMs(int64_t monoUs, int64_t *wallMs)
+{
+    struct timeval now;
+    gettimeofday(&now, nullptr);
+    if (now.tv_sec >= LATENCY_MIN_VALID_EPOCH)
+    {
+         int64_t nowWallUs = (int64_t)now.tv_sec * 1000000 + now.tv_usec;
+         *wallMs = (nowWallUs - (esp_timer_get_time() - monoUs)) / 1000;
+         return "sntp";
+    }
+    if (backendOffsetValid)
+    {
+         *wallMs = (monoUs + backendOffsetUs) / 1000;
+         return "backend";
+    }
+    return nullptr;
+}
+
+// --- PUBLIC API ---
+
+void setupLatencyClock()
+{
+    configTime(0, 0, LATENCY_SNTP_SERVER); // UTC; only differences and unix times are reported
+}
+
+void latencyBegin(JobLatency &latency, int64_t acceptedUs, JsonVariantConst job)
+{
+    int64_t now = esp_timer_get_time();
+    memset(&latency, 0, sizeof(latency));
+    latency.enqueuedAt = job["timestamp"] | 0.0;
+    latency.stageUs[STAGE_ACCEPTED] = acceptedUs != 0 ? acceptedUs : now;
+    latency.stageUs[STAGE_PARSED] = now;
+
+    double sentAt = job["sent_at"] | 0.0;
+    if (sentAt > LATENCY_MIN_VALID_EPOCH && acceptedUs != 0)
+    {
+         backendOffsetUs = (int64_t)(sentAt * 1e6) - acceptedUs;
+         backendOffsetValid = true;
+    }
+}
+
+void latencyStamp(JobLatency &latency, LatencyStage stage)
+{
+    latency.stageUs[stage] = esp_timer_get_time();
+}
+
+void latencyStampOnce(JobLatency &latency, LatencyStage stage, int64_t us)
+{
+    if (latency.stageUs[stage] == 0)
+    {
+         latency.stageUs[stage] = us;
+    }
+}
+
+void latencyToJson(const JobLatency &latency, JsonObject out)
+{
+    int64_t acceptedUs = latency.stageUs[STAGE_ACCEPTED];
+    int64_t acceptedAtMs = 0;
+    const char *clock = acceptedUs != 0 ? wallClockMs(acceptedUs, &acceptedAtMs) : nullptr;
+
+    out["clock"] = clock != nullptr ? clock : "none";
+    if (latency.enqueuedAt > 0)
+    {
+         out["enqueued_at"] = latency.enqueuedAt;
+    }
+    if (clock != nullptr)
+    {
+         out["accepted_at_ms"] = acceptedAtMs;
+         if (latency.enqueuedAt > 0)
+         {
+             out["queue_ms"] = acceptedAtMs - (int64_t)(latency.enqueuedAt * 1000);
+         }
+    }
+
+    // Offsets from accept, to 0.1 ms; stages the job never reached are left out
+    JsonObject stages = out["stages_ms"].to<JsonObject>();
+    for (int stage = STAGE_PARSED; stage < NUM_LATENCY_STAGES; stage++)
+    {
+         if (latency.stageUs[stage] != 0 && acceptedUs != 0)
+         {
+             stages[STAGE_NAMES[stage]] = (double)((latency.stageUs[stage] - acceptedUs + 50) / 100) / 10.0;
+         }
+    }
+}
@@ -0,0 +1,61 @@
+#ifndef JOB_LATENCY_H
+#define JOB_LATENCY_H
+
+#include <stdint.h>
+#include <ArduinoJson.h>
+
+// --- JOB LATENCY CONFIGURATION ---
+// Stages are stamped with esp_timer_get_time() (monotonic, microseconds) and mapped to
+// wall-clock time only when the completion is reported, by SNTP or by the offset implied
+// by the backend's 'sent_at' on the most recent job.
+#define LATENCY_SNTP_SERVER "pool.ntp.org"
+#define LATENCY_MIN_VALID_EPOCH 1700000000 // Wall clock before this means SNTP has not synced yet
+
+// Points in a job's life on the device, in the order they happen.
+enum LatencyStage
+{
+    STAGE_ACCEPTED = 0,    // TCP connection accepted (admission control)
+    STAGE_PARSED,          // JSON parsed and validated
+    STAGE_FIRST_PIXEL,     // First write of the job's frame to the panel
+    STAGE_FRAME_DONE,      // Job's frame fully on the panel
+    STAGE_LED_END,         // LED sequence finished
+    STAGE_COMPLETION_SENT, // Completion POST returned (re-stamped on every retry); after the payload, so never in it
+    NUM_LATENCY_STAGES
+};
+
+// Travels inside JobData, so it must stay trivially copyable.
+struct JobLatency
+{
+    double enqueuedAt;                   // Backend 'timestamp' (unix seconds), 0 if the job had none
+    int64_t stageUs[NUM_LATENCY_STAGES]; // esp_timer_get_time() per stage, 0 = not reached
+};
+
+/**
+ * @brief Starts SNTP. Until it syncs, wall-clock times come from the backend offset (if any).
+ */
+void setupLatencyClock();
+
+/**
+ * @brief Resets a job's record and stamps STAGE_ACCEPTED and STAGE_PARSED.
+ * @param acceptedUs When the connection was accepted; 0 when the job did not come over HTTP (soak).
+ * @param job The parsed job: 'timestamp' is kept, 'sent_at' refreshes the backend clock offset.
+ */
+void latencyBegin(JobLatency &latency, int64_t acceptedUs, JsonVariantConst job);
+
+/**
+ * @brief Stamps a stage with the current time.
+ */
+void latencyStamp(JobLatency &latency, LatencyStage stage);
+
+/**
+ * @brief Stamps a stage with a given time unless it is already stamped (a job's first frame wins).
+ */
+void latencyStampOnce(JobLatency &latency, LatencyStage stage, int64_t us);
+
+/**
+ * @brief Writes the record for the completion payload: clock source, enqueue and accept wall times,
+ * and each reached stage in ms since accept.
+ */
+void latencyToJson(const JobLatency &latency, JsonObject out);
+
+#endif // JOB_LATENCY_H
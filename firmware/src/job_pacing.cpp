@@ -0,0 +1,115 @@
+#include "job_pacing.h"
+#include "metrics.h"
+#include "deferred_log.h"
+
+// ******************************************************
+// ** JOB PACING (per-job sequence length, degradation tiers) **
+// ******************************************************
+// A job's LED time is its own choice within device limits. As the backlog grows the
+// device gives each job less: express squeezes every sequence into a short budget and
+// skips live flag drawing; latest-wins also stops drawing the jobs in between, so the
+// panel shows the newest job every PACING_LATEST_DRAW_MS while every job still runs
+// and is acknowledged. Each tier is left only once the backlog is well below its
+// entry point. Throughput is kept per tier as jobs per busy minute (job start to
+// completion sent), which is what the tiers should be compared on.
+
+static const char *MODE_NAMES[NUM_PACING_MODES] = {"normal", "express", "latest"};
+static const MetricGauge PER_MINUTE_GAUGES[NUM_PACING_MODES] = {
+    GAUGE_JOBS_PER_MINUTE_NORMAL, GAUGE_JOBS_PER_MINUTE_EXPRESS, GAUGE_JOBS_PER_MINUTE_LATEST};
+
+struct ModeStats
+{
+    uint32_t jobs;
+    uint32_t busyMs;
+};
+
+static PacingMode mode = PACING_NORMAL;
+static ModeStats stats[NUM_PACING_MODES];
+static uint32_t jobsNotDrawn = 0;
+
+static uint32_t jobsPerMinute(const ModeStats &s)
+{
+    return s.busyMs > 0 ? (uint32_t)((uint64_t)s.jobs * 60000 / s.busyMs) : 0;
+}
+
+// --- PUBLIC API ---
+
+void pacingShapeDefault(JsonVariantConst job, LedTimeline &timeline)
+{
+    int palette = timeline.count;
+    if (palette == 0)
+    {
+         return;
+    }
+    int phases = constrain(job["phases"] | palette, 1, MAX_TIMELINE_KEYFRAMES);
+    uint16_t phaseMs = constrain(job["phase_ms"] | (int)timeline.keyframes[0].durationMs, PACING_MIN_PHASE_MS, PACING_MAX_PHASE_MS);
+
+    for (int i = 0; i < phases; i++)
+    {
+         timeline.keyframes[i].color = timeline.keyframes[i % palette].color;
+         timeline.keyframes[i].fade = timeline.keyframes[i % palette].fade;
+         timeline.keyframes[i].durationMs = phaseMs;
+    }
+    timeline.count = phases;
+}
+
+void pacingNoteBacklog(int waitingJobs)
+{
+    PacingMode next = PACING_NORMAL;
+    if (waitingJobs >= PACING_LATEST_ENTER_BACKLOG || (mode == PACING_LATEST && waitingJobs > PACING_LATEST_EXIT_BACKLOG))
+    {
+         next = PACING_LATEST;
+    }
+    else if (waitingJobs >= PACING_EXPRESS_ENTER_BACKLOG || (mode != PACING_NORMAL && waitingJobs > PACING_EXPRESS_EXIT_BACKLOG))
+    {
+         next = PACING_EXPRESS;
+    }
+    if (next != mode)
+    {
+         LOG_INFO("Pacing: %s tier (%d jobs waiting).\n", MODE_NAMES[next], waitingJobs);
+         mode = next;
+         metricsSetGauge(GAUGE_PACING_TIER, mode);
+    }
+}
+
+PacingMode pacingMode()
+{
+    return mode;
+}
+
+PacingMode pacingApply(LedTimeline &timeline)
+{
+    ledTimelineFit(timeline, mode == PACING_NORMAL ? PACING_MAX_JOB_MS : PACING_EXPRESS_JOB_MS);
+    return mode;
+}
+
+void pacingJobFinished(PacingMode jobMode, uint32_t busyMs)
+{
+    ModeStats &s = stats[jobMode];
+    s.jobs++;
+    s.busyMs += busyMs;
+    metricsSetGauge(PER_MINUTE_GAUGES[jobMode], jobsPerMinute(s));
+}
+
+bool pacingDrawJob(uint32_t msSinceLastDraw)
+{
+    return mode != PACING_LATEST || msSinceLastDraw >= PACING_LATEST_DRAW_MS;
+}
+
+void pacingJobNotDrawn()
+{
+    jobsNotDrawn++;
+    metricsIncrement(COUNTER_JOBS_NOT_DRAWN);
+}
+
+void pacingToJson(JsonObject out)
+{
+    out["tier"] = MODE_NAMES[mode];
+    out["jobs_not_drawn"] = jobsNotDrawn;
+    for (int m = 0; m < NUM_PACING_MODES; m++)
+    {
+         JsonObject entry = out[MODE_NAMES[m]].to<JsonObject>();
+         entry["jobs"] = stats[m].jobs;
+         entry["jobs_per_minute"] = jobsPerMinute(stats[m]);
+    }
+}
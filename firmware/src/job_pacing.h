@@ -0,0 +1,72 @@
+#ifndef JOB_PACING_H
+#define JOB_PACING_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include "led_timeline.h"
+
+// --- JOB PACING CONFIGURATION ---
+#define PACING_MIN_PHASE_MS 50          // Bounds on a job's "phase_ms"
+#define PACING_MAX_PHASE_MS 2000
+#define PACING_MAX_JOB_MS 10000         // LED time cap per job, custom sequences included
+#define PACING_EXPRESS_ENTER_BACKLOG 4  // Waiting jobs (backend queue + device queue) that switch express on
+#define PACING_EXPRESS_EXIT_BACKLOG 1   // ... and that switch it off again
+#define PACING_EXPRESS_JOB_MS 400       // LED time per job in express mode (and latest-wins)
+#define PACING_LATEST_ENTER_BACKLOG 10  // Waiting jobs that switch latest-wins on
+#define PACING_LATEST_EXIT_BACKLOG 5    // ... and that drop back to express
+#define PACING_LATEST_DRAW_MS 1500      // Latest-wins: at most one job drawn per this many ms
+
+// Degradation tiers, from full treatment to heavy backlog.
+enum PacingMode
+{
+    PACING_NORMAL = 0,
+    PACING_EXPRESS, // Every sequence squeezed into PACING_EXPRESS_JOB_MS; flags not in the cache get a placeholder
+    PACING_LATEST,  // As express, and jobs in between PACING_LATEST_DRAW_MS are not drawn (still run and acknowledged)
+    NUM_PACING_MODES
+};
+
+/**
+ * @brief Applies a job's "phases" (keyframes, cycling the default colors) and "phase_ms"
+ * to the default blink, clamped to the limits above. Jobs with a "sequence" do not use this.
+ */
+void pacingShapeDefault(JsonVariantConst job, LedTimeline &timeline);
+
+/**
+ * @brief Reports how many jobs are waiting behind the one being accepted (the backend's
+ * "backlog" plus the device's own queue). Moves between the tiers with hysteresis.
+ */
+void pacingNoteBacklog(int waitingJobs);
+
+/**
+ * @brief The tier jobs are started in right now.
+ */
+PacingMode pacingMode();
+
+/**
+ * @brief Fits a timeline about to start to the current mode's LED time budget.
+ * @return The mode the job runs in (pass it to pacingJobFinished).
+ */
+PacingMode pacingApply(LedTimeline &timeline);
+
+/**
+ * @brief Records a finished job and its start-to-completion time for the per-mode throughput.
+ */
+void pacingJobFinished(PacingMode mode, uint32_t busyMs);
+
+/**
+ * @brief Whether the job screen may show a job now, given the time since a job was last drawn.
+ * False only in latest-wins, until PACING_LATEST_DRAW_MS have passed.
+ */
+bool pacingDrawJob(uint32_t msSinceLastDraw);
+
+/**
+ * @brief Counts a held-back job that was superseded by the next one before it could be shown.
+ */
+void pacingJobNotDrawn();
+
+/**
+ * @brief Current tier, jobs not drawn and, per tier, jobs finished and jobs per busy minute.
+ */
+void pacingToJson(JsonObject out);
+
+#endif // JOB_PACING_H
@@ -0,0 +1,330 @@
+#include "job_screen.h"
+#include "flag_drawing.h"
+#include "flag_cache.h"
+#include "metrics.h"
+#include "pixel_kernels.h"
+#include "trace.h"
+
+// ******************************************************
+// ** RETAINED JOB SCREEN (per-widget invalidation) **
+// ******************************************************
+// The job screen is a fixed set of widgets with bounds. What the panel currently shows
+// ('shown') is kept next to what it should show ('wanted'); a widget is dirty while the
+// two differ. A paint clears and redraws only the dirty widgets, so the status line
+// flipping to READY costs one 8-pixel strip instead of a full-screen fill and a flag.
+// The title and separator are drawn once per boot.
+
+struct WidgetBounds
+{
+    int16_t x, y, w, h;
+};
+
+struct ScreenState
+{
+    JobData job;
+    bool processing;
+};
+
+static const int MARGIN = 5;
+static const int LINE_H = 20;     // Size-2 text line pitch (glyphs are 16 tall)
+static const int FLAG_SCALE = 4;  // 32x20 -> 128x80
+static const uint8_t ALL_WIDGETS = (uint8_t)((1u << NUM_JOB_SCREEN_WIDGETS) - 1);
+static const uint8_t STATIC_WIDGETS = JOB_SCREEN_WIDGET_BIT(WIDGET_TITLE) | JOB_SCREEN_WIDGET_BIT(WIDGET_SEPARATOR);
+
+static ScreenState shown;
+static ScreenState wanted = {{"Waiting", "for next", "JOB"}, false};
+static WidgetBounds shownBounds[NUM_JOB_SCREEN_WIDGETS];
+static bool panelStarted = false; // Boot splash cleared, static widgets drawn
+static int screenWidth = 0, screenHeight = 0; // Taken from the first target drawn into
+static uint8_t dirtyMask = ALL_WIDGETS;
+static bool cheapFlags = false; // Placeholder instead of a live flag draw on a cache miss
+
+// --- LAYOUT ---
+
+static int textLines(const char *text)
+{
+    return strlen(text) <= JOB_SCREEN_CHARS_PER_LINE ? 1 : 2;
+}
+
+// Bounds of a label plus one or two value lines
+static int textBlockHeight(int lines)
+{
+    return LINE_H * (1 + lines) - 4;
+}
+
+static void layoutFor(const JobData &job, int width, int height, WidgetBounds out[NUM_JOB_SCREEN_WIDGETS])
+{
+    int halfWidth = width / 2;                          // 160
+    int flagW = FLAG_W * FLAG_SCALE;                    // 128
+    int flagH = FLAG_H * FLAG_SCALE;                    // 80
+    int flagX = halfWidth + (halfWidth - flagW) / 2;    // 176, centered in the right half
+    int flagY = (height - flagH) / 2;                   // 45
+
+    // Text runs up to 14 size-2 characters (168 px), so the left-hand widgets span up to the flag column
+    out[WIDGET_TITLE] = {0, 0, (int16_t)flagX, (int16_t)(MARGIN + 16)};
+    out[WIDGET_SEPARATOR] = {(int16_t)halfWidth, 0, 1, (int16_t)height};
+
+    int nameY = MARGIN + LINE_H + 5;
+    int nameLines = textLines(job.name);
+    out[WIDGET_NAME] = {0, (int16_t)nameY, (int16_t)flagX, (int16_t)textBlockHeight(nameLines)};
+
+    int originY = nameY + LINE_H * (1 + nameLines) + 5;
+    out[WIDGET_ORIGIN] = {0, (int16_t)originY, (int16_t)flagX, (int16_t)textBlockHeight(textLines(job.country))};
+
+    out[WIDGET_FLAG] = {(int16_t)flagX, (int16_t)flagY, (int16_t)flagW, (int16_t)flagH};
+    out[WIDGET_CODE] = {(int16_t)flagX, (int16_t)(flagY + flagH + 8), (int16_t)flagW, 8};
+    out[WIDGET_STATUS] = {0, (int16_t)(height - 15), (int16_t)width, 8};
+}
+
+static bool sameBounds(const WidgetBounds &a, const WidgetBounds &b)
+{
+    return a.x == b.x && a.y == b.y && a.w == b.w && a.h == b.h;
+}
+
+// --- DRAWING ---
+
+// Draws text, wrapping it to a second line if it exceeds maxCharsPerLine.
+// Prints slices of the caller's buffer directly, so no temporary Strings are built.
+static void wrapAndPrintText(Adafruit_GFX &gfx, const char *text, int x, int y, int maxCharsPerLine, uint16_t color)
+{
+    gfx.setTextColor(color);
+    gfx.setTextSize(2);
+    int length = strlen(text);
+
+    if (length <= maxCharsPerLine)
+    {
+         gfx.setCursor(x, y);
+         gfx.print(text);
+         return;
+    }
+
+    // Break at the last space up to maxCharsPerLine, or force a break if there is none (very long single word)
+    int lastSpaceIndex = -1;
+    for (int i = 0; i <= maxCharsPerLine; i++)
+    {
+         if (text[i] == ' ')
+         {
+             lastSpaceIndex = i;
+         }
+    }
+    int line1Length = (lastSpaceIndex != -1) ? lastSpaceIndex : maxCharsPerLine;
+
+    gfx.setCursor(x, y);
+    Print &out = gfx; // Adafruit_GFX hides Print's buffer overload of write()
+    out.write((const uint8_t *)text, line1Length);
+
+    // Line 2 starts after the break point; names longer than two lines just show the start of the remainder
+    int startOfLine2 = (text[line1Length] == ' ') ? line1Length + 1 : line1Length;
+    gfx.setCursor(x, y + LINE_H);
+    out.write((const uint8_t *)text + startOfLine2, min(maxCharsPerLine, length - startOfLine2));
+}
+
+static void drawLabelledText(Adafruit_GFX &gfx, const WidgetBounds &b, const char *label, const char *text)
+{
+    gfx.setTextSize(2);
+    gfx.setTextColor(ST77XX_WHITE);
+    gfx.setCursor(MARGIN, b.y);
+    gfx.print(label);
+    wrapAndPrintText(gfx, text, MARGIN, b.y + LINE_H, JOB_SCREEN_CHARS_PER_LINE, ST77XX_YELLOW);
+}
+
+static void drawFlagWidget(Adafruit_GFX &gfx, const WidgetBounds &b, const char *flagCode, uint16_t *frame)
+{
+    unsigned long flagStart = micros();
+    uint16_t *cachedFlag = FLAG_SCALE == FLAG_CACHE_SCALE ? flagCacheLookup(flagCode) : nullptr;
+    if (cachedFlag != nullptr && frame != nullptr)
+    {
+         rgb565ScaleBlit(frame + b.y * gfx.width() + b.x, gfx.width(), cachedFlag, FLAG_CACHE_WIDTH, FLAG_CACHE_HEIGHT, 1); // Row copies
+    }
+    else if (cachedFlag != nullptr)
+    {
+         gfx.drawRGBBitmap(b.x, b.y, cachedFlag, FLAG_CACHE_WIDTH, FLAG_CACHE_HEIGHT); // Prerendered: one window write
+    }
+    else if (cheapFlags)
+    {
+         gfx.fillRect(b.x, b.y, FLAG_W * FLAG_SCALE, FLAG_H * FLAG_SCALE, JOB_SCREEN_SEPARATOR_COLOR); // The code label still names it
+         return;
+    }
+    else
+    {
+         drawFlag(gfx, flagCode, b.x, b.y, FLAG_SCALE);
+    }
+    metricsObserveFlagDraw(flagCode, micros() - flagStart);
+}
+
+static void drawWidget(Adafruit_GFX &gfx, int widget, const WidgetBounds &b, const ScreenState &state, uint16_t *frame)
+{
+    switch (widget)
+    {
+    case WIDGET_TITLE:
+         gfx.setTextSize(2);
+         gfx.setTextColor(ST77XX_CYAN);
+         gfx.setCursor(MARGIN, MARGIN);
+         gfx.print("INCOMING JOB:");
+         break;
+    case WIDGET_SEPARATOR:
+         gfx.drawFastVLine(b.x, b.y, b.h, JOB_SCREEN_SEPARATOR_COLOR);
+         break;
+    case WIDGET_NAME:
+         drawLabelledText(gfx, b, "Name: ", state.job.name);
+         break;
+    case WIDGET_ORIGIN:
+         drawLabelledText(gfx, b, "Origin:", state.job.country);
+         break;
+    case WIDGET_FLAG:
+         drawFlagWidget(gfx, b, state.job.flag, frame);
+         break;
+    case WIDGET_CODE:
+         gfx.setTextSize(1);
+         gfx.setCursor(b.x, b.y);
+         gfx.setTextColor(ST77XX_RED);
+         gfx.print("CODE: ");
+         gfx.setTextColor(ST77XX_ORANGE);
+         gfx.print(state.job.flag);
+         break;
+    case WIDGET_STATUS:
+         gfx.setTextSize(1);
+         gfx.setTextColor(ST77XX_GREEN);
+         gfx.setCursor(MARGIN, b.y);
+         gfx.print(state.processing ? "STATUS: PROCESSING... LED SEQUENCE" : "STATUS: READY. AWAITING TRANSMISSION.");
+         break;
+    }
+}
+
+// Blanks a widget's area. Text widgets overhang the separator, so its slice is put back
+// underneath them (the separator itself is never redrawn as a widget after boot).
+static void clearBounds(Adafruit_GFX &gfx, const WidgetBounds &b)
+{
+    gfx.fillRect(b.x, b.y, b.w, b.h, ST77XX_BLACK);
+    const WidgetBounds &separator = shownBounds[WIDGET_SEPARATOR];
+    if (panelStarted && b.w > 1 && b.x <= separator.x && separator.x < b.x + b.w)
+    {
+         gfx.drawFastVLine(separator.x, b.y, b.h, JOB_SCREEN_SEPARATOR_COLOR);
+    }
+}
+
+// Recomputes the dirty bits of the job widgets from shown vs. wanted.
+static void refreshDirty()
+{
+    if (!panelStarted)
+    {
+         return; // Everything is painted on the first pass anyway
+    }
+    WidgetBounds next[NUM_JOB_SCREEN_WIDGETS];
+    layoutFor(wanted.job, screenWidth, screenHeight, next);
+
+    uint8_t dirty = dirtyMask & STATIC_WIDGETS;
+    if (strcmp(shown.job.name, wanted.job.name) != 0 || !sameBounds(shownBounds[WIDGET_NAME], next[WIDGET_NAME]))
+    {
+         dirty |= JOB_SCREEN_WIDGET_BIT(WIDGET_NAME);
+    }
+    if (strcmp(shown.job.country, wanted.job.country) != 0 || !sameBounds(shownBounds[WIDGET_ORIGIN], next[WIDGET_ORIGIN]))
+    {
+         dirty |= JOB_SCREEN_WIDGET_BIT(WIDGET_ORIGIN);
+    }
+    if (strcmp(shown.job.flag, wanted.job.flag) != 0)
+    {
+         dirty |= JOB_SCREEN_WIDGET_BIT(WIDGET_FLAG) | JOB_SCREEN_WIDGET_BIT(WIDGET_CODE);
+    }
+    if (shown.processing != wanted.processing)
+    {
+         dirty |= JOB_SCREEN_WIDGET_BIT(WIDGET_STATUS);
+    }
+    dirtyMask = dirty;
+}
+
+// --- PUBLIC API ---
+
+void jobScreenSetJob(const JobData &data)
+{
+    wanted.job = data;
+    refreshDirty();
+}
+
+void jobScreenSetProcessing(bool processing)
+{
+    wanted.processing = processing;
+    refreshDirty();
+}
+
+void jobScreenSetCheapFlags(bool cheap)
+{
+    cheapFlags = cheap;
+}
+
+bool jobScreenDirty()
+{
+    return dirtyMask != 0;
+}
+
+uint8_t jobScreenPaint(Adafruit_GFX &panel)
+{
+    TRACE_FUNCTION();
+    screenWidth = panel.width();
+    screenHeight = panel.height();
+    WidgetBounds next[NUM_JOB_SCREEN_WIDGETS];
+    layoutFor(wanted.job, screenWidth, screenHeight, next);
+
+    uint8_t painted = dirtyMask;
+    if (!panelStarted)
+    {
+         panel.fillScreen(ST77XX_BLACK); // Boot splash
+         painted = ALL_WIDGETS;
+    }
+    else
+    {
+         // Old positions first, so a widget that moved (origin after a one/two-line name) leaves nothing behind
+         for (int w = 0; w < NUM_JOB_SCREEN_WIDGETS; w++)
+         {
+             if (painted & JOB_SCREEN_WIDGET_BIT(w))
+             {
+                 clearBounds(panel, shownBounds[w]);
+             }
+         }
+    }
+
+    for (int w = 0; w < NUM_JOB_SCREEN_WIDGETS; w++)
+    {
+         if (!(painted & JOB_SCREEN_WIDGET_BIT(w)))
+         {
+             continue;
+         }
+         if (panelStarted)
+         {
+             clearBounds(panel, next[w]);
+         }
+         drawWidget(panel, w, next[w], wanted, nullptr);
+         shownBounds[w] = next[w];
+    }
+
+    shown = wanted;
+    panelStarted = true;
+    dirtyMask = 0;
+    return painted;
+}
+
+void jobScreenRender(Adafruit_GFX &gfx, uint16_t *frame, const JobData &data, bool processing)
+{
+    TRACE_FUNCTION();
+    ScreenState state = {data, processing};
+    screenWidth = gfx.width();
+    screenHeight = gfx.height();
+    WidgetBounds bounds[NUM_JOB_SCREEN_WIDGETS];
+    layoutFor(data, screenWidth, screenHeight, bounds);
+
+    gfx.fillScreen(ST77XX_BLACK);
+    for (int w = 0; w < NUM_JOB_SCREEN_WIDGETS; w++)
+    {
+         drawWidget(gfx, w, bounds[w], state, frame);
+    }
+}
+
+void jobScreenShown(const JobData &data, bool processing)
+{
+    shown.job = data;
+    shown.processing = processing;
+    layoutFor(data, screenWidth, screenHeight, shownBounds);
+    panelStarted = true;
+    dirtyMask = 0;
+    refreshDirty(); // Still dirty if the wanted state moved on since the frame was rendered
+}
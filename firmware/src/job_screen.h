@@ -0,0 +1,71 @@
+#ifndef JOB_SCREEN_H
+#define JOB_SCREEN_H
+
+#include <Arduino.h>
+#include <Adafruit_GFX.h>
+#include "job_data.h"
+
+// --- JOB SCREEN CONFIGURATION ---
+#define JOB_SCREEN_SEPARATOR_COLOR 0x3186 // color565(50, 50, 50)
+#define JOB_SCREEN_CHARS_PER_LINE 14      // Name and origin wrap after this many size-2 characters
+
+// The retained widgets of the job screen, in paint order.
+enum JobScreenWidget
+{
+    WIDGET_TITLE = 0, // "INCOMING JOB:" (static)
+    WIDGET_SEPARATOR, // Vertical rule between the text and flag halves (static)
+    WIDGET_NAME,      // "Name:" and the name, one or two lines
+    WIDGET_ORIGIN,    // "Origin:" and the country, one or two lines (moves with the name)
+    WIDGET_FLAG,      // 128x80 flag
+    WIDGET_CODE,      // "CODE: XX" under the flag
+    WIDGET_STATUS,    // Status line at the bottom
+    NUM_JOB_SCREEN_WIDGETS
+};
+
+#define JOB_SCREEN_WIDGET_BIT(widget) ((uint8_t)(1u << (widget)))
+// Widgets that show the job itself (repainting any of them means a new job is on screen)
+#define JOB_SCREEN_JOB_WIDGETS (JOB_SCREEN_WIDGET_BIT(WIDGET_NAME) | JOB_SCREEN_WIDGET_BIT(WIDGET_ORIGIN) | \
+                                JOB_SCREEN_WIDGET_BIT(WIDGET_FLAG) | JOB_SCREEN_WIDGET_BIT(WIDGET_CODE))
+
+/**
+ * @brief Sets the job the panel should show. Only the widgets whose text or position changes become dirty.
+ */
+void jobScreenSetJob(const JobData &data);
+
+/**
+ * @brief Sets the status line (LED sequence running vs. ready). Dirties the status widget only.
+ */
+void jobScreenSetProcessing(bool processing);
+
+/**
+ * @brief Under load, flags that are not prerendered are shown as a gray placeholder instead of
+ * being drawn live (cached flags are unaffected). Applies to flags drawn from now on; dirties nothing.
+ */
+void jobScreenSetCheapFlags(bool cheap);
+
+/**
+ * @brief True when some widget on the panel is out of date.
+ */
+bool jobScreenDirty();
+
+/**
+ * @brief Repaints the dirty widgets on the panel, each inside its own bounds.
+ * The first call clears the boot splash and draws the title and separator; later calls never touch them.
+ * @return Bitmask (JOB_SCREEN_WIDGET_BIT) of the widgets that were repainted.
+ */
+uint8_t jobScreenPaint(Adafruit_GFX &panel);
+
+/**
+ * @brief Renders every widget of a job into a full-screen canvas (the render-ahead back buffer).
+ * Leaves the panel's retained state alone.
+ * @param frame The canvas' pixel buffer (cached flags are blitted straight into it).
+ */
+void jobScreenRender(Adafruit_GFX &gfx, uint16_t *frame, const JobData &data, bool processing);
+
+/**
+ * @brief Records that a full frame from jobScreenRender() was pushed to the panel, so the widgets it
+ * covered are clean again.
+ */
+void jobScreenShown(const JobData &data, bool processing);
+
+#endif // JOB_SCREEN_H
@@ -0,0 +1,312 @@
+#include "led_driver.h"
+#include "deferred_log.h"
+#include <ArduinoJson.h>
+#include <driver/rmt.h>
+#include <esp_heap_caps.h>
+#include <esp_timer.h>
+#include <math.h>
+
+// ******************************************************
+// ** RMT LED DRIVER (encoded frames, fixed refresh) **
+// ******************************************************
+// Adafruit_NeoPixel::show() bit-bangs the whole strip with interrupts off, which is
+// 30 us per LED of a stalled core. Here a frame is drawn into a byte buffer and
+// committed; a periodic esp_timer picks it up, runs it through the gamma/brightness
+// table, expands it into RMT items (a 16-entry nibble table, two copies per byte) and
+// starts the transmission without waiting. Encoded frames are double-buffered: the
+// next one is encoded while the current one is still on the wire, and only goes out
+// once the wire is free. Three pixel buffers keep drawing, the committed frame and
+// the frame being encoded apart; a commit only copies bytes under the lock.
+
+// WS2812 bit timings in RMT ticks (80 MHz / 2 = 25 ns)
+#define RMT_CLK_DIV 2
+#define T0H_TICKS 16      // 0.40 us
+#define T0L_TICKS 34      // 0.85 us
+#define T1H_TICKS 32      // 0.80 us
+#define T1L_TICKS 18      // 0.45 us
+#define LATCH_TICKS 3200  // 80 us low after the last bit
+#define ITEMS_PER_LED 24
+
+struct LedDriverStats
+{
+    uint32_t framesSent;
+    uint32_t framesDropped;  // Committed, then replaced before they were encoded or sent (ledMux)
+    uint32_t wireBusyTicks;  // Ticks an encoded frame waited for the previous one to finish
+    uint32_t framesEncoded;
+    uint32_t encodeUsLast;
+    uint32_t encodeUsMax;
+    uint64_t encodeUsTotal;
+};
+
+static const uint16_t BENCH_COUNTS[] = {1, 16, 64, 150, LED_DRIVER_MAX_LEDS};
+
+static uint16_t numLeds = 0;
+static uint8_t currentBrightness = 0;
+static uint8_t lut[256];
+static rmt_item32_t nibbleItems[16][4];
+
+static uint8_t *drawFrame = nullptr;   // Written by ledSetPixel/ledFill from loop() and the timeline task; guarded by ledMux
+static uint8_t *pendingFrame = nullptr; // Last commit, not picked up yet
+static uint8_t *encodeFrame = nullptr; // Owned by the refresh tick
+static bool pendingDirty = false;      // Guarded by ledMux
+static portMUX_TYPE ledMux = portMUX_INITIALIZER_UNLOCKED;
+
+// Owned by the refresh tick
+static rmt_item32_t *items[2] = {nullptr, nullptr};
+static int backItems = 0;              // Buffer the next frame is encoded into
+static bool encodedWaiting = false;    // items[backItems] holds a frame not sent yet
+
+static LedDriverStats stats;
+static esp_timer_handle_t refreshTimer = nullptr;
+static WebServer *ledServer = nullptr;
+
+static void buildNibbleItems()
+{
+    rmt_item32_t bits[2];
+    bits[0].level0 = 1;
+    bits[0].duration0 = T0H_TICKS;
+    bits[0].level1 = 0;
+    bits[0].duration1 = T0L_TICKS;
+    bits[1].level0 = 1;
+    bits[1].duration0 = T1H_TICKS;
+    bits[1].level1 = 0;
+    bits[1].duration1 = T1L_TICKS;
+    for (int n = 0; n < 16; n++)
+    {
+         for (int bit = 0; bit < 4; bit++)
+         {
+             nibbleItems[n][bit] = bits[(n >> (3 - bit)) & 1]; // MSB first
+         }
+    }
+}
+
+// Frame bytes are RGB; the strip wants GRB, each channel through the lookup table.
+static void encode(const uint8_t *rgb, rmt_item32_t *out, uint16_t count)
+{
+    for (uint16_t i = 0; i < count; i++, rgb += 3)
+    {
+         const uint8_t wire[3] = {lut[rgb[1]], lut[rgb[0]], lut[rgb[2]]};
+         for (uint8_t byte : wire)
+         {
+             memcpy(out, nibbleItems[byte >> 4], sizeof(nibbleItems[0]));
+             memcpy(out + 4, nibbleItems[byte & 0x0F], sizeof(nibbleItems[0]));
+             out += 8;
+         }
+    }
+    out[-1].duration1 = LATCH_TICKS; // Stretch the last low so back-to-back frames still latch
+}
+
+static void onRefreshTick(void *)
+{
+    bool fresh = false;
+    portENTER_CRITICAL(&ledMux);
+    if (pendingDirty)
+    {
+         uint8_t *swap = pendingFrame;
+         pendingFrame = encodeFrame;
+         encodeFrame = swap;
+         pendingDirty = false;
+         fresh = true;
+    }
+    portEXIT_CRITICAL(&ledMux);
+
+    if (fresh)
+    {
+         if (encodedWaiting)
+         {
+             portENTER_CRITICAL(&ledMux);
+             stats.framesDropped++; // Encoded, but never made it onto the wire
+             portEXIT_CRITICAL(&ledMux);
+         }
+         int64_t start = esp_timer_get_time();
+         encode(encodeFrame, items[backItems], numLeds);
+         uint32_t elapsed = (uint32_t)(esp_timer_get_time() - start);
+         stats.framesEncoded++;
+         stats.encodeUsLast = elapsed;
+         stats.encodeUsTotal += elapsed;
+         stats.encodeUsMax = max(stats.encodeUsMax, elapsed);
+         encodedWaiting = true;
+    }
+    if (!encodedWaiting)
+    {
+         return;
+    }
+    if (rmt_wait_tx_done(LED_RMT_CHANNEL, 0) != ESP_OK)
+    {
+         stats.wireBusyTicks++;
+         return;
+    }
+    rmt_write_items(LED_RMT_CHANNEL, items[backItems], numLeds * ITEMS_PER_LED, false);
+    backItems ^= 1;
+    encodedWaiting = false;
+    stats.framesSent++;
+}
+
+static void handleLeds()
+{
+    JsonDocument doc;
+    doc["leds"] = numLeds;
+    doc["refresh_hz"] = LED_REFRESH_HZ;
+    doc["brightness"] = currentBrightness;
+    doc["gamma"] = LED_GAMMA;
+    doc["frames_sent"] = stats.framesSent;
+    doc["frames_dropped"] = stats.framesDropped;
+    doc["wire_busy_ticks"] = stats.wireBusyTicks;
+    JsonObject encodeUs = doc["encode_us"].to<JsonObject>();
+    encodeUs["last"] = stats.encodeUsLast;
+    encodeUs["max"] = stats.encodeUsMax;
+    encodeUs["mean"] = stats.framesEncoded > 0 ? (uint32_t)(stats.encodeUsTotal / stats.framesEncoded) : 0;
+    doc["encode_ns_per_led"] = stats.framesEncoded > 0 && numLeds > 0 ? (uint32_t)(stats.encodeUsTotal * 1000 / stats.framesEncoded / numLeds) : 0;
+
+    if (ledServer->arg("bench") == "1")
+    {
+         // Off-wire: encode a patterned frame into scratch buffers for each strip length
+         uint8_t *rgb = (uint8_t *)malloc(LED_DRIVER_MAX_LEDS * 3);
+         rmt_item32_t *scratch = (rmt_item32_t *)malloc(LED_DRIVER_MAX_LEDS * ITEMS_PER_LED * sizeof(rmt_item32_t));
+         if (rgb == nullptr || scratch == nullptr)
+         {
+             free(rgb);
+             free(scratch);
+             ledServer->send(503, "application/json", "{\"status\": \"error\", \"message\": \"No memory for the encoder bench.\"}");
+             return;
+         }
+         for (int i = 0; i < LED_DRIVER_MAX_LEDS * 3; i++)
+         {
+             rgb[i] = (uint8_t)(i * 37);
+         }
+         JsonArray bench = doc["bench"].to<JsonArray>();
+         for (uint16_t count : BENCH_COUNTS)
+         {
+             int64_t start = esp_timer_get_time();
+             for (int i = 0; i < LED_BENCH_ITERATIONS; i++)
+             {
+                 encode(rgb, scratch, count);
+             }
+             uint32_t us = (uint32_t)((esp_timer_get_time() - start) / LED_BENCH_ITERATIONS);
+             JsonObject entry = bench.add<JsonObject>();
+             entry["leds"] = count;
+             entry["encode_us"] = us;
+             entry["wire_us"] = count * 30 + 80; // 1.25 us per bit plus the latch
+         }
+         free(rgb);
+         free(scratch);
+    }
+
+    String body;
+    serializeJson(doc, body);
+    ledServer->send(200, "application/json", body);
+}
+
+// --- PUBLIC API ---
+
+bool ledDriverBegin(uint8_t pin, uint16_t count, uint8_t brightness)
+{
+    count = constrain(count, (uint16_t)1, (uint16_t)LED_DRIVER_MAX_LEDS);
+
+    rmt_config_t config = RMT_DEFAULT_CONFIG_TX((gpio_num_t)pin, LED_RMT_CHANNEL);
+    config.clk_div = RMT_CLK_DIV;
+    config.mem_block_num = LED_RMT_MEM_BLOCKS;
+    if (rmt_config(&config) != ESP_OK || rmt_driver_install(LED_RMT_CHANNEL, 0, 0) != ESP_OK)
+    {
+         LOG_ERROR("LED driver: RMT channel %d unavailable\n", (int)LED_RMT_CHANNEL);
+         return false;
+    }
+
+    // Internal SRAM: the RMT interrupt reads the items while flash writes may have the cache off
+    const uint32_t caps = MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT;
+    drawFrame = (uint8_t *)heap_caps_calloc(count * 3, 3, caps);
+    items[0] = (rmt_item32_t *)heap_caps_malloc(count * ITEMS_PER_LED * sizeof(rmt_item32_t), caps);
+    items[1] = (rmt_item32_t *)heap_caps_malloc(count * ITEMS_PER_LED * sizeof(rmt_item32_t), caps);
+    if (drawFrame == nullptr || items[0] == nullptr || items[1] == nullptr)
+    {
+         LOG_ERROR("LED driver: no memory for %u LEDs\n", (unsigned)count);
+         return false;
+    }
+    pendingFrame = drawFrame + count * 3;
+    encodeFrame = pendingFrame + count * 3;
+    numLeds = count;
+
+    buildNibbleItems();
+    ledSetBrightness(brightness);
+    pendingDirty = true; // All off
+
+    const esp_timer_create_args_t timerArgs = {
+        .callback = onRefreshTick,
+        .arg = nullptr,
+        .dispatch_method = ESP_TIMER_TASK,
+        .name = "led_refresh",
+        .skip_unhandled_events = true,
+    };
+    esp_timer_create(&timerArgs, &refreshTimer);
+    esp_timer_start_periodic(refreshTimer, 1000000 / LED_REFRESH_HZ);
+    return true;
+}
+
+uint16_t ledCount()
+{
+    return numLeds;
+}
+
+// Caller holds ledMux.
+static inline void drawPixel(uint16_t index, uint32_t color)
+{
+    uint8_t *px = drawFrame + index * 3;
+    px[0] = color >> 16;
+    px[1] = color >> 8;
+    px[2] = color;
+}
+
+void ledSetPixel(uint16_t index, uint32_t color)
+{
+    if (index >= numLeds)
+    {
+         return;
+    }
+    portENTER_CRITICAL(&ledMux);
+    drawPixel(index, color);
+    portEXIT_CRITICAL(&ledMux);
+}
+
+void ledFill(uint32_t color)
+{
+    // One lock for the whole strip, so a commit from the other writer never sees half a fill
+    portENTER_CRITICAL(&ledMux);
+    for (uint16_t i = 0; i < numLeds; i++)
+    {
+         drawPixel(i, color);
+    }
+    portEXIT_CRITICAL(&ledMux);
+}
+
+void ledCommit()
+{
+    if (numLeds == 0)
+    {
+         return;
+    }
+    portENTER_CRITICAL(&ledMux);
+    memcpy(pendingFrame, drawFrame, numLeds * 3);
+    if (pendingDirty)
+    {
+         stats.framesDropped++;
+    }
+    pendingDirty = true;
+    portEXIT_CRITICAL(&ledMux);
+}
+
+void ledSetBrightness(uint8_t brightness)
+{
+    currentBrightness = brightness;
+    lut[0] = 0;
+    for (int i = 1; i < 256; i++)
+    {
+         uint8_t v = (uint8_t)(powf(i / 255.0f, LED_GAMMA) * brightness + 0.5f);
+         lut[i] = (v == 0 && brightness > 0) ? 1 : v;
+    }
+}
+
+void setupLedDriver(WebServer &server)
+{
+    ledServer = &server;
+    server.on("/api/debug/leds", HTTP_GET, handleLeds);
+}
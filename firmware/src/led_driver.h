@@ -0,0 +1,65 @@
+#ifndef LED_DRIVER_H
+#define LED_DRIVER_H
+
+#include <Arduino.h>
+#include <WebServer.h>
+
+// --- LED DRIVER CONFIGURATION ---
+// WS2812-class strips driven by the RMT peripheral: frames are encoded into RMT items
+// ahead of time and sent by the driver's interrupt, so showing a frame never blocks.
+#define LED_DRIVER_MAX_LEDS 300        // Two encoded frames cost 192 bytes of internal SRAM per LED
+#define LED_REFRESH_HZ 100             // Committed frames go out on this tick (300 LEDs take 9 ms on the wire)
+#define LED_RMT_CHANNEL RMT_CHANNEL_0
+#define LED_RMT_MEM_BLOCKS 4           // All TX memory of the S3 on one channel: 4x fewer refill interrupts
+#define LED_GAMMA 2.2f                 // Applied before brightness; nonzero inputs never round to off
+#define LED_BENCH_ITERATIONS 20
+
+/**
+ * @brief Packs 8-bit channels into the 0xRRGGBB colors every LED call takes.
+ */
+inline uint32_t ledColor(uint8_t r, uint8_t g, uint8_t b)
+{
+    return ((uint32_t)r << 16) | ((uint32_t)g << 8) | b;
+}
+
+/**
+ * @brief Sets up the RMT channel on 'pin', the frame buffers for 'count' LEDs (clamped to
+ * LED_DRIVER_MAX_LEDS) and the LED_REFRESH_HZ refresh timer. Starts with every LED off.
+ * @return False if the RMT driver or the buffers could not be set up.
+ */
+bool ledDriverBegin(uint8_t pin, uint16_t count, uint8_t brightness);
+
+/**
+ * @brief Number of LEDs the driver was started with (0 before ledDriverBegin()).
+ */
+uint16_t ledCount();
+
+/**
+ * @brief Sets one LED in the frame being drawn. Nothing changes on the strip until ledCommit().
+ * The drawing calls and ledCommit() may be used from loop() and timer tasks alike.
+ */
+void ledSetPixel(uint16_t index, uint32_t color);
+
+/**
+ * @brief Sets every LED in the frame being drawn to one color.
+ */
+void ledFill(uint32_t color);
+
+/**
+ * @brief Hands the drawn frame to the refresh timer and returns at once. It is encoded and
+ * sent on the next tick; a frame committed again before that replaces it (counted as dropped).
+ */
+void ledCommit();
+
+/**
+ * @brief Rebuilds the gamma/brightness lookup table; applies from the next frame sent.
+ */
+void ledSetBrightness(uint8_t brightness);
+
+/**
+ * @brief Registers GET /api/debug/leds: frames sent/dropped and encode CPU time per frame and
+ * per LED. With ?bench=1 it also times the encoder for strip lengths up to LED_DRIVER_MAX_LEDS.
+ */
+void setupLedDriver(WebServer &server);
+
+#endif // LED_DRIVER_H
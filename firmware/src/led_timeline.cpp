@@ -0,0 +1,268 @@
+#include "led_timeline.h"
+#include "trace.h"
+#include "led_driver.h"
+#include "deferred_log.h"
+#include <esp_timer.h>
+#include <atomic>
+
+// ******************************************************
+// ** KEYFRAME LED TIMELINE (esp_timer driven) **
+// ******************************************************
+// The LED is no longer advanced from loop(). A one-shot esp_timer fires at each
+// keyframe boundary (and every TIMELINE_FADE_STEP_US during fades) and re-arms
+// itself. Boundaries are accumulated from the start time rather than from "now",
+// so a late callback never pushes the following phases back.
+// All LED writes happen on the esp_timer task; loop() only reads the phase counter.
+// Every LED of the strip shows the timeline color; frames go out on the driver's refresh tick.
+
+static esp_timer_handle_t timelineTimer = nullptr;
+static portMUX_TYPE timelineMux = portMUX_INITIALIZER_UNLOCKED;
+
+// Guarded by timelineMux
+static LedTimeline activeTimeline;
+static int64_t keyframeStartUs = 0;
+static uint8_t keyframeIndex = 0;
+static uint8_t playCount = 0;
+static uint32_t fadeFromColor = 0; // Color at the start of the current keyframe
+static uint32_t shownColor = 0;
+static bool restartPending = false;
+static uint32_t timeScale = 1;
+
+static std::atomic<bool> running(false);
+static std::atomic<int> phase(0);
+
+// Keyframe length on the wall clock, after the soak time scale.
+static int64_t keyframeMicros(const LedKeyframe &kf)
+{
+    return max<int64_t>((int64_t)kf.durationMs * 1000 / timeScale, 1);
+}
+
+static uint32_t lerpColor(uint32_t from, uint32_t to, uint32_t num, uint32_t den)
+{
+    uint32_t out = 0;
+    for (int shift = 0; shift <= 16; shift += 8)
+    {
+         int32_t a = (from >> shift) & 0xFF;
+         int32_t b = (to >> shift) & 0xFF;
+         out |= (uint32_t)(a + (b - a) * (int32_t)num / (int32_t)den) << shift;
+    }
+    return out;
+}
+
+static void onTimelineTick(void *)
+{
+    int64_t now = esp_timer_get_time();
+    bool phaseChanged = false;
+    bool restarted = false;
+    bool finished = false;
+    uint32_t color = 0;
+    int64_t nextUs = 0;
+
+    portENTER_CRITICAL(&timelineMux);
+    if (restartPending)
+    {
+         restartPending = false;
+         keyframeStartUs = now;
+         keyframeIndex = 0;
+         playCount = 0;
+         fadeFromColor = shownColor;
+         phaseChanged = true;
+         restarted = true;
+    }
+
+    // Step over every boundary that has passed (more than one if the timer task was held up).
+    while (running.load(std::memory_order_relaxed))
+    {
+         const LedKeyframe &kf = activeTimeline.keyframes[keyframeIndex];
+         int64_t endUs = keyframeStartUs + keyframeMicros(kf);
+         if (now < endUs)
+         {
+             break;
+         }
+         fadeFromColor = kf.color;
+         keyframeStartUs = endUs;
+         phaseChanged = true;
+         if (++keyframeIndex == activeTimeline.count)
+         {
+             keyframeIndex = 0;
+             if (++playCount >= activeTimeline.repeat)
+             {
+                  running.store(false, std::memory_order_release);
+                  finished = true;
+             }
+         }
+         if (!finished)
+         {
+             phase.fetch_add(1, std::memory_order_relaxed);
+         }
+    }
+
+    if (!finished)
+    {
+         const LedKeyframe &kf = activeTimeline.keyframes[keyframeIndex];
+         int64_t lengthUs = keyframeMicros(kf);
+         int64_t endUs = keyframeStartUs + lengthUs;
+         if (kf.fade)
+         {
+             color = lerpColor(fadeFromColor, kf.color, (uint32_t)(now - keyframeStartUs), (uint32_t)lengthUs);
+             nextUs = min(now + TIMELINE_FADE_STEP_US, endUs);
+         }
+         else
+         {
+             color = kf.color;
+             nextUs = endUs;
+         }
+         shownColor = color;
+    }
+    portEXIT_CRITICAL(&timelineMux);
+
+    if (phaseChanged)
+    {
+         if (!restarted)
+         {
+             TRACE_END("ledPhase");
+         }
+         if (!finished)
+         {
+             TRACE_BEGIN("ledPhase", phase.load(std::memory_order_relaxed));
+         }
+    }
+    if (finished)
+    {
+         return; // The last color stays on until the next job
+    }
+
+    ledFill(color);
+    ledCommit();
+
+    // Re-arm under the lock, so it cannot land between ledTimelineStart()'s stop and start;
+    // a restart that came in meanwhile has armed its own immediate tick.
+    portENTER_CRITICAL(&timelineMux);
+    if (!restartPending)
+    {
+         esp_timer_start_once(timelineTimer, (uint64_t)max<int64_t>(nextUs - esp_timer_get_time(), 1));
+    }
+    portEXIT_CRITICAL(&timelineMux);
+}
+
+// --- PUBLIC API ---
+
+void setupLedTimeline()
+{
+    const esp_timer_create_args_t timerArgs = {
+        .callback = onTimelineTick,
+        .arg = nullptr,
+        .dispatch_method = ESP_TIMER_TASK,
+        .name = "led_timeline",
+        .skip_unhandled_events = false,
+    };
+    esp_timer_create(&timerArgs, &timelineTimer);
+}
+
+void ledTimelineStart(const LedTimeline &timeline)
+{
+    if (timelineTimer == nullptr || timeline.count == 0)
+    {
+         return;
+    }
+
+    portENTER_CRITICAL(&timelineMux);
+    activeTimeline = timeline;
+    if (activeTimeline.repeat == 0)
+    {
+         activeTimeline.repeat = 1;
+    }
+    restartPending = true;
+    phase.store(0, std::memory_order_relaxed);
+    running.store(true, std::memory_order_release);
+
+    // Fire straight away on the timer task, which then owns the LED until the timeline ends.
+    // A tick already past its re-arm may still have armed the timer: stop and start again.
+    esp_err_t err = ESP_FAIL;
+    for (int attempt = 0; attempt < TIMELINE_START_ATTEMPTS && err != ESP_OK; attempt++)
+    {
+         esp_timer_stop(timelineTimer);
+         err = esp_timer_start_once(timelineTimer, 1);
+    }
+    portEXIT_CRITICAL(&timelineMux);
+
+    if (err != ESP_OK)
+    {
+         LOG_ERROR("LED timeline: restart timer failed (%d)\n", (int)err);
+    }
+}
+
+void ledTimelineSetTimeScale(uint32_t scale)
+{
+    timeScale = max<uint32_t>(scale, 1);
+}
+
+bool ledTimelineRunning()
+{
+    return running.load(std::memory_order_acquire);
+}
+
+int ledTimelinePhase()
+{
+    return phase.load(std::memory_order_relaxed);
+}
+
+bool ledTimelineParse(JsonVariantConst sequence, LedTimeline &out)
+{
+    out.count = 0;
+    out.repeat = constrain(sequence["repeat"] | 1, 1, MAX_TIMELINE_REPEAT);
+
+    for (JsonVariantConst kf : sequence["keyframes"].as<JsonArrayConst>())
+    {
+         if (out.count == MAX_TIMELINE_KEYFRAMES)
+         {
+             break;
+         }
+
+         uint32_t color;
+         if (kf["color"].is<const char *>())
+         {
+             const char *hex = kf["color"].as<const char *>();
+             color = strtoul(hex[0] == '#' ? hex + 1 : hex, nullptr, 16) & 0xFFFFFF;
+         }
+         else
+         {
+             color = (kf["color"] | 0UL) & 0xFFFFFF;
+         }
+
+         LedKeyframe &frame = out.keyframes[out.count++];
+         frame.color = color;
+         frame.durationMs = constrain(kf["ms"] | 300, MIN_KEYFRAME_MS, MAX_KEYFRAME_MS);
+         frame.fade = kf["fade"] | false;
+    }
+    return out.count > 0;
+}
+
+uint32_t ledTimelineDurationMs(const LedTimeline &timeline)
+{
+    uint32_t playMs = 0;
+    for (int i = 0; i < timeline.count; i++)
+    {
+         playMs += timeline.keyframes[i].durationMs;
+    }
+    return playMs * max<uint32_t>(timeline.repeat, 1);
+}
+
+void ledTimelineFit(LedTimeline &timeline, uint32_t maxTotalMs)
+{
+    uint32_t playMs = ledTimelineDurationMs(timeline) / max<uint32_t>(timeline.repeat, 1);
+    if (playMs == 0 || playMs * max<uint32_t>(timeline.repeat, 1) <= maxTotalMs)
+    {
+         return;
+    }
+    timeline.repeat = (uint8_t)constrain(maxTotalMs / playMs, (uint32_t)1, (uint32_t)MAX_TIMELINE_REPEAT);
+    if (playMs <= maxTotalMs)
+    {
+         return;
+    }
+    for (int i = 0; i < timeline.count; i++)
+    {
+         LedKeyframe &kf = timeline.keyframes[i];
+         kf.durationMs = max<uint32_t>((uint32_t)kf.durationMs * maxTotalMs / playMs, MIN_KEYFRAME_MS);
+    }
+}
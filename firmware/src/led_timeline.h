@@ -0,0 +1,78 @@
+#ifndef LED_TIMELINE_H
+#define LED_TIMELINE_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+
+// --- LED TIMELINE CONFIGURATION ---
+#define MAX_TIMELINE_KEYFRAMES 16     // Keyframes per sequence
+#define MAX_TIMELINE_REPEAT 20        // Upper bound on plays per job
+#define MIN_KEYFRAME_MS 10
+#define MAX_KEYFRAME_MS 10000
+#define TIMELINE_FADE_STEP_US 20000   // Fade refresh period (50 Hz)
+#define TIMELINE_START_ATTEMPTS 3     // Stop/start retries when a running tick re-armed the timer in between
+
+// One step of a sequence. A fade ramps from the previous keyframe's color to this one
+// over durationMs; otherwise the color is set at the start of the keyframe and held.
+struct LedKeyframe
+{
+    uint32_t color; // 0xRRGGBB, as returned by ledColor()
+    uint16_t durationMs;
+    bool fade;
+};
+
+struct LedTimeline
+{
+    LedKeyframe keyframes[MAX_TIMELINE_KEYFRAMES];
+    uint8_t count;
+    uint8_t repeat; // Times the keyframe list is played (>= 1)
+};
+
+/**
+ * @brief Creates the esp_timer that drives the LEDs. Call once after ledDriverBegin().
+ */
+void setupLedTimeline();
+
+/**
+ * @brief Starts playing a timeline from its first keyframe, replacing any running one.
+ * Phase boundaries are scheduled against the start time, so they do not drift with loop() load.
+ */
+void ledTimelineStart(const LedTimeline &timeline);
+
+/**
+ * @brief Runs every timeline 'scale' times faster than its nominal durations (1 = real time).
+ * Used by the soak build as its virtual clock.
+ */
+void ledTimelineSetTimeScale(uint32_t scale);
+
+/**
+ * @brief True while a timeline is playing.
+ */
+bool ledTimelineRunning();
+
+/**
+ * @brief Index of the keyframe being played, counted across repeats (0 for the first keyframe).
+ * loop() compares it with the last value it saw to report phase changes.
+ */
+int ledTimelinePhase();
+
+/**
+ * @brief Fills a timeline from a job's "sequence" object:
+ * {"repeat": 2, "keyframes": [{"color": "#FF0000", "ms": 300, "fade": false}, ...]}
+ * Colors may be "#RRGGBB" strings or integers. Durations and repeat are clamped to the limits above.
+ * @return false if the object has no usable keyframes.
+ */
+bool ledTimelineParse(JsonVariantConst sequence, LedTimeline &out);
+
+/**
+ * @brief Total play time of a timeline in ms (all keyframes, all repeats).
+ */
+uint32_t ledTimelineDurationMs(const LedTimeline &timeline);
+
+/**
+ * @brief Shortens a timeline to at most maxTotalMs: drops repeats first, then scales the
+ * keyframe durations down proportionally (never below MIN_KEYFRAME_MS).
+ */
+void ledTimelineFit(LedTimeline &timeline, uint32_t maxTotalMs);
+
+#endif // LED_TIMELINE_H
@@ -0,0 +1,190 @@
+#include "loop_profiler.h"
+#include <ArduinoJson.h>
+#include "metrics.h"
+#include "deferred_log.h"
+
+// ******************************************************
+// ** MAIN LOOP JITTER PROFILER (GET /api/debug/loop) **
+// ******************************************************
+// Each iteration is split into sub-steps by loopProfilerMark(). Iteration times
+// go into power-of-two buckets so p99 can be estimated without storing samples.
+
+struct StepStats
+{
+    uint32_t lastMicros;  // Time spent in the current iteration
+    uint32_t maxMicros;
+    uint64_t totalMicros;
+    uint32_t overruns;    // Iterations over budget where this step was the largest
+};
+
+static const char *STEP_NAMES[NUM_LOOP_STEPS] = {
+    "handle_client",
+    "dns",
+    "run_action",
+    "redraw",
+    "events",
+    "status_print",
+    "reconnect"
+};
+
+static WebServer *profilerServer = nullptr;
+static uint32_t loopBudgetMicros = LOOP_BUDGET_US;
+
+static StepStats steps[NUM_LOOP_STEPS];
+static uint32_t iterationBuckets[LOOP_PROFILER_BUCKETS];
+static uint32_t iterationCount = 0;
+static uint64_t iterationTotalMicros = 0;
+static uint32_t iterationMin = UINT32_MAX;
+static uint32_t iterationMax = 0;
+static uint32_t overrunCount = 0;
+
+static uint32_t iterationStart = 0;
+static uint32_t lastMark = 0;
+
+// Bucket i holds samples in [2^i, 2^(i+1)) microseconds.
+static int bucketFor(uint32_t micros)
+{
+    int b = micros ? 31 - __builtin_clz(micros) : 0;
+    return b < LOOP_PROFILER_BUCKETS ? b : LOOP_PROFILER_BUCKETS - 1;
+}
+
+// Upper bound of the bucket that contains the p-th percentile (p in 0..100).
+static uint32_t percentileMicros(uint32_t p)
+{
+    if (iterationCount == 0)
+    {
+         return 0;
+    }
+    uint32_t target = (uint32_t)(((uint64_t)iterationCount * p + 99) / 100);
+    uint32_t seen = 0;
+    for (int i = 0; i < LOOP_PROFILER_BUCKETS; i++)
+    {
+         seen += iterationBuckets[i];
+         if (seen >= target)
+         {
+             uint32_t upper = i >= 31 ? UINT32_MAX : (2u << i) - 1;
+             return min(upper, iterationMax);
+         }
+    }
+    return iterationMax;
+}
+
+static void resetStats()
+{
+    memset(steps, 0, sizeof(steps));
+    memset(iterationBuckets, 0, sizeof(iterationBuckets));
+    iterationCount = 0;
+    iterationTotalMicros = 0;
+    iterationMin = UINT32_MAX;
+    iterationMax = 0;
+    overrunCount = 0;
+}
+
+// --- PUBLIC API ---
+
+void loopProfilerBegin()
+{
+    iterationStart = micros();
+    lastMark = iterationStart;
+    for (int i = 0; i < NUM_LOOP_STEPS; i++)
+    {
+         steps[i].lastMicros = 0;
+    }
+}
+
+void loopProfilerMark(LoopStep step)
+{
+    uint32_t now = micros();
+    uint32_t elapsed = now - lastMark;
+    lastMark = now;
+
+    StepStats &s = steps[step];
+    s.lastMicros += elapsed;
+    s.totalMicros += elapsed;
+    if (s.lastMicros > s.maxMicros)
+    {
+         s.maxMicros = s.lastMicros;
+    }
+}
+
+void loopProfilerEnd()
+{
+    uint32_t elapsed = micros() - iterationStart;
+
+    iterationCount++;
+    iterationTotalMicros += elapsed;
+    iterationBuckets[bucketFor(elapsed)]++;
+    if (elapsed < iterationMin)
+    {
+         iterationMin = elapsed;
+    }
+    if (elapsed > iterationMax)
+    {
+         iterationMax = elapsed;
+    }
+    metricsObserve(HISTOGRAM_LOOP_ITERATION, elapsed);
+
+    if (elapsed <= loopBudgetMicros)
+    {
+         return;
+    }
+
+    // Blame the sub-step that consumed the most time in this iteration.
+    int culprit = 0;
+    for (int i = 1; i < NUM_LOOP_STEPS; i++)
+    {
+         if (steps[i].lastMicros > steps[culprit].lastMicros)
+         {
+             culprit = i;
+         }
+    }
+    steps[culprit].overruns++;
+    overrunCount++;
+    LOG_WARN("Loop overrun: %lu us (budget %lu us), %s took %lu us\n",
+             (unsigned long)elapsed, (unsigned long)loopBudgetMicros,
+             STEP_NAMES[culprit], (unsigned long)steps[culprit].lastMicros);
+}
+
+static void handleLoopStats()
+{
+    if (profilerServer->hasArg("budget_us"))
+    {
+         long budget = profilerServer->arg("budget_us").toInt();
+         if (budget > 0)
+         {
+             loopBudgetMicros = budget;
+         }
+    }
+    if (profilerServer->arg("reset") == "1")
+    {
+         resetStats();
+    }
+
+    JsonDocument doc;
+    doc["budget_us"] = loopBudgetMicros;
+    doc["iterations"] = iterationCount;
+    doc["overruns"] = overrunCount;
+    doc["min_us"] = iterationCount ? iterationMin : 0;
+    doc["mean_us"] = iterationCount ? (uint32_t)(iterationTotalMicros / iterationCount) : 0;
+    doc["p99_us"] = percentileMicros(99);
+    doc["max_us"] = iterationMax;
+
+    JsonObject stepsJson = doc["steps"].to<JsonObject>();
+    for (int i = 0; i < NUM_LOOP_STEPS; i++)
+    {
+         JsonObject s = stepsJson[STEP_NAMES[i]].to<JsonObject>();
+         s["max_us"] = steps[i].maxMicros;
+         s["mean_us"] = iterationCount ? (uint32_t)(steps[i].totalMicros / iterationCount) : 0;
+         s["overruns"] = steps[i].overruns;
+    }
+
+    String body;
+    serializeJson(doc, body);
+    profilerServer->send(200, "application/json", body);
+}
+
+void setupLoopProfiler(WebServer &server)
+{
+    profilerServer = &server;
+    server.on("/api/debug/loop", HTTP_GET, handleLoopStats);
+}
@@ -0,0 +1,48 @@
+#ifndef LOOP_PROFILER_H
+#define LOOP_PROFILER_H
+
+#include <Arduino.h>
+#include <WebServer.h>
+
+// --- LOOP PROFILER CONFIGURATION ---
+// Iterations longer than this are logged with the sub-step that ate the time.
+// Can be changed at runtime with GET /api/debug/loop?budget_us=N.
+#ifndef LOOP_BUDGET_US
+#define LOOP_BUDGET_US 10000
+#endif
+#define LOOP_PROFILER_BUCKETS 32 // Power-of-two latency buckets used for the p99 estimate
+
+// The sub-steps of loop(), in the order they run.
+enum LoopStep
+{
+    STEP_HANDLE_CLIENT = 0, // server.handleClient()
+    STEP_DNS,               // dnsServer.processNextRequest() (AP mode only)
+    STEP_RUN_ACTION,        // runAction(), including the completion POST
+    STEP_REDRAW,            // jobScreenPaint() for dirty widgets, render-ahead
+    STEP_EVENTS,            // pumpDeviceEvents() and the mDNS load refresh
+    STEP_STATUS_PRINT,      // printWifiStatus()
+    STEP_RECONNECT,         // WiFi health check / reconnect
+    NUM_LOOP_STEPS
+};
+
+/**
+ * @brief Marks the start of a loop() iteration.
+ */
+void loopProfilerBegin();
+
+/**
+ * @brief Attributes the time since the previous mark (or loopProfilerBegin) to 'step'.
+ */
+void loopProfilerMark(LoopStep step);
+
+/**
+ * @brief Closes the iteration: updates min/mean/p99/max and logs it if it broke the budget.
+ */
+void loopProfilerEnd();
+
+/**
+ * @brief Registers GET /api/debug/loop (stats as JSON; ?budget_us=N to change the budget, ?reset=1 to clear).
+ */
+void setupLoopProfiler(WebServer &server);
+
+#endif // LOOP_PROFILER_H
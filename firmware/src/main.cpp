@@ -3,12 +3,33 @@
 #include <HTTPClient.h>
 #include <Preferences.h>
 #include <DNSServer.h>
-#include <Adafruit_NeoPixel.h>
 #include <ArduinoJson.h>
 #include <Adafruit_GFX.h>
 #include <Adafruit_ST7789.h>
 #include <SPI.h>        // Required for explicit SPI bus setup
 #include "flag_drawing.h" // <<< NEW: Include for all flag drawing logic
+#include "device_events.h" // Server-sent event stream (GET /api/device/events)
+#include "metrics.h"       // Prometheus counters, histograms and gauges (GET /metrics)
+#include "trace.h"         // Chrome trace ring buffer (GET /api/debug/trace)
+#include "loop_profiler.h" // Per-step loop() timing and overrun attribution (GET /api/debug/loop)
+#include "flag_bench.h"    // Bytecode vs hand-written flag render timing (GET /api/debug/flags/bench)
+#include "deferred_log.h"  // Binary ring-buffer logger for the hot paths (LOG_INFO etc.)
+#include "flag_cache.h"    // Flags prerendered into PSRAM during boot
+#include "flag_pack.h"     // Flag art partition, memory-mapped (GET/POST /api/flags/pack)
+#include "led_timeline.h"  // esp_timer driven keyframe LED sequences
+#include "led_driver.h"    // Non-blocking RMT strip output, gamma/brightness table (GET /api/debug/leds)
+#include "soak.h"          // Synthetic long-run job driver (soak build only)
+#include "device_discovery.h" // mDNS capacity advertisement and GET /api/device/load
+#include "admission.h"     // Rate/size/busy screening before WebServer reads a request
+#include "pixel_kernels.h" // RGB565 span fill / scaled blit / byte swap (PIE on the S3)
+#include "pixel_bench.h"   // Kernel timings (GET /api/debug/pixels/bench)
+#include "job_screen.h"    // Retained job screen widgets, repainted per widget
+#include "job_latency.h"   // Per-stage job timestamps for the completion payload
+#include "job_pacing.h"    // Per-job sequence length and degradation tiers for backlog drain
+#include "portal.h"        // Precompressed captive portal pages and probe replies (AP mode)
+#include "mem_tiers.h"     // Internal SRAM pools and PSRAM arenas (GET /api/debug/memory)
+#include "span_canvas.h"   // GFX canvas over an arena frame
+#include <esp_timer.h>
 
 // --- DISPLAY PINS (Adjusted for user's wiring) ---
 #define TFT_CS 5  // Chip Select pin
@@ -23,83 +44,99 @@
 // This is the definition of the extern object declared in flag_drawing.h
 Adafruit_ST7789 tft = Adafruit_ST7789(TFT_CS, TFT_DC, TFT_MOSI, TFT_SCLK, TFT_RST);
 
+// --- RENDER-AHEAD BACK BUFFER ---
+// While a job's LED sequence plays, the next job (if the backend already sent it)
+// is rendered into a full-screen frame in the PSRAM frame arena. At the handoff the finished frame is
+// pushed to the panel in one window write, so drawing is off the critical path.
+const int SCREEN_WIDTH = 320;  // Rotation 1
+const int SCREEN_HEIGHT = 170;
+SpanCanvas16 *backBuffer = nullptr;
+bool backBufferReady = false;
+
 // --- NVS & AP CONFIGURATION CONSTANTS (Unchanged) ---
 Preferences preferences;
 const char *PREFS_NAMESPACE = "assistant_cfg";
 const char *PREF_SSID = "ssid_trinity";
 const char *PREF_PASS = "password";
+// Fast-boot cache: last successful association and IP configuration
+const char *PREF_BSSID = "bssid";
+const char *PREF_CHANNEL = "channel";
 const IPAddress apIP(192, 168, 4, 1);
 const IPAddress netMask(255, 255, 255, 0);
 const byte DNS_PORT = 53;
 DNSServer dnsServer;
 
 // --- DEVICE & NETWORK CONFIGURATION (Unchanged) ---
-const int LED_PIN = 48; // Built-in NeoPixel
-const int NUM_LEDS = 1;
-const int BLINK_DURATION_MS = 300; // Faster blink for 5 phases
+const int LED_PIN = 48; // Built-in NeoPixel, or the data line of an external strip
+const int NUM_LEDS = 1;  // Up to LED_DRIVER_MAX_LEDS
+const uint8_t LED_BRIGHTNESS = 50;
 const int HTTP_PORT = 80;
 
+// --- WIFI CONNECT TIMING ---
+const unsigned long FAST_CONNECT_TIMEOUT_MS = 3000;  // Directed connect using the cached BSSID/channel
+const unsigned long FULL_CONNECT_TIMEOUT_MS = 30000; // Full scan-and-associate fallback
+
 // --- STATUS REPORTING CONFIGURATION (Unchanged) ---
 const long STATUS_INTERVAL_MS = 5000;
 unsigned long lastStatusPrint = 0;
-const long RECONNECT_COOLDOWN_MS = 10000;
-unsigned long lastReconnectAttempt = 0;
+
+// --- EVENT-DRIVEN RECONNECT CONFIGURATION ---
+const uint32_t RECONNECT_BASE_DELAY_MS = 250;  // First retry after the immediate fast reconnect
+const uint32_t RECONNECT_MAX_DELAY_MS = 8000;  // Backoff ceiling
+const int PENDING_COMPLETION_SLOTS = 8;        // Completions held while the backend is unreachable
 
 // --- API ENDPOINTS (Unchanged) ---
 const char* ESP32_API_SECRET = "add_auth_key_here";
 const char *COMPLETION_URL = "https://api.circuitsmiles.dev/api/job/complete";
 
 // --- GLOBAL OBJECTS (Unchanged) ---
-WebServer server(HTTP_PORT);
-Adafruit_NeoPixel strip = Adafruit_NeoPixel(NUM_LEDS, LED_PIN, NEO_GRB + NEO_KHZ800);
+AdmissionWebServer server(HTTP_PORT); // Screens connections before the stock parser sees them
 
-// --- NON-BLOCKING ACTION CONTROL (Updated to ensure proper state management) ---
-// 5 Phases for the 5-color blink
+// --- NON-BLOCKING ACTION CONTROL ---
+// The LED sequence itself plays on an esp_timer (led_timeline.cpp); loop() only
+// watches it to report phase changes and to send the completion once it ends.
 enum ActionState
 {
     ACTION_IDLE = 0,
-    ACTION_BLINK_1, // Red
-    ACTION_BLINK_2, // Orange
-    ACTION_BLINK_3, // Yellow
-    ACTION_BLINK_4, // Green
-    ACTION_BLINK_5, // Blue
+    ACTION_RUNNING, // Timeline playing
     ACTION_COMPLETED
 };
 
 ActionState currentActionState = ACTION_IDLE;
-unsigned long actionStartTime = 0;
-uint32_t actionOriginalColor = 0;
-bool jobDataChanged = true; // New flag to trigger initial draw and change updates
-
-// Array of 5 colors for the blink sequence (R, O, Y, G, B)
-const uint32_t BLINK_COLORS[] = {
-    strip.Color(255, 0, 0),   // 1. Red
-    strip.Color(255, 128, 0), // 2. Orange
-    strip.Color(255, 255, 0), // 3. Yellow
-    strip.Color(0, 255, 0),   // 4. Green
-    strip.Color(0, 0, 255)     // 5. Blue
-};
-const int NUM_BLINK_COLORS = 5;
-
-// --- JOB DATA STRUCTURE (Unchanged) ---
-struct JobData
-{
-    String name;
-    String country;
-    String flag; // Country code (e.g., "FR", "DE", "US")
+int reportedLedPhase = 0;
+PacingMode currentJobMode = PACING_NORMAL; // Mode the running job's sequence was fitted to
+unsigned long jobStartedAt = 0;
+unsigned long lastJobDrawAt = 0; // When a job was last put on the job screen
+bool screenBehind = false;       // Latest-wins tier held the current job back from the screen
+bool jobQueued = false; // A next job is waiting for the current sequence to end
+const int DEVICE_PIPELINE_DEPTH = 2; // Jobs held at once: the running one plus one queued (advertised over mDNS)
+
+// Sequence used when a job does not bring its own: 300 ms each of red, orange, yellow, green, blue.
+const LedTimeline DEFAULT_BLINK_TIMELINE = {
+    {
+        {ledColor(255, 0, 0), 300, false},
+        {ledColor(255, 128, 0), 300, false},
+        {ledColor(255, 255, 0), 300, false},
+        {ledColor(0, 255, 0), 300, false},
+        {ledColor(0, 0, 255), 300, false},
+    },
+    5, // keyframes
+    1  // repeat
 };
 
+// --- JOB DATA (struct and copy helpers in job_data.h) ---
 JobData currentJobData = {"Waiting", "for next", "JOB"}; // Default state
+JobData queuedJobData;        // Accepted while busy; starts at the handoff
+LedTimeline queuedTimeline;
 
 // --- FUNCTION PROTOTYPES (Updated) ---
 void setLEDColor(uint8_t r, uint8_t g, uint8_t b);
 void setLEDColor(uint32_t color);
-void startActionSequence(const JobData &data);
+void startActionSequence(const JobData &data, const LedTimeline &timeline);
 void runAction();
 void handleStartBlink();
-bool notifyServerOfCompletion();
+bool notifyServerOfCompletion(const char *jobName, JobLatency &latency);
 void printWifiStatus();
-void drawJobData(const JobData &data);
 // drawFlag is now prototyped in flag_drawing.h
 
 // --- CUSTOM FLAG DRAWING LOGIC (REMOVED - now in flag_drawing.cpp) ---
@@ -129,265 +166,8 @@ void setupTFT()
     tft.println("-------------------------");
 }
 
-// Helper function to draw text, wrapping it to the next line if it exceeds max length.
-// Returns the final Y position after printing.
-int wrapAndPrintText(const String& text, int x, int y, int maxCharsPerLine, int lineHeight, uint16_t color) {
-    tft.setTextColor(color);
-    tft.setTextSize(2);
-    
-    // Check if wrapping is needed
-    if (text.length() <= maxCharsPerLine) {
-        tft.setCursor(x, y);
-        tft.print(text);
-        return y + lineHeight; // Advance Y by one line height
-    }
-
-    // --- Word Wrapping Logic ---
-    String line1 = "";
-    int lastSpaceIndex = -1;
-    
-    // Iterate through the string, finding the best place to break before maxCharsPerLine
-    for (int i = 0; i < text.length(); i++) {
-        char currentChar = text.charAt(i);
-
-        // Track the position of the last space encountered
-        if (currentChar == ' ') {
-            lastSpaceIndex = i;
-        }
-
-        // Check if adding the next character would exceed the limit
-        if (i == maxCharsPerLine) {
-            
-            if (lastSpaceIndex != -1) {
-                // Break at the last full space found before the limit
-                line1 = text.substring(0, lastSpaceIndex);
-            } else {
-                // No space found (very long single word), force break at max length
-                line1 = text.substring(0, maxCharsPerLine);
-                lastSpaceIndex = maxCharsPerLine;
-            }
-            
-            // Print Line 1
-            tft.setCursor(x, y);
-            tft.print(line1);
-            y += lineHeight; // Advance Y to the next line
-            
-            // Calculate Line 2: start from after the break point (plus one for the space if broken by space)
-            int startOfLine2 = (lastSpaceIndex != -1 && text.charAt(lastSpaceIndex) == ' ') ? lastSpaceIndex + 1 : lastSpaceIndex;
-            String line2 = text.substring(startOfLine2);
-
-            // Print Line 2 (trimmed to fit, if necessary)
-            tft.setCursor(x, y);
-            // This handles names longer than 30 characters by just showing the start of the remainder
-            tft.print(line2.substring(0, maxCharsPerLine)); 
-            
-            return y + lineHeight; // Advance Y for the final position
-        }
-    }
-    
-    // Fallback: should not be reached if length check worked, but good practice
-    tft.setCursor(x, y);
-    tft.print(text);
-    return y + lineHeight;
-}
-
-
-void drawJobData(const JobData &data)
-{
-    tft.fillScreen(ST77XX_BLACK);
-
-    // The screen is 320 pixels wide and 170 pixels tall (Rotation 1)
-    int margin = 5;
-    int lineH = 20;
-    // --- MODIFICATION: CHANGED FROM 15 TO 14 CHARACTERS ---
-    const int MAX_CHARS_PER_LINE = 14; 
-
-    tft.fillScreen(ST77XX_BLACK);
-    int halfWidth = tft.width() / 2; // 160 pixels
-
-    // Title on the left
-    tft.setTextSize(2);
-    tft.setCursor(margin, margin);
-    tft.setTextColor(ST77XX_CYAN);
-    tft.println("INCOMING JOB:");
-
-    // Separator line
-    tft.drawFastVLine(halfWidth, 0, tft.height(), tft.color565(50, 50, 50));
-
-    // Text Block (Left Side - 160 wide)
-    int yPos = margin + lineH + 5;
-    tft.setTextSize(2);
-    tft.setTextColor(ST77XX_WHITE);
-    tft.setCursor(margin, yPos);
-    tft.print("Name: ");
-
-    yPos += lineH; // Move to the line below "Name: "
-
-    // yPos is updated by the helper function to the final position after printing one or two lines
-    yPos = wrapAndPrintText(data.name, margin, yPos, MAX_CHARS_PER_LINE, lineH, ST77XX_YELLOW);
-
-    yPos += 5; // Extra spacing before the next section
-    tft.setTextSize(2);
-    tft.setCursor(margin, yPos);
-    tft.setTextColor(ST77XX_WHITE);
-    tft.print("Origin:");
-
-    yPos += lineH;
-    tft.setTextSize(2);
-    tft.setCursor(margin, yPos);
-    tft.setTextColor(ST77XX_YELLOW);
-    
-    // Apply word wrapper for country/origin
-    yPos = wrapAndPrintText(data.country, margin, yPos, MAX_CHARS_PER_LINE, lineH, ST77XX_YELLOW);
-
-
-    yPos += 5; // Add a little space before CODE
-    tft.setTextSize(1);
-    tft.setCursor(margin, yPos);
-    tft.setTextColor(ST77XX_RED);
-    tft.print("CODE: ");
-    tft.setTextColor(ST77XX_ORANGE);
-    tft.print(data.flag);
-
-    // Flag Block (Right Side - 160 wide) 
-    // Draw the 32x20 flag scaled up by 4x (128x80 pixels total)
-    int flagScale = 4;
-    int flagW = FLAG_W * flagScale; // 128
-    int flagH = FLAG_H * flagScale; // 80
-
-    // Centered in the right half: 160 + (160 - 128) / 2 = 176
-    int flagX = halfWidth + (halfWidth - flagW) / 2; // 176
-    // Centered vertically in the available space
-    int flagY = (tft.height() - flagH) / 2; // (170 - 80) / 2 = 45
-
-    drawFlag(data.flag, flagX, flagY, flagScale); // Uses the function from flag_drawing.cpp
-
-    // Status text at the bottom
-    tft.setTextSize(1);
-    tft.setCursor(margin, tft.height() - 15);
-    tft.setTextColor(ST77XX_GREEN);
-
-    // Display the current status dynamically
-    if (currentActionState == ACTION_IDLE)
-    {
-        tft.print("STATUS: READY. AWAITING TRANSMISSION.");
-    }
-    else
-    {
-        tft.print("STATUS: PROCESSING... LED BLINK x5");
-    }
-}
-
-// ... [CONFIG_HTML remains the same] ...
-const char CONFIG_HTML[] = R"raw(
-<!DOCTYPE html>
-<html>
-<head>
-<title>Trinity Wi-Fi Setup</title>
-<meta name="viewport" content="width=device-width, initial-scale=1">
-<style>
- /* Base styles - Dark, Grid-like background */
- body { 
- font-family: 'Courier New', monospace; 
- background-color: #0d0d0d; 
- color: #00ff00; /* Neon Green */
- margin: 0; 
- padding: 20px; 
- /* Subtle grid pattern for sci-fi look */
- background-image: linear-gradient(0deg, transparent 24%, rgba(0, 255, 0, 0.05) 25%, rgba(0, 255, 0, 0.05) 26%, transparent 27%, transparent 74%, rgba(0, 255, 0, 0.05) 75%, rgba(0, 255, 0, 0.05) 76%, transparent 77%, transparent), linear-gradient(90deg, transparent 24%, rgba(0, 255, 0, 0.05) 25%, rgba(0, 255, 0, 0.05) 26%, transparent 27%, transparent 74%, rgba(0, 255, 0, 0.05) 75%, rgba(0, 255, 0, 0.05) 76%, transparent 77%, transparent);
- background-size: 50px 50px;
- }
- /* Container - Dark metallic panel */
- .container { 
- max-width: 400px; 
- margin: 60px auto 0; 
- background: rgba(34, 34, 34, 0.95); /* Dark Gray/Black */
- padding: 30px; 
- border-radius: 10px; 
- border: 2px solid #00ccff; /* Sci-fi Blue Border */
- box-shadow: 0 0 20px rgba(0, 255, 0, 0.5); /* Neon Green Glow */
- }
- h1 { 
- color: #00ff00; 
- text-align: center; 
- text-shadow: 0 0 10px #00ff00; 
- margin-bottom: 25px;
- }
- label {
- display: block;
- margin-top: 15px;
- color: #00ccff; /* Light Blue/Cyan */
- font-size: 1.1em;
- }
- /* Input fields - Look like glowing data ports */
- input[type="text"], input[type="password"] { 
- width: 100%; 
- padding: 12px; 
- margin: 8px 0 20px 0; 
- display: inline-block; 
- border: 1px solid #00ccff; /* Sci-fi Blue Border */
- background-color: #111111; /* Very dark input background */
- color: #00ff00; /* Neon Green text input */
- border-radius: 4px; 
- box-sizing: border-box; 
- box-shadow: 0 0 5px rgba(0, 255, 0, 0.3);
- transition: box-shadow 0.3s, border-color 0.3s;
- }
- input[type="text"]:focus, input[type="password"]:focus {
- border-color: #00ffff;
- box-shadow: 0 0 10px #00ffff;
- outline: none;
- }
- /* Submit button - Bright green action element */
- input[type="submit"] { 
- background-color: #00ff00; 
- color: #111111; /* Dark text on bright button */
- padding: 14px 20px; 
- margin: 15px 0 8px 0; 
- border: none; 
- border-radius: 4px; 
- cursor: pointer; 
- width: 100%; 
- font-size: 16px; 
- font-weight: bold;
- box-shadow: 0 0 10px rgba(0, 255, 0, 0.7); /* Stronger glow */
- transition: background-color 0.3s, box-shadow 0.3s;
- }
- input[type="submit"]:hover { 
- background-color: #33ff33; 
- box-shadow: 0 0 15px #00ff00; 
- }
- .note { 
- color: #aaaaaa; 
- font-size: 0.9em; 
- text-align: center; 
- margin-top: 25px; 
- }
-</style>
-</head>
-<body>
-<div class="container">
-<h1>TRINITY PROTOCOL SETUP</h1>
-<form method="get" action="/save">
- <label for="ssid">NETWORK SSID:</label>
- <input type="text" id="ssid" name="ssid" required>
-
- <label for="pass">SECURITY KEY:</label>
- <input type="password" id="pass" name="pass">
-
- <input type="submit" value="ESTABLISH CONNECTION">
-</form>
-<div class="note">// DATA WILL BE ENCRYPTED AND STORED IN NVS FLASH MEMORY. //</div>
-</div>
-</body>
-</html>
-)raw";
-// --- WEB SERVER HANDLERS (for AP Portal - Unchanged) ---
-void handleRoot()
-{
-    server.send(200, "text/html", CONFIG_HTML);
-}
-
+// --- WEB SERVER HANDLERS (for AP Portal) ---
+// The pages themselves are in firmware/portal/, served precompressed by portal.cpp
 void handleSave()
 {
     String ssid = server.arg("ssid");
@@ -399,13 +179,14 @@ void handleSave()
          preferences.putString(PREF_PASS, password);
          preferences.end();
          Serial.println("Credentials saved securely to NVS. Rebooting...");
-         server.send(200, "text/html", "<body style='background-color:#0d0d0d; color:#00ff00; font-family: monospace; text-align:center; padding-top: 100px;'><h1>TRANSMISSION SUCCESSFUL</h1><p>Credentials saved. Initiating system reboot and connection attempt...</p></body>");
+         flushDeferredLog();
+         portalSendAsset("/saved.html", 200);
          delay(3000);
          ESP.restart();
     }
     else
     {
-         server.send(400, "text/html", "<body style='background-color:#0d0d0d; color:red; font-family: monospace; text-align:center; padding-top: 100px;'><h1>ERROR: INPUT FAILED</h1><p>SSID cannot be empty. Check protocol parameters.</p></body>");
+         portalSendAsset("/save_error.html", 400);
     }
 }
 bool startAPPortal()
@@ -419,67 +200,460 @@ bool startAPPortal()
     Serial.print("AP IP: ");
     Serial.println(WiFi.softAPIP());
     dnsServer.start(DNS_PORT, "*", apIP);
-    server.on("/", handleRoot);
+    setupPortal(server); // Pages, probe redirects, everything else redirected to the portal
     server.on("/save", handleSave);
     server.begin();
     setLEDColor(0, 50, 50);
     return false;
 }
-bool connectWiFi()
+// --- FAST-BOOT WIFI CACHE ---
+// The last successful BSSID and channel are stored next to the credentials so the next
+// boot can skip the channel scan. The address still comes from DHCP: a cached lease
+// reused as a static IP outlives the router's lease and ends in an address conflict.
+struct WiFiCache
+{
+    bool valid;
+    uint8_t bssid[6];
+    uint8_t channel;
+};
+
+WiFiCache loadWiFiCache()
+{
+    WiFiCache cache = {};
+    preferences.begin(PREFS_NAMESPACE, true);
+    bool hasBssid = preferences.getBytes(PREF_BSSID, cache.bssid, sizeof(cache.bssid)) == sizeof(cache.bssid);
+    cache.channel = preferences.getUChar(PREF_CHANNEL, 0);
+    preferences.end();
+    cache.valid = hasBssid && cache.channel > 0;
+    return cache;
+}
+
+WiFiCache linkCache = {}; // RAM copy of the last good association, used by the reconnect path
+
+// Stores the current association. Only writes when something changed, to spare the flash.
+void saveWiFiCache()
+{
+    WiFiCache current = {};
+    const uint8_t *bssid = WiFi.BSSID();
+    if (bssid == nullptr)
+    {
+         return;
+    }
+    memcpy(current.bssid, bssid, sizeof(current.bssid));
+    current.channel = WiFi.channel();
+    current.valid = true;
+    linkCache = current;
+
+    WiFiCache stored = loadWiFiCache();
+    if (stored.valid && memcmp(stored.bssid, current.bssid, sizeof(current.bssid)) == 0 &&
+        stored.channel == current.channel)
+    {
+         return;
+    }
+
+    preferences.begin(PREFS_NAMESPACE, false);
+    preferences.putBytes(PREF_BSSID, current.bssid, sizeof(current.bssid));
+    preferences.putUChar(PREF_CHANNEL, current.channel);
+    preferences.end();
+    Serial.printf("WiFi fast-boot cache updated (channel %u).\n", current.channel);
+}
+
+// --- BOOT PIPELINE: BACKGROUND WIFI ASSOCIATION ---
+// WiFi.begin() returns immediately and the radio associates on its own task, so
+// setup() only kicks it off. loop() advances this state machine and starts the
+// job server the moment the link is up, while the display and flag cache are
+// initialised in parallel.
+enum WiFiConnectPhase
+{
+    WIFI_CONNECT_IDLE = 0, // Not started, or handed over to the AP portal
+    WIFI_CONNECT_FAST,     // Directed connect with the cached BSSID/channel
+    WIFI_CONNECT_FULL,     // Full scan-and-associate with DHCP
+    WIFI_CONNECT_DONE
+};
+
+WiFiConnectPhase wifiConnectPhase = WIFI_CONNECT_IDLE;
+unsigned long wifiConnectStart = 0;
+unsigned long wifiPhaseStart = 0;
+bool wifiFastPath = false;
+String wifiSsid;
+String wifiPass;
+
+void beginFullScanConnect()
+{
+    WiFi.begin(wifiSsid.c_str(), wifiPass.c_str());
+    wifiConnectPhase = WIFI_CONNECT_FULL;
+    wifiPhaseStart = millis();
+}
+
+/**
+ * @brief Starts association in the background. Returns false when the AP portal was started instead.
+ */
+bool beginWiFiConnect()
 {
     preferences.begin(PREFS_NAMESPACE, true);
-    String ssid = preferences.getString(PREF_SSID, "");
-    String pass = preferences.getString(PREF_PASS, "");
+    wifiSsid = preferences.getString(PREF_SSID, "");
+    wifiPass = preferences.getString(PREF_PASS, "");
     preferences.end();
-    if (ssid.length() == 0)
+    if (wifiSsid.length() == 0)
     {
          return startAPPortal();
     }
     WiFi.mode(WIFI_MODE_STA);
-    WiFi.begin(ssid.c_str(), pass.c_str());
     setLEDColor(50, 50, 0);
-    unsigned long startTime = millis();
-    while (WiFi.status() != WL_CONNECTED)
+    wifiConnectStart = millis();
+
+    // Directed connect: known AP and channel, no scan (the address still comes from DHCP)
+    WiFiCache cache = loadWiFiCache();
+    if (cache.valid)
+    {
+         WiFi.begin(wifiSsid.c_str(), wifiPass.c_str(), cache.channel, cache.bssid);
+         wifiConnectPhase = WIFI_CONNECT_FAST;
+         wifiPhaseStart = millis();
+    }
+    else
+    {
+         beginFullScanConnect();
+    }
+    return true;
+}
+
+/**
+ * @brief Advances the connect state machine from loop(). Returns true once the link is up.
+ */
+bool serviceWiFiConnect()
+{
+    if (wifiConnectPhase == WIFI_CONNECT_DONE)
+    {
+         return true;
+    }
+    if (wifiConnectPhase == WIFI_CONNECT_IDLE)
+    {
+         return false;
+    }
+
+    if (WiFi.status() == WL_CONNECTED)
+    {
+         wifiFastPath = wifiConnectPhase == WIFI_CONNECT_FAST;
+         wifiConnectPhase = WIFI_CONNECT_DONE;
+         unsigned long connectMs = millis() - wifiConnectStart;
+         metricsSetGauge(GAUGE_BOOT_WIFI_CONNECT_MS, connectMs);
+         metricsSetGauge(GAUGE_BOOT_FAST_CONNECT, wifiFastPath ? 1 : 0);
+         setLEDColor(0, 0, 0);
+         Serial.printf("Boot stage wifi: connected in %lu ms (%s).\n", connectMs, wifiFastPath ? "fast path" : "full scan");
+         saveWiFiCache();
+         return true;
+    }
+
+    unsigned long elapsed = millis() - wifiPhaseStart;
+    if (wifiConnectPhase == WIFI_CONNECT_FAST && elapsed > FAST_CONNECT_TIMEOUT_MS)
+    {
+         Serial.println("Fast connect failed. Falling back to full scan...");
+         WiFi.disconnect();
+         beginFullScanConnect();
+    }
+    else if (wifiConnectPhase == WIFI_CONNECT_FULL && elapsed > FULL_CONNECT_TIMEOUT_MS)
+    {
+         Serial.println("\nConnection attempt failed. Launching AP portal...");
+         wifiConnectPhase = WIFI_CONNECT_IDLE;
+         startAPPortal();
+    }
+    return false;
+}
+
+// --- EVENT-DRIVEN RECONNECT ---
+// Once the job server is up, connectivity is owned by WiFi event callbacks
+// instead of loop() polling. A disconnect triggers an immediate directed
+// reconnect on the cached BSSID/channel; if that fails, retries back off
+// exponentially with jitter (alternating with a full scan in case the AP moved).
+// Callbacks run on the WiFi event task, so they only touch the flags below and
+// loop() does the reporting.
+volatile bool wifiLinkUp = false;
+volatile bool outageEnded = false;
+volatile unsigned long outageStartMs = 0;
+volatile unsigned long lastOutageMs = 0;
+volatile uint32_t reconnectAttempt = 0;
+volatile bool reconnectPending = false;
+esp_timer_handle_t reconnectTimer = nullptr;
+uint32_t outageCount = 0;
+uint64_t totalOutageMs = 0;
+
+// Even attempts use the cached AP and channel, odd attempts rescan.
+void attemptReconnect()
+{
+    uint32_t attempt = reconnectAttempt++;
+    WiFiCache cache = linkCache;
+    if (cache.valid && attempt % 2 == 0)
+    {
+         WiFi.begin(wifiSsid.c_str(), wifiPass.c_str(), cache.channel, cache.bssid);
+    }
+    else
+    {
+         WiFi.begin(wifiSsid.c_str(), wifiPass.c_str());
+    }
+}
+
+void onReconnectTimer(void *)
+{
+    reconnectPending = false;
+    if (!wifiLinkUp)
+    {
+         attemptReconnect();
+    }
+}
+
+void scheduleReconnect()
+{
+    if (reconnectPending || reconnectTimer == nullptr)
+    {
+         return;
+    }
+    uint32_t shift = min<uint32_t>(reconnectAttempt, 5);
+    uint32_t delayMs = min<uint32_t>(RECONNECT_BASE_DELAY_MS << shift, RECONNECT_MAX_DELAY_MS);
+    // +/-25% jitter so a room full of boards does not hammer the AP in lockstep
+    delayMs = delayMs * 3 / 4 + esp_random() % (delayMs / 2 + 1);
+    reconnectPending = true;
+    esp_timer_start_once(reconnectTimer, (uint64_t)delayMs * 1000);
+}
+
+void onWiFiDisconnected(WiFiEvent_t event, WiFiEventInfo_t info)
+{
+    if (wifiConnectPhase != WIFI_CONNECT_DONE)
+    {
+         return; // The boot pipeline owns the first association
+    }
+    if (wifiLinkUp)
+    {
+         // Link just dropped: start the outage clock and reconnect right away on the known channel
+         wifiLinkUp = false;
+         outageStartMs = millis();
+         reconnectAttempt = 0;
+         LOG_WARN("WiFi disconnected (reason %d). Fast reconnect...\n", info.wifi_sta_disconnected.reason);
+         attemptReconnect();
+    }
+    else
+    {
+         // A retry failed: back off before the next one
+         scheduleReconnect();
+    }
+}
+
+void onWiFiGotIP(WiFiEvent_t event, WiFiEventInfo_t info)
+{
+    if (wifiConnectPhase != WIFI_CONNECT_DONE || wifiLinkUp)
+    {
+         return;
+    }
+    lastOutageMs = millis() - outageStartMs;
+    wifiLinkUp = true;
+    outageEnded = true;
+}
+
+/**
+ * @brief Hands reconnection over to WiFi events. Called once the boot pipeline has associated.
+ */
+void setupWiFiEvents()
+{
+    WiFi.setAutoReconnect(false); // We own reconnection and its backoff
+    const esp_timer_create_args_t timerArgs = {
+        .callback = onReconnectTimer,
+        .arg = nullptr,
+        .dispatch_method = ESP_TIMER_TASK,
+        .name = "wifi_reconnect",
+        .skip_unhandled_events = true,
+    };
+    esp_timer_create(&timerArgs, &reconnectTimer);
+    WiFi.onEvent(onWiFiDisconnected, ARDUINO_EVENT_WIFI_STA_DISCONNECTED);
+    WiFi.onEvent(onWiFiGotIP, ARDUINO_EVENT_WIFI_STA_GOT_IP);
+    wifiLinkUp = WiFi.status() == WL_CONNECTED;
+}
+
+// --- BUFFERED COMPLETIONS ---
+// Jobs that finish while the backend is unreachable keep their completion here and
+// are reported in order once the link is back, so the backend queue does not stall.
+// While anything is buffered new completions queue behind it, and failed sends back
+// off on the reconnect schedule so a dead backend does not stall every idle loop().
+struct PendingCompletion
+{
+    char jobName[64];
+    JobLatency latency;
+};
+
+PendingCompletion pendingCompletions[PENDING_COMPLETION_SLOTS];
+int pendingHead = 0;
+int pendingCount = 0;
+uint32_t completionRetryAttempt = 0;
+unsigned long completionRetryAt = 0; // No buffered completion is sent before this millis()
+
+// Pushes the next buffered send back by the same doubling delay the WiFi reconnect uses.
+void backOffCompletionRetry()
+{
+    uint32_t shift = min<uint32_t>(completionRetryAttempt++, 5);
+    completionRetryAt = millis() + min<uint32_t>(RECONNECT_BASE_DELAY_MS << shift, RECONNECT_MAX_DELAY_MS);
+}
+
+void bufferCompletion(const char *jobName, const JobLatency &latency)
+{
+    if (pendingCount == PENDING_COMPLETION_SLOTS)
     {
-         if (millis() - startTime > 30000)
+         // Drop the oldest; the newest completion is what unblocks the backend
+         pendingHead = (pendingHead + 1) % PENDING_COMPLETION_SLOTS;
+         pendingCount--;
+    }
+    PendingCompletion &slot = pendingCompletions[(pendingHead + pendingCount) % PENDING_COMPLETION_SLOTS];
+    strlcpy(slot.jobName, jobName, sizeof(slot.jobName));
+    slot.latency = latency;
+    pendingCount++;
+}
+
+/**
+ * @brief Reports finished outages and sends at most one buffered completion per loop() iteration,
+ * backing off after each failed send.
+ */
+void serviceWiFiLink()
+{
+    if (outageEnded)
+    {
+         outageEnded = false;
+         outageCount++;
+         totalOutageMs += lastOutageMs;
+         metricsSetGauge(GAUGE_WIFI_LAST_OUTAGE_MS, lastOutageMs);
+         metricsSetGauge(GAUGE_WIFI_OUTAGES, outageCount);
+         LOG_INFO("WiFi restored after %lu ms outage (%lu attempts, %lu outages, %lu ms total).\n",
+                  (unsigned long)lastOutageMs, (unsigned long)reconnectAttempt, (unsigned long)outageCount, (unsigned long)totalOutageMs);
+         completionRetryAttempt = 0; // Link is back: try the backend straight away
+         completionRetryAt = millis();
+    }
+
+    if (wifiLinkUp && pendingCount > 0 && currentActionState == ACTION_IDLE && (long)(millis() - completionRetryAt) >= 0)
+    {
+         PendingCompletion &slot = pendingCompletions[pendingHead];
+         if (notifyServerOfCompletion(slot.jobName, slot.latency))
+         {
+             publishDeviceEvent(EVENT_COMPLETION_SENT, 1, slot.jobName);
+             pendingHead = (pendingHead + 1) % PENDING_COMPLETION_SLOTS;
+             pendingCount--;
+             completionRetryAttempt = 0;
+         }
+         else
          {
-             Serial.println("\nConnection attempt failed. Launching AP portal...");
-             return startAPPortal();
+             metricsIncrement(COUNTER_COMPLETION_FAILURES);
+             backOffCompletionRetry();
          }
-         delay(500);
     }
-    setLEDColor(0, 0, 0);
-    Serial.println("WiFi Connected.");
-    return true;
 }
 
 // --- HTTP HANDLERS & CORE LOGIC (Unchanged) ---
 
 void setLEDColor(uint8_t r, uint8_t g, uint8_t b)
 {
-    strip.setPixelColor(0, strip.Color(r, g, b));
-    strip.show();
+    setLEDColor(ledColor(r, g, b));
 }
 
 void setLEDColor(uint32_t color)
 {
-  strip.setPixelColor(0, color);
-  strip.show();
+    ledFill(color);
+    ledCommit(); // Goes out on the next refresh tick; never blocks
 }
 
 // --- ACTION LOGIC (Unchanged) ---
-void startActionSequence(const JobData &data)
+/**
+ * @brief Puts a job on the job screen unless the latest-wins tier holds it back; loop() shows
+ * the newest held-back job once the tier allows.
+ */
+void showJobOnScreen(const JobData &data)
+{
+    if (!pacingDrawJob(millis() - lastJobDrawAt))
+    {
+         screenBehind = true;
+         return;
+    }
+    jobScreenSetJob(data); // Dirties only the widgets whose text changed
+    lastJobDrawAt = millis();
+    screenBehind = false;
+}
+
+void startActionSequence(const JobData &data, const LedTimeline &timeline)
 {
     // Save current data
     currentJobData = data;
-    jobDataChanged = true; // Signal display update
+    if (screenBehind)
+    {
+         pacingJobNotDrawn(); // The job held back before this one is never shown
+    }
+    showJobOnScreen(data);
+    jobScreenSetProcessing(true);
+
+    // Fit the sequence to the current mode, then start it; from here on it runs off the esp_timer
+    LedTimeline paced = timeline;
+    currentJobMode = pacingApply(paced);
+    jobStartedAt = millis();
+    currentActionState = ACTION_RUNNING;
+    reportedLedPhase = 0;
+    ledTimelineStart(paced);
+    publishDeviceEvent(EVENT_BLINK_PHASE, 0, data.name);
+    LOG_INFO("Action started for Job: %s from %s (%s)\n", data.name, data.country, data.flag);
+}
+
+/**
+ * @brief Renders the queued job into the back buffer. Called from loop() while the current sequence plays.
+ */
+void renderAhead()
+{
+    if (!jobQueued || backBufferReady || backBuffer == nullptr || pacingMode() == PACING_LATEST)
+    {
+         return;
+    }
+    unsigned long renderStart = micros();
+    jobScreenRender(*backBuffer, backBuffer->getBuffer(), queuedJobData, true);
+    metricsObserve(HISTOGRAM_DRAW_JOB_DATA, micros() - renderStart);
+    backBufferReady = true;
+}
 
-    // Start blink sequence
-    actionStartTime = millis();
-    currentActionState = ACTION_BLINK_1;
-    // Set the initial color
-    setLEDColor(255, 0, 0);
-    Serial.printf("Action started for Job: %s from %s (%s)\n", data.name.c_str(), data.country.c_str(), data.flag.c_str());
+// Records the running job's first frame (start of the paint/push up to now), once per job.
+void stampJobFrame(int64_t frameStartUs)
+{
+    JobLatency &latency = currentJobData.latency;
+    if (latency.stageUs[STAGE_FRAME_DONE] != 0)
+    {
+         return;
+    }
+    latencyStampOnce(latency, STAGE_FIRST_PIXEL, frameStartUs);
+    latencyStamp(latency, STAGE_FRAME_DONE);
+    metricsObserve(HISTOGRAM_ACCEPT_TO_PIXEL, (uint32_t)(latency.stageUs[STAGE_FRAME_DONE] - latency.stageUs[STAGE_ACCEPTED]));
+}
+
+// Starts the queued job straight after the current one and shows its frame.
+void handOffToQueuedJob()
+{
+    jobQueued = false;
+    startActionSequence(queuedJobData, queuedTimeline);
+
+    unsigned long swapStart = micros();
+    int64_t frameStartUs = esp_timer_get_time();
+    if (backBufferReady && !screenBehind)
+    {
+         // Swap to panel byte order in place (the frame is re-rendered before its next use), so the
+         // SPI driver can send it as-is instead of swapping pixel by pixel while it transmits
+         uint16_t *frame = backBuffer->getBuffer();
+         rgb565Swap(frame, frame, SCREEN_WIDTH * SCREEN_HEIGHT);
+         tft.startWrite();
+         tft.setAddrWindow(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT);
+         tft.writePixels(frame, SCREEN_WIDTH * SCREEN_HEIGHT, true, true); // Big-endian: no driver swap
+         tft.endWrite();
+         jobScreenShown(queuedJobData, true);
+    }
+    else
+    {
+         jobScreenPaint(tft); // No PSRAM for the back buffer, the render did not get a turn, or status only
+    }
+    unsigned long swapMicros = micros() - swapStart;
+    metricsObserve(HISTOGRAM_FRAME_SWAP, swapMicros);
+    stampJobFrame(frameStartUs);
+    if (!screenBehind)
+    {
+         publishDeviceEvent(EVENT_RENDER_DONE, swapMicros / 1000, currentJobData.name);
+    }
+    backBufferReady = false;
 }
 
 void runAction()
@@ -489,150 +663,320 @@ void runAction()
          return;
     }
 
-    unsigned long currentMillis = millis();
-    int phaseIndex = currentActionState - ACTION_BLINK_1; // 0 to 4
-
-    // Time check for phase transition
-    if (currentMillis - actionStartTime >= BLINK_DURATION_MS)
+    // Report phase changes made by the timer since the last iteration
+    int ledPhase = ledTimelinePhase();
+    if (ledPhase != reportedLedPhase)
     {
-         // Move to the next state
-         currentActionState = (ActionState)(currentActionState + 1);
-         actionStartTime = currentMillis; // Reset timer
+         reportedLedPhase = ledPhase;
+         publishDeviceEvent(EVENT_BLINK_PHASE, ledPhase, currentJobData.name);
+    }
 
-         if (currentActionState <= ACTION_BLINK_5)
+    if (!ledTimelineRunning())
+    {
+         // Sequence complete
+         LOG_INFO("Action sequence complete. Notifying server...\n");
+         latencyStamp(currentJobData.latency, STAGE_LED_END);
+         currentActionState = ACTION_COMPLETED;
+         metricsIncrement(COUNTER_JOBS_COMPLETED);
+         // Older buffered completions go first; this one waits behind them
+         bool notified = pendingCount == 0 && WiFi.status() == WL_CONNECTED && notifyServerOfCompletion(currentJobData.name, currentJobData.latency);
+         if (notified)
+         {
+             LOG_INFO("Server notified. Transitioning to IDLE.\n");
+         }
+         else if (pendingCount > 0)
          {
-             // Set the next color
-             setLEDColor(BLINK_COLORS[currentActionState - ACTION_BLINK_1]);
+             LOG_INFO("Completion queued behind %d buffered ones.\n", pendingCount);
+             bufferCompletion(currentJobData.name, currentJobData.latency);
          }
          else
          {
-             // Sequence complete
-             Serial.println("Action sequence complete. Notifying server...");
-             currentActionState = ACTION_COMPLETED;
-             if (notifyServerOfCompletion())
-             {
-                  Serial.println("Server notified. Transitioning to IDLE.");
-             }
-             else
-             {
-                  Serial.println("Failed to notify server.");
-             }
-             currentActionState = ACTION_IDLE; // Final transition
-             jobDataChanged = true;         // Force redraw back to idle state
+             LOG_WARN("Failed to notify server. Completion buffered until the link is back.\n");
+             metricsIncrement(COUNTER_COMPLETION_FAILURES);
+             bufferCompletion(currentJobData.name, currentJobData.latency);
+             backOffCompletionRetry();
+         }
+         publishDeviceEvent(EVENT_COMPLETION_SENT, notified ? 1 : 0, currentJobData.name);
+         pacingJobFinished(currentJobMode, millis() - jobStartedAt);
+         currentActionState = ACTION_IDLE; // Final transition
+         jobScreenSetProcessing(false);    // Repaints the status line only
+
+         if (jobQueued)
+         {
+             handOffToQueuedJob();
          }
     }
 }
 // --- HTTP HANDLERS (Unchanged) ---
-void handleStartBlink()
+// Response bodies for POST /api/job/start
+const char RESPONSE_BUSY[] = "{\"status\": \"busy\", \"message\": \"Device is currently processing a job.\"}";
+const char RESPONSE_NO_PAYLOAD[] = "{\"status\": \"error\", \"message\": \"Expected JSON payload.\"}";
+const char RESPONSE_BAD_JSON[] = "{\"status\": \"error\", \"message\": \"Invalid JSON payload.\"}";
+const char RESPONSE_BAD_SEQUENCE[] = "{\"status\": \"error\", \"message\": \"Invalid LED sequence.\"}";
+const char RESPONSE_QUEUED[] = "{\"status\": \"queued\", \"message\": \"Job queued behind the current one.\"}";
+const char RESPONSE_PROCESSING[] = "{\"status\": \"processing\", \"message\": \"Job accepted. Initiating processing sequence.\"}";
+
+int64_t requestAcceptedUs = 0; // Accept time of the HTTP request being handled; 0 for soak jobs
+
+/**
+ * @brief Validates a job payload and starts or queues it. Shared by the HTTP handler and the soak driver.
+ * @param response Set to the JSON body to send back.
+ * @return The HTTP status code (200 started, 202 queued, 400 invalid, 429 busy).
+ */
+int submitJob(const char *json, size_t length, const char **response)
 {
-    if (currentActionState != ACTION_IDLE)
+    // One job can wait behind the running one; anything beyond that is rejected
+    if (currentActionState != ACTION_IDLE && jobQueued)
     {
-         server.send(429, "application/json", "{\"status\": \"busy\", \"message\": \"Device is currently processing a job.\"}") ;
-         return;
+         metricsIncrement(COUNTER_JOBS_REJECTED_BUSY);
+         *response = RESPONSE_BUSY;
+         return 429;
     }
 
-    // Check if content is JSON
-    if (server.hasArg("plain") == false)
+    JsonDocument doc(memPoolJsonAllocator());
+    unsigned long parseStart = micros();
+    TRACE_BEGIN("deserializeJson", 0);
+    DeserializationError error = deserializeJson(doc, json, length);
+    TRACE_END("deserializeJson");
+    metricsObserve(HISTOGRAM_JSON_PARSE, micros() - parseStart);
+
+    if (error)
     {
-         server.send(400, "application/json", "{\"status\": \"error\", \"message\": \"Expected JSON payload.\"}") ;
-         return;
+         LOG_WARN("JSON deserialization failed: %s\n", error.c_str());
+         metricsIncrement(COUNTER_JOBS_REJECTED_INVALID);
+         *response = RESPONSE_BAD_JSON;
+         return 400;
     }
 
-    JsonDocument doc;
-    DeserializationError error = deserializeJson(doc, server.arg("plain"));
+    JobData incomingData;
+    jobDataFromJson(incomingData, doc);
 
-    if (error)
+    // Optional per-job LED sequence; jobs without one get the classic 5-color blink,
+    // optionally with their own "phases" and "phase_ms" (clamped by job_pacing)
+    LedTimeline timeline = DEFAULT_BLINK_TIMELINE;
+    if (doc["sequence"].isNull())
     {
-         Serial.print("JSON deserialization failed: ");
-         Serial.println(error.c_str());
-         server.send(400, "application/json", "{\"status\": \"error\", \"message\": \"Invalid JSON payload.\"}") ;
-         return;
+         pacingShapeDefault(doc, timeline);
+    }
+    else if (!ledTimelineParse(doc["sequence"], timeline))
+    {
+         metricsIncrement(COUNTER_JOBS_REJECTED_INVALID);
+         *response = RESPONSE_BAD_SEQUENCE;
+         return 400;
     }
 
-    JobData incomingData;
-    incomingData.name = doc["name"] | "Unknown Task";
-    incomingData.country = doc["country"] | "Unknown Location";
-    incomingData.flag = doc["flag"] | "??"; // Default to a simple unknown code
+    latencyBegin(incomingData.latency, requestAcceptedUs, doc);
+    metricsIncrement(COUNTER_JOBS_ACCEPTED);
+    // The backend's queue behind this job, plus this job itself if it has to wait here
+    pacingNoteBacklog((doc["backlog"] | 0) + (currentActionState != ACTION_IDLE ? 1 : 0));
+    jobScreenSetCheapFlags(pacingMode() != PACING_NORMAL); // Also covers the render-ahead of this job
+    if (currentActionState != ACTION_IDLE)
+    {
+         // Render-ahead: loop() draws it into the back buffer while the current sequence plays
+         queuedJobData = incomingData;
+         queuedTimeline = timeline;
+         jobQueued = true;
+         backBufferReady = false;
+         publishDeviceEvent(EVENT_ACCEPTED, 1, incomingData.name);
+         *response = RESPONSE_QUEUED;
+         return 202;
+    }
+
+    publishDeviceEvent(EVENT_ACCEPTED, 0, incomingData.name);
+    startActionSequence(incomingData, timeline);
+    *response = RESPONSE_PROCESSING;
+    return 200;
+}
+
+/**
+ * @brief Jobs the device currently holds (running + queued), for the capacity advertisement.
+ */
+int jobsHeld()
+{
+    return (currentActionState != ACTION_IDLE ? 1 : 0) + (jobQueued ? 1 : 0);
+}
 
-    startActionSequence(incomingData);
+void handleStartBlink()
+{
+    TRACE_FUNCTION();
+    // Check if content is JSON
+    if (server.hasArg("plain") == false)
+    {
+         metricsIncrement(COUNTER_JOBS_REJECTED_INVALID);
+         server.send(400, "application/json", RESPONSE_NO_PAYLOAD);
+         return;
+    }
+
+    const String &body = server.arg("plain");
+    const char *response;
+    requestAcceptedUs = admissionAcceptedAtUs();
+    int status = submitJob(body.c_str(), body.length(), &response);
+    requestAcceptedUs = 0;
 
     // Respond immediately
-    server.send(200, "application/json", "{\"status\": \"processing\", \"message\": \"Job accepted. Initiating processing sequence.\"}") ;
+    server.send(status, "application/json", response);
 }
-bool notifyServerOfCompletion()
+bool notifyServerOfCompletion(const char *jobName, JobLatency &latency)
 {
+    TRACE_FUNCTION();
     HTTPClient http;
     http.begin(COMPLETION_URL);
     http.addHeader("Content-Type", "application/json");
 
-    String authHeaderValue = "Bearer "; 
-    authHeaderValue += ESP32_API_SECRET; 
-
+    // Header, device id and body are built in stack buffers rather than Strings
+    char authHeaderValue[96];
+    snprintf(authHeaderValue, sizeof(authHeaderValue), "Bearer %s", ESP32_API_SECRET);
     http.addHeader("Authorization", authHeaderValue);
 
-    JsonDocument doc;
-    doc["job_name"] = currentJobData.name;
-    doc["device_id"] = WiFi.macAddress();
-    doc["status"] = "completed";
+    uint8_t mac[6];
+    char deviceId[18];
+    WiFi.macAddress(mac);
+    snprintf(deviceId, sizeof(deviceId), "%02X:%02X:%02X:%02X:%02X:%02X", mac[0], mac[1], mac[2], mac[3], mac[4], mac[5]);
 
-    String requestBody;
-    serializeJson(doc, requestBody);
+    JsonDocument doc(memPoolJsonAllocator());
+    doc["job_name"] = jobName;
+    doc["device_id"] = deviceId;
+    doc["status"] = "completed";
+    latency.stageUs[STAGE_COMPLETION_SENT] = 0; // Only known once the POST returns; a retry must not report the last attempt's
+    latencyToJson(latency, doc["latency"].to<JsonObject>());
 
-    int httpResponseCode = http.POST(requestBody);
+    // Worst case: every name byte a control character, escaped as \u00XX; the latency breakdown is ~250 bytes
+    char requestBody[(JOB_NAME_LEN - 1) * 6 + 384];
+    if (measureJson(doc) >= sizeof(requestBody))
+    {
+         LOG_WARN("Completion for %s too large, sent without latency\n", jobName);
+         doc.remove("latency");
+    }
+    size_t bodyLen = serializeJson(doc, requestBody, sizeof(requestBody));
+#if SOAK_MODE
+    // Soak runs are offline: the completion is built as usual, only the POST is skipped
+    http.end();
+    latencyStamp(latency, STAGE_COMPLETION_SENT);
+    return bodyLen > 0;
+#else
+    unsigned long postStart = micros();
+    int httpResponseCode = http.POST((uint8_t *)requestBody, bodyLen);
+    metricsObserve(HISTOGRAM_COMPLETION_RTT, micros() - postStart);
+    latencyStamp(latency, STAGE_COMPLETION_SENT);
 
     http.end();
 
-    if (httpResponseCode > 0)
+    // Only a 2xx means the backend took it (and released the device's in-flight slot); anything else is retried
+    if (httpResponseCode >= 200 && httpResponseCode < 300)
     {
-         Serial.printf("Server Response: %d\n", httpResponseCode);
+         LOG_INFO("Server Response: %d, %lu ms after accept\n", httpResponseCode,
+                  (unsigned long)((latency.stageUs[STAGE_COMPLETION_SENT] - latency.stageUs[STAGE_ACCEPTED]) / 1000));
          return true;
     }
+    else if (httpResponseCode > 0)
+    {
+         LOG_ERROR("Server rejected completion: %d\n", httpResponseCode);
+         return false;
+    }
     else
     {
-         Serial.printf("Error notifying server: %s\n", http.errorToString(httpResponseCode).c_str());
+         LOG_ERROR("Error notifying server: %s\n", http.errorToString(httpResponseCode).c_str());
          return false;
     }
+#endif
 }
 void printWifiStatus()
 {
-    Serial.print("IP Address: ");
+    IPAddress ip = WiFi.localIP();
+    LOG_INFO("IP Address: %u.%u.%u.%u\n", ip[0], ip[1], ip[2], ip[3]);
+}
+
+// --- JOB SERVER STARTUP ---
+bool jobServerStarted = false;
+
+/**
+ * @brief Registers every job/observability route and starts listening. Called by loop() as soon as WiFi is up.
+ */
+void startJobServer()
+{
+    Serial.print("SUCCESS! Device IP: ");
     Serial.println(WiFi.localIP());
+
+    setupWiFiEvents();
+    setupLatencyClock();
+    setupAdmission(DEVICE_PIPELINE_DEPTH, jobsHeld);
+    admissionLimitBody("/api/flags/pack", FLAG_PACK_PARTITION_SIZE + 1024); // Multipart framing on top of the pack
+    server.on("/api/job/start", HTTP_POST, handleStartBlink);
+    setupDeviceEvents(server);
+    setupMetrics(server);
+    setupTrace(server);
+    setupLoopProfiler(server);
+    setupFlagBench(server);
+    setupFlagPack(server);
+    setupPixelBench(server);
+    setupMemTiers(server);
+    setupLedDriver(server);
+    setupDeviceDiscovery(server, DEVICE_PIPELINE_DEPTH, jobsHeld);
+#if SOAK_MODE
+    setupSoak(server, submitJob);
+#endif
+    server.begin();
+    jobServerStarted = true;
+    Serial.println("HTTP Job Server started, listening for POST on /api/job/start");
+    Serial.println("Admission control: per-source token buckets, body limits and early 429 when busy");
+    Serial.printf("Pacing tiers: express from %d waiting jobs (%d ms per sequence), latest-wins from %d\n",
+                  PACING_EXPRESS_ENTER_BACKLOG, PACING_EXPRESS_JOB_MS, PACING_LATEST_ENTER_BACKLOG);
+    Serial.println("Job latency stages reported with each completion (clock: SNTP, else backend offset)");
+    Serial.println("Device events available on GET /api/device/events");
+    Serial.println("Device load available on GET /api/device/load (mDNS: _web2wire._tcp)");
+    Serial.println("Prometheus metrics available on GET /metrics");
+    Serial.println("Chrome trace dump available on GET /api/debug/trace");
+    Serial.println("Loop profiler available on GET /api/debug/loop");
+    Serial.println("Flag renderer bench available on GET /api/debug/flags/bench");
+    Serial.println("Flag pack info/upload on GET/POST /api/flags/pack");
+    Serial.println("Pixel kernel bench available on GET /api/debug/pixels/bench");
+    Serial.println("Memory tiers (pools, PSRAM arenas, heaps) available on GET /api/debug/memory");
+    Serial.printf("LED driver: %u LEDs at %d Hz over RMT, stats on GET /api/debug/leds\n", ledCount(), LED_REFRESH_HZ);
+
+    unsigned long timeToReady = millis();
+    metricsSetGauge(GAUGE_BOOT_TIME_TO_READY_MS, timeToReady);
+    Serial.printf("Time to ready: %lu ms since power-on (flag cache %s).\n", timeToReady, flagCacheReady() ? "warm" : "still warming");
+
+    printWifiStatus();
+    lastStatusPrint = millis();
 }
 
-// --- CORE SETUP (Fixed Initialization) ---
+// --- CORE SETUP (Concurrent Boot Pipeline) ---
 void setup()
 {
     Serial.begin(115200);
     Serial.println("--- SETUP STARTED SUCCESSFULLY ---");
+    memTiersBegin();
+    startDeferredLog();
 
-    // 1. Initialize NeoPixel
-    strip.begin();
-    strip.setBrightness(50);
-    setLEDColor(0, 0, 0);
-
-    // 2. Initialize TFT Display
-    setupTFT();
+    // 1. Initialize the LED strip (starts dark)
+    ledDriverBegin(LED_PIN, NUM_LEDS, LED_BRIGHTNESS);
+    setupLedTimeline();
 
-    // *** NEW VISUAL TEST *** // This brief color change confirms the display is working and receiving data
-    tft.fillScreen(ST77XX_MAGENTA);
-    delay(500);
-    tft.fillScreen(ST77XX_BLACK);
-    // *** END VISUAL TEST ***
+    // 2. Kick off WiFi association (or the AP portal); the radio works on its own from here
+    bool stationMode = beginWiFiConnect();
 
-    // 3. Connect to WiFi or Start AP Portal
-    if (connectWiFi())
+    // 3. Initialize TFT Display and splash while the radio associates
+    unsigned long displayStart = millis();
+    setupTFT();
+    const size_t frameBytes = SCREEN_WIDTH * SCREEN_HEIGHT * sizeof(uint16_t);
+    if (memArenaReserve(ARENA_FRAMES, frameBytes))
     {
-         Serial.print("SUCCESS! Device IP: ");
-         Serial.println(WiFi.localIP());
+         backBuffer = new SpanCanvas16(SCREEN_WIDTH, SCREEN_HEIGHT, (uint16_t *)memArenaAlloc(ARENA_FRAMES, frameBytes));
+    }
+    // Magenta strip confirms the panel is receiving data; no blocking delay, the splash stays up until the first job screen
+    tft.fillRect(0, tft.height() - 10, tft.width(), 10, ST77XX_MAGENTA);
+    unsigned long displayMs = millis() - displayStart;
+    metricsSetGauge(GAUGE_BOOT_DISPLAY_MS, displayMs);
+    Serial.printf("Boot stage display: %lu ms\n", displayMs);
 
-         // 4. Setup the Web Server for Job Requests
-         server.on("/api/job/start", HTTP_POST, handleStartBlink);
-         server.begin();
-         Serial.println("HTTP Job Server started, listening for POST on /api/job/start");
+    // Map the flag art partition before anything draws a flag (zero-copy; absent pack = built-in art)
+    flagPackBegin();
 
-         printWifiStatus();
-         lastStatusPrint = millis();
-         lastReconnectAttempt = millis();
+    if (stationMode)
+    {
+         // 4. Warm the flag cache on core 0; loop() starts the job server once WiFi is up
+         startFlagPrerender();
     }
     else
     {
@@ -643,10 +987,22 @@ void setup()
 // --- MAIN LOOP (Updated to fix constant drawing) ---
 void loop()
 {
+    loopProfilerBegin();
     server.handleClient();
+    loopProfilerMark(STEP_HANDLE_CLIENT);
     if (WiFi.getMode() == WIFI_MODE_AP)
     {
          dnsServer.processNextRequest();
+         loopProfilerMark(STEP_DNS);
+    }
+    else if (!jobServerStarted)
+    {
+         // Boot pipeline: finish WiFi association, then bring up the job server
+         if (serviceWiFiConnect())
+         {
+             startJobServer();
+         }
+         loopProfilerMark(STEP_RECONNECT);
     }
     else
     {
@@ -654,28 +1010,59 @@ void loop()
 
          // Check and run the non-blocking hardware action
          runAction();
+#if SOAK_MODE
+         soakTick();
+#endif
+         loopProfilerMark(STEP_RUN_ACTION);
 
-         // Only redraw the display when we are idle AND the job data has changed
-         if (currentActionState == ACTION_IDLE && jobDataChanged)
+         // Show the newest job latest-wins held back, once it may be drawn again
+         if (screenBehind)
          {
-             drawJobData(currentJobData);
-             jobDataChanged = false; // Reset flag until a new job comes in
-             setLEDColor(0, 0, 0);   // Keep LED off when idle
+             showJobOnScreen(currentJobData);
          }
 
+         // Repaint only the widgets whose state changed (a status flip is one text line)
+         if (jobScreenDirty())
+         {
+             unsigned long renderStart = micros();
+             int64_t frameStartUs = esp_timer_get_time();
+             uint8_t painted = jobScreenPaint(tft);
+             unsigned long renderMicros = micros() - renderStart;
+             metricsObserve(HISTOGRAM_DRAW_JOB_DATA, renderMicros);
+             if (currentActionState != ACTION_IDLE)
+             {
+                 stampJobFrame(frameStartUs); // Even a repeat of the previous job repaints its status line
+             }
+             if (painted & JOB_SCREEN_JOB_WIDGETS)
+             {
+                 publishDeviceEvent(EVENT_RENDER_DONE, renderMicros / 1000, currentJobData.name);
+             }
+             if (currentActionState == ACTION_IDLE && (painted & JOB_SCREEN_WIDGET_BIT(WIDGET_STATUS)))
+             {
+                 setLEDColor(0, 0, 0); // Keep LED off when idle
+                 publishDeviceEvent(EVENT_IDLE);
+             }
+         }
+         renderAhead();
+         loopProfilerMark(STEP_REDRAW);
+
+         // Push queued state changes to event stream subscribers
+         pumpDeviceEvents();
+         pumpFlagBench();
+         deviceDiscoveryTick();
+         loopProfilerMark(STEP_EVENTS);
+
          // Periodic status print
          if (currentMillis - lastStatusPrint >= STATUS_INTERVAL_MS)
          {
              printWifiStatus();
              lastStatusPrint = currentMillis;
          }
+         loopProfilerMark(STEP_STATUS_PRINT);
 
-         // WiFi connection health check (simple reconnect logic)
-         if (WiFi.status() != WL_CONNECTED && currentMillis - lastReconnectAttempt >= RECONNECT_COOLDOWN_MS)
-         {
-             Serial.println("WiFi disconnected. Attempting reconnect...");
-             WiFi.reconnect();
-             lastReconnectAttempt = currentMillis;
-         }
+         // Reconnects are driven by WiFi events; here we only report outages and drain buffered completions
+         serviceWiFiLink();
+         loopProfilerMark(STEP_RECONNECT);
     }
+    loopProfilerEnd();
 }
\ No newline at end of file
@@ -0,0 +1,368 @@
+#include "mem_tiers.h"
+#include "deferred_log.h"
+#include <esp_heap_caps.h>
+
+// ******************************************************
+// ** MEMORY TIERS (internal SRAM pools, PSRAM arenas) **
+// ******************************************************
+// Two kinds of memory with two kinds of traffic. Small objects built on every job (JSON
+// documents for the request and the completion) come from fixed-size blocks in internal
+// SRAM: O(1) to take and give back, and they cannot fragment the heap WiFi and lwIP
+// need. Big, long-lived pixel data (back buffer, flag frames) lives in PSRAM arenas that
+// are reserved once and handed out front to back. Everything else keeps using the heap;
+// its numbers are reported alongside so the tiers can be sized against real usage.
+
+struct BlockPool
+{
+    const char *name;
+    uint16_t blockSize;
+    uint16_t blockCount;
+    uint8_t *blocks;
+    uint16_t *requested; // Bytes asked for, per block
+    void *freeList;      // Free blocks, linked through their first word
+    uint16_t usedBlocks;
+    uint16_t peakBlocks;
+    uint32_t requestedBytes;
+    uint32_t spills;
+};
+
+struct Arena
+{
+    const char *name;
+    uint8_t *base;
+    size_t capacity;
+    size_t offset;
+    size_t peak;
+    size_t requestedBytes;
+    uint32_t failures;
+};
+
+alignas(MEM_ARENA_ALIGN) static uint8_t smallBlocks[MEM_POOL_SMALL_BLOCK * MEM_POOL_SMALL_COUNT];
+alignas(MEM_ARENA_ALIGN) static uint8_t mediumBlocks[MEM_POOL_MEDIUM_BLOCK * MEM_POOL_MEDIUM_COUNT];
+alignas(MEM_ARENA_ALIGN) static uint8_t largeBlocks[MEM_POOL_LARGE_BLOCK * MEM_POOL_LARGE_COUNT];
+static uint16_t smallRequested[MEM_POOL_SMALL_COUNT];
+static uint16_t mediumRequested[MEM_POOL_MEDIUM_COUNT];
+static uint16_t largeRequested[MEM_POOL_LARGE_COUNT];
+
+// Smallest blocks first: allocation takes the first pool that fits
+static BlockPool pools[] = {
+    {"pool_small", MEM_POOL_SMALL_BLOCK, MEM_POOL_SMALL_COUNT, smallBlocks, smallRequested},
+    {"pool_medium", MEM_POOL_MEDIUM_BLOCK, MEM_POOL_MEDIUM_COUNT, mediumBlocks, mediumRequested},
+    {"pool_large", MEM_POOL_LARGE_BLOCK, MEM_POOL_LARGE_COUNT, largeBlocks, largeRequested},
+};
+#define NUM_POOLS (int)(sizeof(pools) / sizeof(pools[0]))
+
+static Arena arenas[NUM_MEM_ARENAS] = {
+    {"arena_frames"},
+    {"arena_flags"},
+};
+
+// Pools are shared between the loop and the prerender task on the other core
+static portMUX_TYPE memMux = portMUX_INITIALIZER_UNLOCKED;
+static WebServer *memServer = nullptr;
+
+static BlockPool *poolOf(const void *ptr)
+{
+    const uint8_t *p = (const uint8_t *)ptr;
+    for (BlockPool &pool : pools)
+    {
+         if (p >= pool.blocks && p < pool.blocks + (size_t)pool.blockSize * pool.blockCount)
+         {
+             return &pool;
+         }
+    }
+    return nullptr;
+}
+
+static size_t blockIndex(const BlockPool &pool, const void *ptr)
+{
+    return ((const uint8_t *)ptr - pool.blocks) / pool.blockSize;
+}
+
+// Changes the size recorded for a block that is staying where it is. Caller holds memMux.
+static void setRequested(BlockPool &pool, const void *ptr, size_t bytes)
+{
+    uint16_t &slot = pool.requested[blockIndex(pool, ptr)];
+    pool.requestedBytes = pool.requestedBytes - slot + bytes;
+    slot = (uint16_t)bytes;
+}
+
+static uint8_t wastePct(size_t handedOut, size_t requested)
+{
+    return handedOut > 0 ? (uint8_t)(100 - requested * 100 / handedOut) : 0;
+}
+
+// --- ARDUINOJSON ALLOCATOR ---
+
+class PoolJsonAllocator : public ArduinoJson::Allocator
+{
+public:
+    void *allocate(size_t size) override
+    {
+         void *ptr = memPoolAlloc(size);
+         return ptr ? ptr : malloc(size);
+    }
+
+    void deallocate(void *ptr) override
+    {
+         if (memPoolOwns(ptr))
+         {
+             memPoolFree(ptr);
+         }
+         else
+         {
+             free(ptr);
+         }
+    }
+
+    void *reallocate(void *ptr, size_t newSize) override
+    {
+         BlockPool *pool = ptr ? poolOf(ptr) : nullptr;
+         if (pool == nullptr)
+         {
+             return ptr ? realloc(ptr, newSize) : allocate(newSize);
+         }
+         if (newSize <= pool->blockSize)
+         {
+             // Shrinks (ArduinoJson trims its pools after every parse) and small growth stay in place
+             portENTER_CRITICAL(&memMux);
+             setRequested(*pool, ptr, newSize);
+             portEXIT_CRITICAL(&memMux);
+             return ptr;
+         }
+         void *moved = allocate(newSize);
+         if (moved == nullptr)
+         {
+             return nullptr;
+         }
+         memcpy(moved, ptr, pool->requested[blockIndex(*pool, ptr)]);
+         memPoolFree(ptr);
+         return moved;
+    }
+};
+
+static PoolJsonAllocator poolJsonAllocator;
+
+static void handleMemory()
+{
+    JsonDocument doc;
+    doc["psram"] = psramFound();
+    JsonArray tiers = doc["tiers"].to<JsonArray>();
+    for (int i = 0; i < memTierCount(); i++)
+    {
+         MemTierStats stats;
+         memTierStats(i, stats);
+         JsonObject tier = tiers.add<JsonObject>();
+         tier["name"] = stats.name;
+         tier["kind"] = stats.kind;
+         tier["capacity"] = stats.capacity;
+         tier["used"] = stats.used;
+         tier["high_water"] = stats.highWater;
+         tier["largest_free"] = stats.largestFree;
+         tier["fragmentation_pct"] = stats.fragmentationPct;
+         tier["spills"] = stats.spills;
+    }
+
+    String body;
+    serializeJson(doc, body);
+    memServer->send(200, "application/json", body);
+}
+
+// --- PUBLIC API ---
+
+void memTiersBegin()
+{
+    for (BlockPool &pool : pools)
+    {
+         pool.freeList = nullptr;
+         for (int i = pool.blockCount - 1; i >= 0; i--)
+         {
+             void *block = pool.blocks + (size_t)i * pool.blockSize;
+             *(void **)block = pool.freeList;
+             pool.freeList = block;
+         }
+    }
+}
+
+void *memPoolAlloc(size_t bytes)
+{
+    BlockPool *fitting = nullptr;
+    void *block = nullptr;
+    portENTER_CRITICAL(&memMux);
+    for (BlockPool &pool : pools)
+    {
+         if (bytes > pool.blockSize)
+         {
+             continue;
+         }
+         if (fitting == nullptr)
+         {
+             fitting = &pool;
+         }
+         if (pool.freeList != nullptr)
+         {
+             block = pool.freeList;
+             pool.freeList = *(void **)block;
+             pool.usedBlocks++;
+             if (pool.usedBlocks > pool.peakBlocks)
+             {
+                 pool.peakBlocks = pool.usedBlocks;
+             }
+             setRequested(pool, block, bytes);
+             break;
+         }
+    }
+    if (block == nullptr && fitting != nullptr)
+    {
+         fitting->spills++;
+    }
+    portEXIT_CRITICAL(&memMux);
+    return block;
+}
+
+void memPoolFree(void *ptr)
+{
+    BlockPool *pool = ptr ? poolOf(ptr) : nullptr;
+    if (pool == nullptr)
+    {
+         return;
+    }
+    portENTER_CRITICAL(&memMux);
+    setRequested(*pool, ptr, 0);
+    *(void **)ptr = pool->freeList;
+    pool->freeList = ptr;
+    pool->usedBlocks--;
+    portEXIT_CRITICAL(&memMux);
+}
+
+bool memPoolOwns(const void *ptr)
+{
+    return ptr != nullptr && poolOf(ptr) != nullptr;
+}
+
+ArduinoJson::Allocator *memPoolJsonAllocator()
+{
+    return &poolJsonAllocator;
+}
+
+size_t memPsramAvailable()
+{
+    if (!psramFound())
+    {
+         return 0;
+    }
+    size_t largest = heap_caps_get_largest_free_block(MALLOC_CAP_SPIRAM);
+    return largest > MEM_PSRAM_HEADROOM ? largest - MEM_PSRAM_HEADROOM : 0;
+}
+
+bool memArenaReserve(MemArena arena, size_t bytes)
+{
+    Arena &a = arenas[arena];
+    if (a.base != nullptr)
+    {
+         return true;
+    }
+    if (!psramFound())
+    {
+         return false;
+    }
+    a.base = (uint8_t *)heap_caps_aligned_alloc(MEM_ARENA_ALIGN, bytes, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (a.base == nullptr)
+    {
+         LOG_WARN("Memory: no %u bytes of PSRAM for %s\n", (unsigned)bytes, a.name);
+         return false;
+    }
+    a.capacity = bytes;
+    return true;
+}
+
+void *memArenaAlloc(MemArena arena, size_t bytes)
+{
+    Arena &a = arenas[arena];
+    void *ptr = nullptr;
+    portENTER_CRITICAL(&memMux);
+    size_t start = (a.offset + MEM_ARENA_ALIGN - 1) & ~(size_t)(MEM_ARENA_ALIGN - 1);
+    if (a.base != nullptr && start + bytes <= a.capacity)
+    {
+         ptr = a.base + start;
+         a.offset = start + bytes;
+         a.requestedBytes += bytes;
+         if (a.offset > a.peak)
+         {
+             a.peak = a.offset;
+         }
+    }
+    else
+    {
+         a.failures++;
+    }
+    portEXIT_CRITICAL(&memMux);
+    return ptr;
+}
+
+void memArenaReset(MemArena arena)
+{
+    portENTER_CRITICAL(&memMux);
+    arenas[arena].offset = 0;
+    arenas[arena].requestedBytes = 0;
+    portEXIT_CRITICAL(&memMux);
+}
+
+int memTierCount()
+{
+    return NUM_POOLS + NUM_MEM_ARENAS + 2; // + internal and PSRAM heap
+}
+
+void memTierStats(int index, MemTierStats &out)
+{
+    if (index < NUM_POOLS)
+    {
+         const BlockPool &pool = pools[index];
+         portENTER_CRITICAL(&memMux);
+         out.name = pool.name;
+         out.kind = "pool";
+         out.capacity = (size_t)pool.blockSize * pool.blockCount;
+         out.used = (size_t)pool.blockSize * pool.usedBlocks;
+         out.highWater = (size_t)pool.blockSize * pool.peakBlocks;
+         out.largestFree = pool.freeList != nullptr ? pool.blockSize : 0;
+         out.fragmentationPct = wastePct(out.used, pool.requestedBytes);
+         out.spills = pool.spills;
+         portEXIT_CRITICAL(&memMux);
+         return;
+    }
+    index -= NUM_POOLS;
+    if (index < NUM_MEM_ARENAS)
+    {
+         const Arena &a = arenas[index];
+         portENTER_CRITICAL(&memMux);
+         out.name = a.name;
+         out.kind = "arena";
+         out.capacity = a.capacity;
+         out.used = a.offset;
+         out.highWater = a.peak;
+         out.largestFree = a.capacity - a.offset;
+         out.fragmentationPct = wastePct(a.offset, a.requestedBytes);
+         out.spills = a.failures;
+         portEXIT_CRITICAL(&memMux);
+         return;
+    }
+    index -= NUM_MEM_ARENAS;
+
+    bool internal = index == 0;
+    multi_heap_info_t info;
+    heap_caps_get_info(&info, internal ? MALLOC_CAP_INTERNAL : MALLOC_CAP_SPIRAM);
+    out.name = internal ? "heap_internal" : "heap_psram";
+    out.kind = "heap";
+    out.capacity = info.total_free_bytes + info.total_allocated_bytes;
+    out.used = info.total_allocated_bytes;
+    out.highWater = out.capacity - info.minimum_free_bytes;
+    out.largestFree = info.largest_free_block;
+    out.fragmentationPct = info.total_free_bytes > 0 ? (uint8_t)(100 - info.largest_free_block * 100 / info.total_free_bytes) : 0;
+    out.spills = 0;
+}
+
+void setupMemTiers(WebServer &server)
+{
+    memServer = &server;
+    server.on("/api/debug/memory", HTTP_GET, handleMemory);
+}
@@ -0,0 +1,109 @@
+#ifndef MEM_TIERS_H
+#define MEM_TIERS_H
+
+#include <Arduino.h>
+#include <WebServer.h>
+#include <ArduinoJson.h>
+
+// --- MEMORY TIER CONFIGURATION ---
+// Internal SRAM pools: fixed-size blocks in .bss for the small objects built on every job.
+#define MEM_POOL_SMALL_BLOCK 64
+#define MEM_POOL_SMALL_COUNT 32
+#define MEM_POOL_MEDIUM_BLOCK 256
+#define MEM_POOL_MEDIUM_COUNT 16
+#define MEM_POOL_LARGE_BLOCK 1024
+#define MEM_POOL_LARGE_COUNT 8
+// PSRAM arenas: one block per arena, handed out front to back and only released as a whole.
+#define MEM_ARENA_ALIGN 16                   // Keeps every frame aligned for the 128-bit pixel kernels
+#define MEM_PSRAM_HEADROOM (128 * 1024)      // PSRAM left to libc for large String/HTTP buffers
+
+enum MemArena
+{
+    ARENA_FRAMES = 0, // Render-ahead back buffer
+    ARENA_FLAGS,      // Prerendered flag frames
+    NUM_MEM_ARENAS
+};
+
+/**
+ * @brief Usage of one tier. For pools and arenas 'used' counts whole blocks and padding;
+ * fragmentationPct is the share of that not asked for (internal fragmentation). For the
+ * system heaps it is the share of free memory outside the largest free block.
+ */
+struct MemTierStats
+{
+    const char *name;
+    const char *kind;      // "pool", "arena" or "heap"
+    size_t capacity;
+    size_t used;
+    size_t highWater;      // Peak 'used' since boot
+    size_t largestFree;    // Largest single allocation that would succeed now
+    uint8_t fragmentationPct;
+    uint32_t spills;       // Pools: requests served by the heap instead; arenas: failed allocations
+};
+
+/**
+ * @brief Threads the free lists of the internal SRAM pools. Call at the top of setup().
+ */
+void memTiersBegin();
+
+/**
+ * @brief Allocates from the smallest pool whose blocks fit 'bytes'.
+ * @return nullptr when no pool fits or the fitting pools are exhausted (counted as a spill).
+ */
+void *memPoolAlloc(size_t bytes);
+
+/**
+ * @brief Returns a block to its pool. Pointers the pools do not own are ignored.
+ */
+void memPoolFree(void *ptr);
+
+/**
+ * @brief True if 'ptr' lies in one of the pools.
+ */
+bool memPoolOwns(const void *ptr);
+
+/**
+ * @brief ArduinoJson allocator over the pools, falling back to the heap for anything they
+ * cannot hold. For the documents built on every job: JsonDocument doc(memPoolJsonAllocator());
+ */
+ArduinoJson::Allocator *memPoolJsonAllocator();
+
+/**
+ * @brief PSRAM an arena could reserve right now, leaving MEM_PSRAM_HEADROOM to the heap.
+ * 0 without PSRAM.
+ */
+size_t memPsramAvailable();
+
+/**
+ * @brief Reserves an arena's block in PSRAM. Only the first call per arena does anything.
+ * @return False without PSRAM or when the block does not fit.
+ */
+bool memArenaReserve(MemArena arena, size_t bytes);
+
+/**
+ * @brief Hands out the next MEM_ARENA_ALIGN-aligned 'bytes' of an arena.
+ * @return nullptr when the arena is not reserved or full.
+ */
+void *memArenaAlloc(MemArena arena, size_t bytes);
+
+/**
+ * @brief Releases everything allocated from an arena at once; the block stays reserved.
+ */
+void memArenaReset(MemArena arena);
+
+/**
+ * @brief Number of tiers memTierStats() reports (pools, arenas, internal and PSRAM heap).
+ */
+int memTierCount();
+
+/**
+ * @brief Fills 'out' with the current usage of tier 'index' (0 .. memTierCount() - 1).
+ */
+void memTierStats(int index, MemTierStats &out);
+
+/**
+ * @brief Registers GET /api/debug/memory: memTierStats() of every tier as JSON.
+ */
+void setupMemTiers(WebServer &server);
+
+#endif // MEM_TIERS_H
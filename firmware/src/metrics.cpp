@@ -0,0 +1,242 @@
+#include "metrics.h"
+#include <WiFi.h>
+
+// ******************************************************
+// ** PROMETHEUS METRICS (GET /metrics) **
+// ******************************************************
+// Every histogram uses the same fixed bucket boundaries, so recording a sample
+// is a short linear scan and a few integer increments - no heap, no floats.
+
+struct Histogram
+{
+    uint32_t buckets[METRIC_BUCKET_COUNT + 1]; // Last slot is the +Inf bucket
+    uint32_t count;
+    uint64_t sumMicros;
+};
+
+struct FlagHistogram
+{
+    char code[3];
+    Histogram histogram;
+};
+
+// Upper bounds in microseconds, and the same bounds pre-formatted in seconds for the "le" label.
+static const uint32_t BUCKET_BOUNDS_US[METRIC_BUCKET_COUNT] = {
+    100, 250, 500, 1000, 2500, 5000, 10000, 25000, 50000, 100000, 250000, 500000, 1000000, 2500000
+};
+static const char *BUCKET_LABELS[METRIC_BUCKET_COUNT] = {
+    "0.0001", "0.00025", "0.0005", "0.001", "0.0025", "0.005", "0.01", "0.025", "0.05", "0.1", "0.25", "0.5", "1", "2.5"
+};
+
+static const char *COUNTER_NAMES[NUM_METRIC_COUNTERS] = {
+    "web2wire_jobs_accepted_total",
+    "web2wire_jobs_rejected_total{reason=\"busy\"}",
+    "web2wire_jobs_rejected_total{reason=\"invalid\"}",
+    "web2wire_jobs_completed_total",
+    "web2wire_completion_failures_total",
+    "web2wire_admission_rejected_total{reason=\"rate\"}",
+    "web2wire_admission_rejected_total{reason=\"too_large\"}",
+    "web2wire_admission_rejected_total{reason=\"overload\"}",
+    "web2wire_jobs_not_drawn_total"
+};
+
+static const char *HISTOGRAM_NAMES[NUM_METRIC_HISTOGRAMS] = {
+    "web2wire_json_parse_seconds",
+    "web2wire_draw_job_data_seconds",
+    "web2wire_completion_rtt_seconds",
+    "web2wire_loop_iteration_seconds",
+    "web2wire_frame_swap_seconds",
+    "web2wire_accept_to_pixel_seconds"
+};
+
+static const char *GAUGE_NAMES[NUM_METRIC_GAUGES] = {
+    "web2wire_boot_wifi_connect_ms",
+    "web2wire_boot_time_to_ready_ms",
+    "web2wire_boot_fast_connect",
+    "web2wire_boot_display_ms",
+    "web2wire_boot_prerender_ms",
+    "web2wire_wifi_last_outage_ms",
+    "web2wire_wifi_outages",
+    "web2wire_pacing_tier",
+    "web2wire_jobs_per_minute_normal",
+    "web2wire_jobs_per_minute_express",
+    "web2wire_jobs_per_minute_latest"
+};
+
+static WebServer *metricsServer = nullptr;
+static uint32_t counters[NUM_METRIC_COUNTERS];
+static int32_t gauges[NUM_METRIC_GAUGES];
+static Histogram histograms[NUM_METRIC_HISTOGRAMS];
+static FlagHistogram flagHistograms[MAX_FLAG_METRIC_CODES + 1]; // Last slot collects "other"
+static int flagHistogramCount = 0;
+
+static void observe(Histogram &h, uint32_t micros)
+{
+    int i = 0;
+    while (i < METRIC_BUCKET_COUNT && micros > BUCKET_BOUNDS_US[i])
+    {
+         i++;
+    }
+    h.buckets[i]++;
+    h.count++;
+    h.sumMicros += micros;
+}
+
+// --- EXPOSITION ---
+
+// Streams one formatted line into the chunked response.
+static void sendLine(const char *fmt, ...)
+{
+    char line[160];
+    va_list args;
+    va_start(args, fmt);
+    int len = vsnprintf(line, sizeof(line), fmt, args);
+    va_end(args);
+    if (len > 0)
+    {
+         metricsServer->sendContent(line, min<int>(len, sizeof(line) - 1));
+    }
+}
+
+// Writes the _bucket/_sum/_count series of one histogram. 'labels' is either empty or 'key="value",'.
+static void sendHistogram(const char *name, const char *labels, const Histogram &h)
+{
+    uint32_t cumulative = 0;
+    for (int i = 0; i < METRIC_BUCKET_COUNT; i++)
+    {
+         cumulative += h.buckets[i];
+         sendLine("%s_bucket{%sle=\"%s\"} %lu\n", name, labels, BUCKET_LABELS[i], (unsigned long)cumulative);
+    }
+    sendLine("%s_bucket{%sle=\"+Inf\"} %lu\n", name, labels, (unsigned long)h.count);
+
+    // Strip the trailing comma for the plain _sum/_count label set.
+    char plain[24] = "";
+    size_t labelLen = strlen(labels);
+    if (labelLen > 1 && labelLen < sizeof(plain))
+    {
+         snprintf(plain, sizeof(plain), "{%.*s}", (int)(labelLen - 1), labels);
+    }
+    sendLine("%s_sum%s %lu.%06lu\n", name, plain, (unsigned long)(h.sumMicros / 1000000), (unsigned long)(h.sumMicros % 1000000));
+    sendLine("%s_count%s %lu\n", name, plain, (unsigned long)h.count);
+}
+
+static void handleMetrics()
+{
+    metricsServer->setContentLength(CONTENT_LENGTH_UNKNOWN);
+    metricsServer->send(200, "text/plain; version=0.0.4", "");
+
+    // Counters (the two rejected series share one family)
+    sendLine("# TYPE web2wire_jobs_accepted_total counter\n");
+    sendLine("%s %lu\n", COUNTER_NAMES[COUNTER_JOBS_ACCEPTED], (unsigned long)counters[COUNTER_JOBS_ACCEPTED]);
+    sendLine("# TYPE web2wire_jobs_rejected_total counter\n");
+    sendLine("%s %lu\n", COUNTER_NAMES[COUNTER_JOBS_REJECTED_BUSY], (unsigned long)counters[COUNTER_JOBS_REJECTED_BUSY]);
+    sendLine("%s %lu\n", COUNTER_NAMES[COUNTER_JOBS_REJECTED_INVALID], (unsigned long)counters[COUNTER_JOBS_REJECTED_INVALID]);
+    sendLine("# TYPE web2wire_jobs_completed_total counter\n");
+    sendLine("%s %lu\n", COUNTER_NAMES[COUNTER_JOBS_COMPLETED], (unsigned long)counters[COUNTER_JOBS_COMPLETED]);
+    sendLine("# TYPE web2wire_jobs_not_drawn_total counter\n");
+    sendLine("%s %lu\n", COUNTER_NAMES[COUNTER_JOBS_NOT_DRAWN], (unsigned long)counters[COUNTER_JOBS_NOT_DRAWN]);
+    sendLine("# TYPE web2wire_completion_failures_total counter\n");
+    sendLine("%s %lu\n", COUNTER_NAMES[COUNTER_COMPLETION_FAILURES], (unsigned long)counters[COUNTER_COMPLETION_FAILURES]);
+    sendLine("# TYPE web2wire_admission_rejected_total counter\n");
+    for (int i = COUNTER_ADMISSION_REJECTED_RATE; i <= COUNTER_ADMISSION_REJECTED_OVERLOAD; i++)
+    {
+         sendLine("%s %lu\n", COUNTER_NAMES[i], (unsigned long)counters[i]);
+    }
+
+    // Latency histograms
+    for (int i = 0; i < NUM_METRIC_HISTOGRAMS; i++)
+    {
+         sendLine("# TYPE %s histogram\n", HISTOGRAM_NAMES[i]);
+         sendHistogram(HISTOGRAM_NAMES[i], "", histograms[i]);
+    }
+
+    sendLine("# TYPE web2wire_draw_flag_seconds histogram\n");
+    for (int i = 0; i < flagHistogramCount; i++)
+    {
+         char labels[20];
+         snprintf(labels, sizeof(labels), "code=\"%s\",", flagHistograms[i].code);
+         sendHistogram("web2wire_draw_flag_seconds", labels, flagHistograms[i].histogram);
+    }
+    if (flagHistograms[MAX_FLAG_METRIC_CODES].histogram.count > 0)
+    {
+         sendHistogram("web2wire_draw_flag_seconds", "code=\"other\",", flagHistograms[MAX_FLAG_METRIC_CODES].histogram);
+    }
+
+    // Gauges
+    uint32_t psramUsed = ESP.getPsramSize() - ESP.getFreePsram();
+    sendLine("# TYPE web2wire_heap_free_bytes gauge\nweb2wire_heap_free_bytes %lu\n", (unsigned long)ESP.getFreeHeap());
+    sendLine("# TYPE web2wire_heap_largest_free_block_bytes gauge\nweb2wire_heap_largest_free_block_bytes %lu\n", (unsigned long)ESP.getMaxAllocHeap());
+    sendLine("# TYPE web2wire_psram_used_bytes gauge\nweb2wire_psram_used_bytes %lu\n", (unsigned long)psramUsed);
+    sendLine("# TYPE web2wire_wifi_rssi_dbm gauge\nweb2wire_wifi_rssi_dbm %d\n", (int)WiFi.RSSI());
+    sendLine("# TYPE web2wire_uptime_seconds gauge\nweb2wire_uptime_seconds %lu\n", (unsigned long)(millis() / 1000));
+    for (int i = 0; i < NUM_METRIC_GAUGES; i++)
+    {
+         sendLine("# TYPE %s gauge\n%s %ld\n", GAUGE_NAMES[i], GAUGE_NAMES[i], (long)gauges[i]);
+    }
+
+    metricsServer->sendContent("");
+}
+
+// --- PUBLIC API ---
+
+void setupMetrics(WebServer &server)
+{
+    metricsServer = &server;
+    server.on("/metrics", HTTP_GET, handleMetrics);
+}
+
+void metricsIncrement(MetricCounter counter)
+{
+    counters[counter]++;
+}
+
+void metricsSetGauge(MetricGauge gauge, int32_t value)
+{
+    gauges[gauge] = value;
+}
+
+void metricsObserve(MetricHistogram histogram, uint32_t micros)
+{
+    observe(histograms[histogram], micros);
+}
+
+void metricsHistogramTotals(MetricHistogram histogram, uint32_t *count, uint64_t *sumMicros)
+{
+    *count = histograms[histogram].count;
+    *sumMicros = histograms[histogram].sumMicros;
+}
+
+void metricsObserveFlagDraw(const char *flagCode, uint32_t micros)
+{
+    char code[3] = {0, 0, 0};
+    for (int i = 0; i < 2 && flagCode[i]; i++)
+    {
+         code[i] = toupper((unsigned char)flagCode[i]);
+    }
+
+    // Only printable 2-letter codes get their own series; everything else is "other".
+    bool valid = isalpha((unsigned char)code[0]) && isalpha((unsigned char)code[1]) && flagCode[2] == '\0';
+    if (!valid)
+    {
+         observe(flagHistograms[MAX_FLAG_METRIC_CODES].histogram, micros);
+         return;
+    }
+
+    for (int i = 0; i < flagHistogramCount; i++)
+    {
+         if (flagHistograms[i].code[0] == code[0] && flagHistograms[i].code[1] == code[1])
+         {
+             observe(flagHistograms[i].histogram, micros);
+             return;
+         }
+    }
+
+    if (flagHistogramCount < MAX_FLAG_METRIC_CODES)
+    {
+         FlagHistogram &slot = flagHistograms[flagHistogramCount++];
+         memcpy(slot.code, code, sizeof(code));
+         observe(slot.histogram, micros);
+         return;
+    }
+    observe(flagHistograms[MAX_FLAG_METRIC_CODES].histogram, micros);
+}
@@ -0,0 +1,87 @@
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <Arduino.h>
+#include <WebServer.h>
+
+// --- METRICS CONFIGURATION ---
+#define METRIC_BUCKET_COUNT 14      // Fixed latency buckets (plus the implicit +Inf bucket)
+#define MAX_FLAG_METRIC_CODES 48    // Distinct flag codes tracked by drawFlag histograms; the rest go to "other"
+
+// Monotonic counters exported as web2wire_*_total.
+enum MetricCounter
+{
+    COUNTER_JOBS_ACCEPTED = 0,
+    COUNTER_JOBS_REJECTED_BUSY,     // 429, device still processing a job
+    COUNTER_JOBS_REJECTED_INVALID,  // 400, missing or malformed JSON
+    COUNTER_JOBS_COMPLETED,
+    COUNTER_COMPLETION_FAILURES,    // notifyServerOfCompletion could not reach the backend
+    COUNTER_ADMISSION_REJECTED_RATE,     // 429 before parsing, source over its token bucket
+    COUNTER_ADMISSION_REJECTED_TOO_LARGE, // 413/431 before the body or oversized headers were read
+    COUNTER_ADMISSION_REJECTED_OVERLOAD, // 503 past the in-flight cap, or 408 on a stalled header block
+    COUNTER_JOBS_NOT_DRAWN,         // Run and acknowledged, but never shown (latest-wins pacing tier)
+    NUM_METRIC_COUNTERS
+};
+
+// Latency histograms, all recorded in microseconds and exported in seconds.
+enum MetricHistogram
+{
+    HISTOGRAM_JSON_PARSE = 0,
+    HISTOGRAM_DRAW_JOB_DATA,
+    HISTOGRAM_COMPLETION_RTT,
+    HISTOGRAM_LOOP_ITERATION,
+    HISTOGRAM_FRAME_SWAP,           // Back buffer push (or fallback draw) at a job handoff
+    HISTOGRAM_ACCEPT_TO_PIXEL,      // HTTP accept to the job's frame fully on the panel
+    NUM_METRIC_HISTOGRAMS
+};
+
+// Point-in-time values set by the firmware (the heap/PSRAM/RSSI gauges are sampled at scrape time).
+enum MetricGauge
+{
+    GAUGE_BOOT_WIFI_CONNECT_MS = 0, // WiFi association time on this boot
+    GAUGE_BOOT_TIME_TO_READY_MS,    // Power-on to job server listening
+    GAUGE_BOOT_FAST_CONNECT,        // 1 if the cached BSSID/channel fast path succeeded
+    GAUGE_BOOT_DISPLAY_MS,          // Display init and splash
+    GAUGE_BOOT_PRERENDER_MS,        // Flag cache warm-up (runs concurrently with WiFi)
+    GAUGE_WIFI_LAST_OUTAGE_MS,      // Disconnect to got-IP time of the most recent outage
+    GAUGE_WIFI_OUTAGES,             // Outages since boot
+    GAUGE_PACING_TIER,              // Degradation tier: 0 normal, 1 express, 2 latest-wins
+    GAUGE_JOBS_PER_MINUTE_NORMAL,   // Jobs per busy minute in each tier, since boot
+    GAUGE_JOBS_PER_MINUTE_EXPRESS,
+    GAUGE_JOBS_PER_MINUTE_LATEST,
+    NUM_METRIC_GAUGES
+};
+
+/**
+ * @brief Registers GET /metrics (Prometheus text format) on the job server.
+ */
+void setupMetrics(WebServer &server);
+
+/**
+ * @brief Increments a counter. Allocation-free, safe on hot paths.
+ */
+void metricsIncrement(MetricCounter counter);
+
+/**
+ * @brief Sets a firmware-owned gauge.
+ */
+void metricsSetGauge(MetricGauge gauge, int32_t value);
+
+/**
+ * @brief Records one latency sample into its fixed-bucket histogram. Allocation-free.
+ * @param histogram Which histogram to update.
+ * @param micros Elapsed time in microseconds.
+ */
+void metricsObserve(MetricHistogram histogram, uint32_t micros);
+
+/**
+ * @brief Reads back a histogram's sample count and total time (used by the soak report).
+ */
+void metricsHistogramTotals(MetricHistogram histogram, uint32_t *count, uint64_t *sumMicros);
+
+/**
+ * @brief Records one drawFlag duration under its (upper-cased) 2-letter code. Allocation-free.
+ */
+void metricsObserveFlagDraw(const char *flagCode, uint32_t micros);
+
+#endif // METRICS_H
@@ -0,0 +1,139 @@
+#include "pixel_bench.h"
+#include "pixel_kernels.h"
+#include "flag_drawing.h"
+#include <Adafruit_GFX.h>
+#include <ArduinoJson.h>
+#include "deferred_log.h"
+
+// ******************************************************
+// ** PIXEL KERNEL BENCHMARK (GET /api/debug/pixels/bench) **
+// ******************************************************
+// Everything runs on a back-buffer-sized GFXcanvas16 (PSRAM when present), so the
+// numbers include the memory the frame really lives in. The "gfx" column is what the
+// renderer did before the kernels: fillRect/fillScreen, a fillRect per scaled pixel,
+// and the per-pixel swap the SPI driver does while pushing.
+
+#define BENCH_FRAME_W 320
+#define BENCH_FRAME_H 170
+#define BENCH_SCALE 4
+
+static WebServer *benchServer = nullptr;
+static GFXcanvas16 *benchCanvas = nullptr; // Kept between runs: 108 KB is not worth re-allocating per request
+static uint16_t benchTile[FLAG_W * FLAG_H];
+
+// Mean microseconds per run of 'body' (a lambda, inlined: no std::function, no allocation).
+template <typename F>
+static uint32_t timeKernel(F body, int iterations)
+{
+    uint32_t start = micros();
+    for (int i = 0; i < iterations; i++)
+    {
+         body(i);
+    }
+    return (micros() - start) / iterations;
+}
+
+static void gfxScaledDraw(GFXcanvas16 &canvas, const uint16_t *tile, int x0, int y0)
+{
+    for (int row = 0; row < FLAG_H; row++)
+    {
+         for (int col = 0; col < FLAG_W; col++)
+         {
+             canvas.fillRect(x0 + col * BENCH_SCALE, y0 + row * BENCH_SCALE, BENCH_SCALE, BENCH_SCALE, tile[row * FLAG_W + col]);
+         }
+    }
+}
+
+static void gfxSwap(uint16_t *pixels, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+         pixels[i] = (pixels[i] << 8) | (pixels[i] >> 8);
+    }
+}
+
+static void handlePixelBench()
+{
+    int iterations = benchServer->hasArg("iterations") ? benchServer->arg("iterations").toInt() : PIXEL_BENCH_DEFAULT_ITERATIONS;
+    iterations = constrain(iterations, 1, PIXEL_BENCH_MAX_ITERATIONS);
+
+    if (benchCanvas == nullptr)
+    {
+         benchCanvas = new GFXcanvas16(BENCH_FRAME_W, BENCH_FRAME_H);
+         if (benchCanvas->getBuffer() == nullptr)
+         {
+             delete benchCanvas;
+             benchCanvas = nullptr;
+         }
+    }
+    if (benchCanvas == nullptr)
+    {
+         benchServer->send(503, "application/json", "{\"status\": \"error\", \"message\": \"No memory for the bench canvas.\"}");
+         return;
+    }
+
+    GFXcanvas16 &canvas = *benchCanvas;
+    uint16_t *tile = benchTile;
+    for (int i = 0; i < FLAG_W * FLAG_H; i++)
+    {
+         tile[i] = (uint16_t)(i * 2654435761u >> 9);
+    }
+    const size_t framePixels = BENCH_FRAME_W * BENCH_FRAME_H;
+    uint16_t *frame = canvas.getBuffer();
+    uint16_t *flagAt = frame + 45 * BENCH_FRAME_W + 176; // Where the job screen puts the flag
+
+    JsonDocument doc;
+    doc["path"] = pixelKernelsPath();
+    doc["iterations"] = iterations;
+
+    JsonObject fill = doc["fill_320x170"].to<JsonObject>();
+    fill["gfx_us"] = timeKernel([&](int i) { canvas.fillScreen(0x1234 + i); }, iterations); // Unequal bytes: no memset shortcut
+    fill["portable_us"] = timeKernel([&](int i) { rgb565FillPortable(frame, 0x1234 + i, framePixels); }, iterations);
+    fill["kernel_us"] = timeKernel([&](int i) { rgb565Fill(frame, 0x1234 + i, framePixels); }, iterations);
+
+    JsonObject blit = doc["scale_blit_32x20_x4"].to<JsonObject>();
+    blit["gfx_us"] = timeKernel([&](int) { gfxScaledDraw(canvas, tile, 176, 45); }, iterations);
+    blit["portable_us"] = timeKernel([&](int) { rgb565ScaleBlitPortable(flagAt, BENCH_FRAME_W, tile, FLAG_W, FLAG_H, BENCH_SCALE); }, iterations);
+    blit["kernel_us"] = timeKernel([&](int) { rgb565ScaleBlit(flagAt, BENCH_FRAME_W, tile, FLAG_W, FLAG_H, BENCH_SCALE); }, iterations);
+
+    JsonObject swap = doc["swap_320x170"].to<JsonObject>();
+    swap["gfx_us"] = timeKernel([&](int) { gfxSwap(frame, framePixels); }, iterations);
+    swap["portable_us"] = timeKernel([&](int) { rgb565SwapPortable(frame, frame, framePixels); }, iterations);
+    swap["kernel_us"] = timeKernel([&](int) { rgb565Swap(frame, frame, framePixels); }, iterations);
+
+    // Spot-check the dispatched blit against the portable one (catches a broken SIMD path on real hardware)
+    rgb565ScaleBlitPortable(flagAt, BENCH_FRAME_W, tile, FLAG_W, FLAG_H, BENCH_SCALE);
+    uint32_t expected = 0, actual = 0;
+    for (int y = 0; y < FLAG_H * BENCH_SCALE; y++)
+    {
+         for (int x = 0; x < FLAG_W * BENCH_SCALE; x++)
+         {
+             expected = expected * 31 + flagAt[y * BENCH_FRAME_W + x];
+         }
+    }
+    rgb565Fill(frame, 0, framePixels);
+    rgb565ScaleBlit(flagAt, BENCH_FRAME_W, tile, FLAG_W, FLAG_H, BENCH_SCALE);
+    for (int y = 0; y < FLAG_H * BENCH_SCALE; y++)
+    {
+         for (int x = 0; x < FLAG_W * BENCH_SCALE; x++)
+         {
+             actual = actual * 31 + flagAt[y * BENCH_FRAME_W + x];
+         }
+    }
+    doc["kernel_matches_portable"] = expected == actual;
+
+    String body;
+    serializeJson(doc, body);
+    benchServer->send(200, "application/json", body);
+    LOG_INFO("Pixel bench (%s): fill %lu us, blit %lu us, swap %lu us\n", pixelKernelsPath(),
+             (unsigned long)fill["kernel_us"].as<uint32_t>(), (unsigned long)blit["kernel_us"].as<uint32_t>(),
+             (unsigned long)swap["kernel_us"].as<uint32_t>());
+}
+
+// --- PUBLIC API ---
+
+void setupPixelBench(WebServer &server)
+{
+    benchServer = &server;
+    server.on("/api/debug/pixels/bench", HTTP_GET, handlePixelBench);
+}
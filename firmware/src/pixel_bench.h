@@ -0,0 +1,19 @@
+#ifndef PIXEL_BENCH_H
+#define PIXEL_BENCH_H
+
+#include <Arduino.h>
+#include <WebServer.h>
+
+// --- PIXEL BENCHMARK CONFIGURATION ---
+#define PIXEL_BENCH_DEFAULT_ITERATIONS 20
+#define PIXEL_BENCH_MAX_ITERATIONS 500
+
+/**
+ * @brief Registers GET /api/debug/pixels/bench: mean time of each RGB565 kernel (span fill of a
+ * full frame, 32x20 -> 128x80 scaled blit, full-frame byte swap) for the Adafruit GFX way,
+ * the portable loop and the path this build dispatches to (?iterations=N).
+ * Blocks the loop for the duration of the run, so it is meant for the bench, not production.
+ */
+void setupPixelBench(WebServer &server);
+
+#endif // PIXEL_BENCH_H
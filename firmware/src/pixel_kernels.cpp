@@ -0,0 +1,267 @@
+#include "pixel_kernels.h"
+#include <string.h>
+
+// ******************************************************
+// ** RGB565 PIXEL KERNELS (fill, scaled blit, byte swap) **
+// ******************************************************
+// Adafruit GFX moves one pixel per call. These kernels work on whole spans, in three tiers:
+//   portable  plain per-pixel loops; the host compiler turns them into SSE/NEON
+//   swar      Xtensa has no vector unit outside PIE, so two pixels per 32-bit word
+//   pie       ESP32-S3: eight pixels per 128-bit store for fills and row copies
+// No Arduino dependencies, so the file builds on the host unchanged (tools/pixel_kernels_bench.cpp).
+
+#if defined(ESP_PLATFORM)
+#define PIXEL_KERNELS_SWAR 1
+#else
+#define PIXEL_KERNELS_SWAR 0
+#endif
+
+// --- PORTABLE ---
+// Kept free of word tricks on purpose: a uint32_t view of a uint16_t buffer stops the host
+// vectorizer. Spans are walked in fixed blocks of PIXEL_BLOCK so the inner loops have a
+// constant trip count, which GCC vectorizes even at -O2 (no epilogue), then a scalar tail.
+
+#define PIXEL_BLOCK 16 // One AVX2 register, two SSE/NEON registers
+
+void rgb565FillPortable(uint16_t *__restrict dst, uint16_t color, size_t count)
+{
+    size_t i = 0;
+    for (; i + PIXEL_BLOCK <= count; i += PIXEL_BLOCK)
+    {
+         for (int k = 0; k < PIXEL_BLOCK; k++)
+         {
+             dst[i + k] = color;
+         }
+    }
+    for (; i < count; i++)
+    {
+         dst[i] = color;
+    }
+}
+
+void rgb565ScaleBlitPortable(uint16_t *dst, size_t dstStride, const uint16_t *src, int srcW, int srcH, int scale)
+{
+    size_t rowPixels = (size_t)srcW * scale;
+    for (int row = 0; row < srcH; row++)
+    {
+         uint16_t *__restrict out = dst + (size_t)row * scale * dstStride;
+         const uint16_t *__restrict in = src + (size_t)row * srcW;
+         for (int col = 0; col < srcW; col++)
+         {
+             rgb565FillPortable(out + col * scale, in[col], scale);
+         }
+         for (int repeat = 1; repeat < scale; repeat++)
+         {
+             memcpy(out + repeat * dstStride, out, rowPixels * sizeof(uint16_t));
+         }
+    }
+}
+
+// In place (the usual case, the back buffer) through one pointer, so there is no aliasing to rule out.
+static void swapInPlace(uint16_t *pixels, size_t count)
+{
+    size_t i = 0;
+    for (; i + PIXEL_BLOCK <= count; i += PIXEL_BLOCK)
+    {
+         for (int k = 0; k < PIXEL_BLOCK; k++)
+         {
+             pixels[i + k] = (uint16_t)((pixels[i + k] << 8) | (pixels[i + k] >> 8));
+         }
+    }
+    for (; i < count; i++)
+    {
+         pixels[i] = (uint16_t)((pixels[i] << 8) | (pixels[i] >> 8));
+    }
+}
+
+static void swapCopy(uint16_t *__restrict dst, const uint16_t *__restrict src, size_t count)
+{
+    size_t i = 0;
+    for (; i + PIXEL_BLOCK <= count; i += PIXEL_BLOCK)
+    {
+         for (int k = 0; k < PIXEL_BLOCK; k++)
+         {
+             dst[i + k] = (uint16_t)((src[i + k] << 8) | (src[i + k] >> 8));
+         }
+    }
+    for (; i < count; i++)
+    {
+         dst[i] = (uint16_t)((src[i] << 8) | (src[i] >> 8));
+    }
+}
+
+void rgb565SwapPortable(uint16_t *dst, const uint16_t *src, size_t count)
+{
+    if (dst == src)
+    {
+         swapInPlace(dst, count);
+    }
+    else
+    {
+         swapCopy(dst, src, count);
+    }
+}
+
+#if PIXEL_KERNELS_SWAR
+// --- SWAR (ESP32) ---
+
+// Two pixels as one word; may_alias keeps the uint16_t buffers legal under strict aliasing.
+typedef uint32_t __attribute__((may_alias)) PixelPair;
+
+static inline uint32_t pairOf(uint16_t color)
+{
+    return color | ((uint32_t)color << 16);
+}
+
+static void fillWords(uint16_t *dst, uint16_t color, size_t count)
+{
+    if (count > 0 && ((uintptr_t)dst & 2))
+    {
+         *dst++ = color;
+         count--;
+    }
+    PixelPair *words = (PixelPair *)dst;
+    uint32_t pair = pairOf(color);
+    size_t pairs = count / 2;
+    for (size_t i = 0; i < pairs; i++)
+    {
+         words[i] = pair;
+    }
+    if (count & 1)
+    {
+         dst[count - 1] = color;
+    }
+}
+
+// One source row widened 'scale' times into 'out'.
+static void expandRow(uint16_t *out, const uint16_t *in, int srcW, int scale)
+{
+    if (scale == 1)
+    {
+         memcpy(out, in, srcW * sizeof(uint16_t));
+         return;
+    }
+    if (scale % 2 == 0 && ((uintptr_t)out & 2) == 0)
+    {
+         PixelPair *words = (PixelPair *)out;
+         int wordsPerPixel = scale / 2;
+         for (int col = 0; col < srcW; col++)
+         {
+             uint32_t pair = pairOf(in[col]);
+             for (int k = 0; k < wordsPerPixel; k++)
+             {
+                 *words++ = pair;
+             }
+         }
+         return;
+    }
+    for (int col = 0; col < srcW; col++)
+    {
+         for (int k = 0; k < scale; k++)
+         {
+             *out++ = in[col];
+         }
+    }
+}
+
+// Row copy for the vertical repeats of a scaled blit.
+static void copyRow(uint16_t *dst, const uint16_t *src, size_t pixels)
+{
+#if PIXEL_KERNELS_PIE
+    if ((((uintptr_t)dst | (uintptr_t)src) & 15) == 0)
+    {
+         size_t blocks = pixels / 8;
+         for (size_t i = 0; i < blocks; i++)
+         {
+             asm volatile("ee.vld.128.ip q0, %0, 16\n\t"
+                          "ee.vst.128.ip q0, %1, 16"
+                          : "+r"(src), "+r"(dst)
+                          :
+                          : "memory");
+         }
+         pixels -= blocks * 8;
+    }
+#endif
+    memcpy(dst, src, pixels * sizeof(uint16_t));
+}
+
+static void swapWords(uint16_t *dst, const uint16_t *src, size_t count)
+{
+    size_t done = 0;
+    if ((((uintptr_t)dst | (uintptr_t)src) & 2) == 0)
+    {
+         const PixelPair *in = (const PixelPair *)src;
+         PixelPair *out = (PixelPair *)dst;
+         size_t pairs = count / 2;
+         for (size_t i = 0; i < pairs; i++)
+         {
+             uint32_t w = in[i];
+             out[i] = ((w & 0x00FF00FFu) << 8) | ((w >> 8) & 0x00FF00FFu);
+         }
+         done = pairs * 2;
+    }
+    rgb565SwapPortable(dst + done, src + done, count - done);
+}
+#endif // PIXEL_KERNELS_SWAR
+
+// --- DISPATCH ---
+
+void rgb565Fill(uint16_t *dst, uint16_t color, size_t count)
+{
+#if PIXEL_KERNELS_PIE
+    // Scalar head up to a 16-byte boundary, then one broadcast register stored 8 pixels at a time
+    while (count > 0 && ((uintptr_t)dst & 15))
+    {
+         *dst++ = color;
+         count--;
+    }
+    size_t blocks = count / 8;
+    if (blocks > 0)
+    {
+         asm volatile("ee.vldbc.16 q0, %0" : : "r"(&color) : "memory");
+         for (size_t i = 0; i < blocks; i++)
+         {
+             asm volatile("ee.vst.128.ip q0, %0, 16" : "+r"(dst) : : "memory");
+         }
+         count -= blocks * 8;
+    }
+#endif
+#if PIXEL_KERNELS_SWAR
+    fillWords(dst, color, count);
+#else
+    rgb565FillPortable(dst, color, count);
+#endif
+}
+
+void rgb565ScaleBlit(uint16_t *dst, size_t dstStride, const uint16_t *src, int srcW, int srcH, int scale)
+{
+#if PIXEL_KERNELS_SWAR
+    size_t rowPixels = (size_t)srcW * scale;
+    for (int row = 0; row < srcH; row++)
+    {
+         uint16_t *out = dst + (size_t)row * scale * dstStride;
+         expandRow(out, src + (size_t)row * srcW, srcW, scale);
+         for (int repeat = 1; repeat < scale; repeat++)
+         {
+             copyRow(out + repeat * dstStride, out, rowPixels);
+         }
+    }
+#else
+    rgb565ScaleBlitPortable(dst, dstStride, src, srcW, srcH, scale);
+#endif
+}
+
+void rgb565Swap(uint16_t *dst, const uint16_t *src, size_t count)
+{
+#if PIXEL_KERNELS_SWAR
+    // Word SWAR on the S3 as well: the frame lives in PSRAM, and this loop already runs at its bandwidth
+    swapWords(dst, src, count);
+#else
+    rgb565SwapPortable(dst, src, count);
+#endif
+}
+
+const char *pixelKernelsPath()
+{
+    return PIXEL_KERNELS_PIE ? "pie" : PIXEL_KERNELS_SWAR ? "swar" : "portable";
+}
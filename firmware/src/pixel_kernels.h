@@ -0,0 +1,53 @@
+#ifndef PIXEL_KERNELS_H
+#define PIXEL_KERNELS_H
+
+#include <stdint.h>
+#include <stddef.h>
+#ifdef ESP_PLATFORM
+#include <sdkconfig.h>
+#endif
+
+// --- PIXEL KERNEL CONFIGURATION ---
+// On the ESP32-S3 the fill and row-copy loops use the PIE 128-bit vector stores
+// (8 pixels per instruction). Core 2.x (IDF 4.4) does not save the Q registers on a
+// context switch, so two tasks on the same core must not run the PIE paths at once;
+// today the kernels run on core 1 (render loop) and in the prerender task on core 0.
+#ifndef PIXEL_KERNELS_PIE
+#if defined(CONFIG_IDF_TARGET_ESP32S3)
+#define PIXEL_KERNELS_PIE 1
+#else
+#define PIXEL_KERNELS_PIE 0
+#endif
+#endif
+
+/**
+ * @brief Sets 'count' RGB565 pixels to 'color'.
+ */
+void rgb565Fill(uint16_t *dst, uint16_t color, size_t count);
+
+/**
+ * @brief Copies a srcW x srcH tile into a larger frame, each pixel becoming a scale x scale block
+ * (scale 1 is a plain rectangle copy; the flag path is 32x20 -> 128x80 at scale 4).
+ * @param dst Top-left destination pixel.
+ * @param dstStride Destination row pitch in pixels.
+ */
+void rgb565ScaleBlit(uint16_t *dst, size_t dstStride, const uint16_t *src, int srcW, int srcH, int scale);
+
+/**
+ * @brief Swaps the bytes of 'count' pixels, little-endian (GFX canvases) to the big-endian order the
+ * panel expects on SPI. dst may equal src.
+ */
+void rgb565Swap(uint16_t *dst, const uint16_t *src, size_t count);
+
+// Portable per-pixel versions (the host compiler turns them into SSE/NEON).
+// Always built, so the benches can compare them with the SWAR/PIE paths.
+void rgb565FillPortable(uint16_t *dst, uint16_t color, size_t count);
+void rgb565ScaleBlitPortable(uint16_t *dst, size_t dstStride, const uint16_t *src, int srcW, int srcH, int scale);
+void rgb565SwapPortable(uint16_t *dst, const uint16_t *src, size_t count);
+
+/**
+ * @brief "pie", "swar" or "portable": which implementation the unsuffixed kernels use in this build.
+ */
+const char *pixelKernelsPath();
+
+#endif // PIXEL_KERNELS_H
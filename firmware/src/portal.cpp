@@ -0,0 +1,87 @@
+#include "portal.h"
+#include "portal_assets.h"
+#include "admission.h"
+
+// ******************************************************
+// ** CAPTIVE PORTAL (precompressed pages, canned probe replies) **
+// ******************************************************
+// Phones hammer a captive portal with connectivity probes while the DNS server shares
+// the same loop. Pages are gzipped at build time and written straight from flash with
+// Content-Encoding: gzip; a browser revalidating with If-None-Match gets a bare 304.
+// The probe URIs never reach the WebServer parser: admission control answers them with
+// one canned redirect to the portal, which is what makes the OS open its sign-in sheet.
+
+static const char RESPONSE_PROBE_REDIRECT[] =
+    "HTTP/1.1 302 Found\r\n"
+    "Location: " PORTAL_URL "\r\n"
+    "Cache-Control: no-store\r\n"
+    "Connection: close\r\n"
+    "Content-Length: 0\r\n"
+    "\r\n";
+
+// Connectivity checks of Android, Apple, Windows, Firefox and Kindle
+static const char *PROBE_URIS[] = {
+    "/generate_204",
+    "/gen_204",
+    "/hotspot-detect.html",
+    "/library/test/success.html",
+    "/connecttest.txt",
+    "/ncsi.txt",
+    "/redirect",
+    "/success.txt",
+    "/canonical.html",
+    "/kindle-wifi/wifistub.html",
+};
+
+static const char *COLLECTED_HEADERS[] = {"If-None-Match"};
+
+static WebServer *portalServer = nullptr;
+
+static void sendAsset(const PortalAsset &asset, int code)
+{
+    portalServer->sendHeader("ETag", asset.etag);
+    portalServer->sendHeader("Cache-Control", "no-cache"); // Always revalidate; a match costs one 304
+    if (code == 200 && portalServer->header("If-None-Match") == asset.etag)
+    {
+         portalServer->send(304);
+         return;
+    }
+    portalServer->sendHeader("Content-Encoding", "gzip");
+    portalServer->send_P(code, asset.contentType, (const char *)asset.gzip, asset.gzipLength); // Written from flash, no copy
+}
+
+static void handleNotFound()
+{
+    portalServer->sendHeader("Location", PORTAL_URL);
+    portalServer->send(302);
+}
+
+// --- PUBLIC API ---
+
+void setupPortal(WebServer &server)
+{
+    portalServer = &server;
+    server.collectHeaders(COLLECTED_HEADERS, sizeof(COLLECTED_HEADERS) / sizeof(COLLECTED_HEADERS[0]));
+    for (int i = 0; i < PORTAL_ASSET_COUNT; i++)
+    {
+         server.on(PORTAL_ASSETS[i].path, HTTP_GET, [i]() { sendAsset(PORTAL_ASSETS[i], 200); });
+    }
+    for (const char *uri : PROBE_URIS)
+    {
+         admissionCannedReply(uri, RESPONSE_PROBE_REDIRECT, sizeof(RESPONSE_PROBE_REDIRECT) - 1);
+    }
+    server.onNotFound(handleNotFound);
+}
+
+void portalSendAsset(const char *path, int code)
+{
+    for (int i = 0; i < PORTAL_ASSET_COUNT; i++)
+    {
+         if (strcmp(PORTAL_ASSETS[i].path, path) == 0)
+         {
+             sendAsset(PORTAL_ASSETS[i], code);
+             return;
+         }
+    }
+    portalServer->send(404);
+}
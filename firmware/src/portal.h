@@ -0,0 +1,25 @@
+#ifndef PORTAL_H
+#define PORTAL_H
+
+#include <Arduino.h>
+#include <WebServer.h>
+
+// --- CAPTIVE PORTAL CONFIGURATION ---
+// Pages live in firmware/portal/ and are gzipped into portal_assets.h at build time
+// (tools/build_portal_assets.py runs before every PlatformIO build).
+#define PORTAL_URL "http://192.168.4.1/" // Must match apIP in main.cpp
+
+/**
+ * @brief Registers the precompressed portal pages, canned redirects for the OS
+ * captive-portal probes and a redirect to the portal for every other URI.
+ * Call before server.begin() in AP mode.
+ */
+void setupPortal(WebServer &server);
+
+/**
+ * @brief Sends a portal page (e.g. "/saved.html") from flash as the response to the current request.
+ * @param code HTTP status to send it with.
+ */
+void portalSendAsset(const char *path, int code);
+
+#endif // PORTAL_H
@@ -0,0 +1,140 @@
+// Generated by firmware/tools/build_portal_assets.py from firmware/portal/ -- do not edit.
+#ifndef PORTAL_ASSETS_H
+#define PORTAL_ASSETS_H
+
+#include <Arduino.h>
+
+struct PortalAsset
+{
+    const char *path;        // URI it is served on
+    const char *contentType;
+    const char *etag;        // Quoted, as sent in the ETag header
+    const uint8_t *gzip;     // Precompressed body, read straight from flash
+    size_t gzipLength;
+};
+
+// index.html: 3080 bytes, 1262 gzipped
+static const uint8_t PORTAL_INDEX_HTML_GZ[] PROGMEM = {
+    0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xD5, 0x56, 0x5B, 0x6F, 0xDA, 0x48,
+    0x14, 0x7E, 0xE7, 0x57, 0x9C, 0xF5, 0x2A, 0x6A, 0x53, 0x61, 0x6C, 0x42, 0x08, 0xAD, 0x03, 0x91,
+    0xC2, 0xA5, 0x59, 0x54, 0x0A, 0x11, 0xA6, 0x8D, 0xA2, 0x55, 0x1F, 0x06, 0x7B, 0x30, 0xA3, 0xD8,
+    0x1E, 0x3A, 0x1E, 0x43, 0xD8, 0x6A, 0xFF, 0xFB, 0x9E, 0x19, 0x5F, 0xC2, 0x75, 0xA5, 0x7D, 0x5C,
+    0x50, 0x62, 0x3C, 0x97, 0x73, 0xF9, 0xCE, 0x77, 0xBE, 0x99, 0xF6, 0x6F, 0xFD, 0x49, 0x6F, 0xF6,
+    0xFC, 0x38, 0x80, 0xA5, 0x8C, 0xC2, 0xBB, 0x4A, 0xBB, 0x78, 0x50, 0xE2, 0xE3, 0x43, 0x32, 0x19,
+    0xD2, 0xBB, 0x99, 0x60, 0x31, 0x93, 0x5B, 0x78, 0x62, 0xE6, 0x67, 0x06, 0x2E, 0x95, 0xE9, 0xAA,
+    0x6D, 0x65, 0x53, 0x95, 0x76, 0x44, 0x25, 0x81, 0x98, 0x44, 0xB4, 0x63, 0xAC, 0x19, 0xDD, 0xAC,
+    0xB8, 0x90, 0x06, 0x78, 0x3C, 0x96, 0x34, 0x96, 0x1D, 0x63, 0xC3, 0x7C, 0xB9, 0xEC, 0xF8, 0x74,
+    0xCD, 0x3C, 0x6A, 0xEA, 0x97, 0x2A, 0x28, 0x63, 0x8C, 0x84, 0x66, 0xE2, 0x91, 0x90, 0x76, 0xEA,
+    0x06, 0x1A, 0x49, 0xE4, 0x56, 0x19, 0x03, 0xEB, 0x03, 0x74, 0x49, 0x42, 0x41, 0xBF, 0x27, 0x60,
+    0x42, 0x9F, 0x88, 0x97, 0x2A, 0x3C, 0x08, 0xE6, 0x9B, 0x21, 0x7B, 0xA1, 0x30, 0x27, 0xDE, 0x4B,
+    0x20, 0x78, 0x1A, 0xFB, 0xF0, 0xC1, 0xAA, 0xC0, 0x9C, 0xFB, 0x5B, 0xF8, 0x05, 0x15, 0x58, 0xA0,
+    0x43, 0x73, 0x41, 0x22, 0x16, 0x6E, 0x1D, 0x78, 0xD7, 0xE3, 0xA9, 0x60, 0x54, 0xC0, 0x98, 0x6E,
+    0xDE, 0x55, 0x21, 0xE2, 0x31, 0x4F, 0x56, 0xC4, 0xA3, 0xB7, 0xB8, 0xF0, 0xCD, 0x80, 0xE9, 0xF1,
+    0x90, 0x0B, 0x07, 0x7E, 0xB7, 0x7D, 0xF5, 0x55, 0x93, 0xE5, 0x88, 0xBD, 0x58, 0xD8, 0xF6, 0xAD,
+    0x0A, 0x67, 0x4C, 0x79, 0x8C, 0xFE, 0x29, 0x8D, 0xB5, 0xC3, 0x88, 0x88, 0x80, 0xC5, 0x0E, 0xD8,
+    0x6A, 0xF9, 0x8A, 0xF8, 0x3E, 0x8B, 0x03, 0x07, 0xAE, 0xEC, 0xD5, 0xAB, 0x1A, 0xC0, 0xF5, 0x6E,
+    0x3A, 0x47, 0x5C, 0x20, 0xC0, 0x88, 0x71, 0x5E, 0x4A, 0x2A, 0x62, 0x0C, 0x4E, 0x40, 0xE2, 0x31,
+    0x73, 0xC1, 0x20, 0xE4, 0xFC, 0x25, 0x8B, 0xFC, 0x2D, 0x0E, 0x16, 0x91, 0x80, 0x3A, 0x10, 0xB2,
+    0x98, 0x12, 0x61, 0x06, 0x82, 0xF8, 0x0C, 0xB1, 0x7B, 0x6F, 0xFB, 0x34, 0xA8, 0x82, 0x14, 0x24,
+    0xC6, 0xE0, 0x05, 0x8E, 0xC0, 0xD5, 0xF5, 0x45, 0x15, 0x44, 0x30, 0x27, 0xEF, 0xED, 0x2A, 0x5C,
+    0x35, 0x9B, 0x55, 0xC0, 0xA7, 0x5D, 0xB3, 0x9B, 0x97, 0xF8, 0x76, 0x7E, 0xEA, 0xE6, 0xE2, 0xC0,
+    0x4C, 0xEB, 0x60, 0xA0, 0x75, 0xDE, 0x6E, 0xEB, 0xBC, 0xDD, 0xD6, 0xA1, 0xDD, 0xD6, 0x81, 0xDD,
+    0xCB, 0xEA, 0x51, 0x4E, 0x9F, 0xFE, 0xFF, 0x49, 0xDD, 0xEE, 0xD5, 0x2E, 0x61, 0x7F, 0x61, 0xE9,
+    0x9A, 0x58, 0x7F, 0xFD, 0x0F, 0x27, 0xFF, 0xD6, 0x34, 0xE8, 0x21, 0x1F, 0x09, 0x26, 0x2F, 0x72,
+    0x0E, 0x83, 0x6A, 0x93, 0x30, 0x64, 0x1E, 0x92, 0x22, 0xA6, 0xA1, 0xA6, 0x40, 0xCD, 0x2B, 0x17,
+    0x29, 0x0A, 0x47, 0xE4, 0x35, 0xEB, 0x10, 0x07, 0xAE, 0xED, 0x9C, 0x50, 0x05, 0xDD, 0x6E, 0x94,
+    0x03, 0x92, 0x4A, 0x9E, 0x11, 0xEF, 0x2D, 0x00, 0x27, 0xCB, 0xA3, 0x71, 0x5D, 0x85, 0xE2, 0xCF,
+    0xAE, 0x7D, 0x6A, 0x5E, 0x6A, 0xEE, 0x6A, 0xC7, 0x0F, 0x82, 0x6C, 0xAD, 0x6E, 0x88, 0x3B, 0xB4,
+    0xD3, 0x92, 0xB3, 0x8D, 0xDC, 0xC5, 0x9C, 0x0B, 0x9F, 0x0A, 0x53, 0x55, 0x28, 0x4D, 0x1C, 0xA8,
+    0xEF, 0x0D, 0x23, 0xB5, 0xD1, 0x71, 0xC2, 0x43, 0x64, 0x33, 0x76, 0x85, 0xE7, 0x2D, 0x16, 0xDA,
+    0xB2, 0x9B, 0xB1, 0xB9, 0x1B, 0xA6, 0x14, 0xBA, 0x7A, 0x65, 0xDE, 0x8E, 0xAF, 0x66, 0xB2, 0x24,
+    0x3E, 0xDF, 0x60, 0x87, 0xE0, 0x57, 0xF5, 0xC5, 0x09, 0xA0, 0xF3, 0xF0, 0x76, 0x5A, 0xEB, 0x21,
+    0xE4, 0x1B, 0x6D, 0x01, 0xD1, 0x5B, 0xD6, 0x35, 0x1C, 0x87, 0xBD, 0x58, 0x01, 0x49, 0x5F, 0xA5,
+    0x49, 0x42, 0x16, 0x20, 0x20, 0x1E, 0x96, 0x82, 0x8A, 0x72, 0x74, 0xD7, 0xA9, 0xCA, 0x60, 0x77,
+    0x5B, 0x86, 0xA1, 0x39, 0xE7, 0x52, 0xF2, 0x08, 0x13, 0x6A, 0x16, 0x65, 0x0A, 0xC9, 0x1C, 0x2B,
+    0xF1, 0xAB, 0x02, 0x3E, 0x4B, 0x56, 0x21, 0x41, 0xE1, 0x98, 0x87, 0xDC, 0x7B, 0xB9, 0x2D, 0xB7,
+    0x48, 0xBE, 0x42, 0x40, 0xB2, 0xF5, 0x6F, 0xE1, 0x94, 0x20, 0x8C, 0x58, 0xB0, 0x94, 0x1A, 0x03,
+    0xAB, 0xB7, 0x25, 0x99, 0x3E, 0x68, 0x1D, 0xCA, 0x48, 0x51, 0xAF, 0xD5, 0x69, 0x54, 0x12, 0x62,
+    0x18, 0xAF, 0x52, 0x09, 0x0B, 0x46, 0x43, 0x5F, 0xE9, 0xDA, 0x48, 0xE9, 0x80, 0x56, 0xB4, 0x00,
+    0x53, 0xC7, 0x82, 0x80, 0x4F, 0x50, 0x47, 0x95, 0x7A, 0x26, 0xDA, 0x10, 0x53, 0xEB, 0xFF, 0x94,
+    0xDB, 0x15, 0xEA, 0xAA, 0x4A, 0xD1, 0xF8, 0x51, 0xDD, 0x1B, 0x5B, 0x91, 0x24, 0xD9, 0x20, 0xF2,
+    0xC6, 0x0F, 0x8D, 0x56, 0x4E, 0x9C, 0xBA, 0x6D, 0x5F, 0xEC, 0x29, 0x53, 0xFD, 0x6A, 0x9F, 0x48,
+    0x1F, 0x11, 0x9B, 0xBC, 0x2E, 0x1A, 0x9C, 0x32, 0x75, 0x16, 0xAB, 0x5E, 0x35, 0x33, 0x04, 0x76,
+    0xEA, 0x5F, 0xFF, 0x4F, 0xF5, 0x3F, 0x16, 0xD7, 0xBA, 0xFE, 0xE8, 0x4D, 0xDF, 0xA9, 0xD8, 0x62,
+    0x9A, 0xC8, 0x49, 0x9D, 0xC8, 0xA1, 0x96, 0xFF, 0xBB, 0xF8, 0x2A, 0x0C, 0xF2, 0x7D, 0x19, 0xD3,
+    0xF6, 0x58, 0x7B, 0x5D, 0x90, 0xF6, 0x55, 0x81, 0xAF, 0x33, 0xCF, 0x57, 0xE0, 0x50, 0x39, 0xB3,
+    0x43, 0x92, 0xE6, 0x49, 0x62, 0x36, 0x54, 0x77, 0xEB, 0x66, 0xC7, 0x13, 0x8A, 0xC7, 0xCE, 0xCE,
+    0x36, 0x35, 0x9B, 0x54, 0x0B, 0xAB, 0x3A, 0x56, 0x3D, 0x94, 0x15, 0xF8, 0xB8, 0x5A, 0xCE, 0x82,
+    0x7B, 0x69, 0x72, 0xAE, 0x66, 0xD9, 0xAC, 0xE2, 0xDE, 0xAE, 0xC1, 0x3C, 0x79, 0xC4, 0xF8, 0x38,
+    0xE0, 0x37, 0x56, 0xEB, 0x69, 0x9E, 0x4A, 0x55, 0x2F, 0x07, 0x62, 0x1E, 0xD3, 0x92, 0x64, 0x78,
+    0xF8, 0x44, 0x0C, 0x81, 0x4D, 0x91, 0xEA, 0x31, 0xB2, 0xAC, 0x2B, 0x34, 0x45, 0x03, 0x8D, 0x20,
+    0xF1, 0x54, 0x4E, 0x40, 0x43, 0x1A, 0x29, 0x61, 0x3B, 0x24, 0x59, 0xA2, 0xF7, 0xE6, 0x74, 0x3A,
+    0x75, 0x4A, 0x96, 0x0D, 0x75, 0xA2, 0xB4, 0x5A, 0x69, 0x74, 0x89, 0xD0, 0xC3, 0x3C, 0xF3, 0x9A,
+    0x47, 0xB1, 0x27, 0x3A, 0x75, 0x2C, 0x54, 0x79, 0x5A, 0x16, 0x9C, 0x54, 0x1D, 0x86, 0x19, 0x7E,
+    0x2C, 0x38, 0x59, 0x50, 0x4F, 0xA7, 0x06, 0xE7, 0x6A, 0xED, 0xA5, 0x22, 0x51, 0x61, 0xAC, 0x38,
+    0x2B, 0xA4, 0xE0, 0xA0, 0x09, 0x76, 0x7B, 0xF1, 0x26, 0xDB, 0xA4, 0x87, 0x36, 0x54, 0xC5, 0xA7,
+    0x8A, 0x1B, 0xFA, 0xE7, 0x90, 0x3E, 0xE6, 0x46, 0x2B, 0x13, 0x2D, 0x57, 0x0A, 0x1E, 0x07, 0xC8,
+    0xF7, 0xA0, 0x90, 0xAC, 0x3D, 0xBE, 0x1C, 0xE0, 0x56, 0xB2, 0x66, 0x8F, 0x46, 0xC7, 0x9C, 0x29,
+    0xC0, 0x77, 0x96, 0x7C, 0x9D, 0x1F, 0x07, 0x27, 0x4A, 0xD0, 0x68, 0x2C, 0x16, 0x8D, 0xC6, 0x29,
+    0x3A, 0x6B, 0x08, 0x77, 0x4A, 0x84, 0xE6, 0x6B, 0x31, 0x97, 0x74, 0x4F, 0x49, 0x89, 0xFE, 0x1C,
+    0x20, 0x83, 0xA7, 0x05, 0xAA, 0xD4, 0x59, 0x75, 0xDD, 0x55, 0x42, 0xAD, 0x9C, 0xDA, 0x78, 0xDB,
+    0xCA, 0x2F, 0x6C, 0x6D, 0x2B, 0xBF, 0x28, 0xAA, 0x8B, 0x18, 0x3E, 0x7C, 0xB6, 0x06, 0x2F, 0x44,
+    0x9A, 0x77, 0x8C, 0xF2, 0x70, 0x53, 0xF7, 0xBB, 0x65, 0xFD, 0x6E, 0x36, 0x1D, 0x8E, 0x87, 0xB3,
+    0x67, 0x78, 0x9C, 0x4E, 0x66, 0x93, 0xDE, 0x64, 0x04, 0xEE, 0x60, 0xF6, 0xED, 0x11, 0x0D, 0xD4,
+    0x71, 0x1E, 0x6F, 0x48, 0x91, 0x3A, 0x22, 0x97, 0xDC, 0xEF, 0x18, 0x01, 0xC5, 0x1B, 0x64, 0xC6,
+    0xD6, 0x8E, 0x61, 0x25, 0x64, 0x4D, 0xD1, 0x04, 0xB4, 0x33, 0xB9, 0xC6, 0x95, 0x08, 0x57, 0xC2,
+    0x7C, 0xE3, 0x6E, 0x3C, 0x98, 0x3D, 0x4D, 0xA6, 0x5F, 0xC0, 0x75, 0x87, 0x7D, 0xA7, 0x6D, 0xE9,
+    0x79, 0xB5, 0x30, 0x53, 0x89, 0x9D, 0x66, 0x04, 0xE6, 0xE7, 0x7B, 0xF2, 0x8B, 0x6A, 0xF6, 0x5B,
+    0xD0, 0x9F, 0x29, 0x13, 0x14, 0xC3, 0xDF, 0xB7, 0xAE, 0xDA, 0xD4, 0xB8, 0x73, 0x07, 0xBD, 0x6F,
+    0x53, 0x15, 0xF0, 0x97, 0xC1, 0xF3, 0x39, 0xEB, 0x65, 0x43, 0x6B, 0x0F, 0x7A, 0x5F, 0xEE, 0x21,
+    0xB3, 0x51, 0x39, 0x58, 0x9F, 0x97, 0x19, 0xD6, 0x04, 0x85, 0xB3, 0x63, 0x0C, 0xDC, 0xD9, 0x7D,
+    0x77, 0x34, 0x74, 0xFF, 0x80, 0xDE, 0x64, 0x3C, 0x1E, 0xF4, 0x66, 0xC3, 0xC9, 0x58, 0xA1, 0x65,
+    0x29, 0x38, 0xF6, 0xD1, 0x54, 0xC5, 0x34, 0xEE, 0x2C, 0x0B, 0xFA, 0xF7, 0xB3, 0x7B, 0x78, 0x1A,
+    0x8E, 0x46, 0xD0, 0x1D, 0xC0, 0x60, 0xDC, 0x9B, 0x3E, 0x3F, 0xCE, 0x06, 0x7D, 0xB8, 0x1F, 0xF7,
+    0xC1, 0x9D, 0x4D, 0xA6, 0xF8, 0x73, 0x38, 0x86, 0xF1, 0x77, 0x17, 0x3E, 0x8F, 0xEE, 0xD1, 0xF0,
+    0xD7, 0xC1, 0xD7, 0xC9, 0xF4, 0xB9, 0x06, 0x96, 0xD5, 0xB6, 0xD0, 0x9C, 0x32, 0x9E, 0x3F, 0xF2,
+    0x8A, 0x59, 0xD9, 0x85, 0xFF, 0x1F, 0xD2, 0x39, 0xCD, 0x94, 0x08, 0x0C, 0x00, 0x00,
+};
+
+// save_error.html: 205 bytes, 191 gzipped
+static const uint8_t PORTAL_SAVE_ERROR_HTML_GZ[] PROGMEM = {
+    0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x25, 0x4F, 0xCB, 0x0A, 0xC2, 0x30,
+    0x10, 0xBC, 0xFB, 0x15, 0x0B, 0x1E, 0x3C, 0xF5, 0xE1, 0x35, 0x8D, 0x01, 0xB1, 0x0A, 0x05, 0x51,
+    0xA9, 0xFA, 0x01, 0x69, 0xB2, 0xAD, 0xC5, 0x36, 0x1B, 0xD2, 0x15, 0xEC, 0xDF, 0x9B, 0x22, 0x73,
+    0x99, 0x99, 0xC3, 0x3C, 0x64, 0x43, 0x76, 0x86, 0x89, 0xE7, 0x01, 0x77, 0x9B, 0x46, 0x9B, 0x77,
+    0x17, 0xE8, 0xE3, 0x6C, 0x62, 0x68, 0xA0, 0x20, 0xD6, 0xB9, 0x5D, 0x50, 0xC0, 0x5F, 0x06, 0x8C,
+    0xB4, 0x25, 0xC7, 0x49, 0xAB, 0xC7, 0x7E, 0x98, 0x05, 0x8C, 0xE4, 0x68, 0xF2, 0xDA, 0x60, 0x01,
+    0x8C, 0x5F, 0x4E, 0xF4, 0xD0, 0x77, 0x4E, 0x18, 0x74, 0x8C, 0xA1, 0x00, 0xAF, 0xAD, 0xED, 0x5D,
+    0x97, 0x30, 0x79, 0x01, 0xDB, 0x3C, 0xF7, 0xDF, 0x62, 0xA3, 0xE4, 0x6B, 0xAB, 0x8E, 0x75, 0x7D,
+    0xAD, 0x05, 0x54, 0x97, 0xDB, 0xF3, 0x01, 0xA7, 0x7D, 0x75, 0x3E, 0x96, 0x32, 0x8B, 0xBE, 0xF4,
+    0xEA, 0x7E, 0xAF, 0x4A, 0x30, 0xDA, 0x39, 0x62, 0x68, 0x10, 0x70, 0xF4, 0x3C, 0xA7, 0x70, 0x78,
+    0xA1, 0x79, 0x83, 0x0F, 0xC4, 0x14, 0xA7, 0xC4, 0xE0, 0xA0, 0x47, 0x8C, 0x1D, 0x53, 0x2A, 0x33,
+    0xAF, 0x64, 0xB6, 0xBC, 0x50, 0xAB, 0x1F, 0x55, 0x00, 0x98, 0x72, 0xCD, 0x00, 0x00, 0x00,
+};
+
+// saved.html: 234 bytes, 211 gzipped
+static const uint8_t PORTAL_SAVED_HTML_GZ[] PROGMEM = {
+    0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x35, 0x8F, 0xC1, 0x6A, 0xC3, 0x30,
+    0x10, 0x44, 0xEF, 0xFD, 0x8A, 0x85, 0x1E, 0x72, 0xB2, 0xAD, 0x5C, 0x2D, 0x55, 0x50, 0x4C, 0x03,
+    0x86, 0x34, 0x85, 0xAA, 0xF9, 0x00, 0x59, 0x92, 0x1D, 0x51, 0x7B, 0x57, 0x48, 0xDB, 0x12, 0xFF,
+    0x7D, 0x95, 0x43, 0x99, 0xD3, 0x63, 0xE0, 0x31, 0xA3, 0x26, 0xF2, 0x3B, 0x14, 0xDE, 0xD7, 0xF0,
+    0x72, 0x98, 0xAC, 0xFB, 0x5E, 0x32, 0xFD, 0xA0, 0x6F, 0x1C, 0xAD, 0x94, 0xFB, 0x67, 0xE1, 0x1F,
+    0x91, 0xF0, 0x8F, 0x62, 0x9E, 0x85, 0x90, 0x30, 0x13, 0x72, 0x33, 0xDB, 0x2D, 0xAE, 0x7B, 0x0F,
+    0x1B, 0x21, 0x95, 0x64, 0x5D, 0x90, 0xC0, 0xE1, 0xCE, 0x8D, 0x5D, 0xE3, 0x82, 0xBD, 0x0B, 0xC8,
+    0x21, 0x4B, 0x48, 0xD6, 0xFB, 0x88, 0x4B, 0xC3, 0x94, 0x7A, 0x38, 0x0A, 0x91, 0xEE, 0xF2, 0xA0,
+    0xD5, 0xED, 0xA8, 0xBF, 0x3E, 0x5F, 0x2F, 0xE6, 0x7D, 0x34, 0x66, 0xFC, 0xB8, 0x80, 0xB9, 0x0E,
+    0xC3, 0x9B, 0x31, 0xA7, 0xEB, 0x59, 0x75, 0xB5, 0x53, 0x49, 0x0F, 0x39, 0xF8, 0xAA, 0x88, 0x76,
+    0x2D, 0x50, 0xEC, 0x6F, 0xF0, 0x2D, 0x8C, 0x18, 0x2B, 0x73, 0xB5, 0x41, 0xD9, 0x0B, 0x87, 0x0D,
+    0x72, 0x98, 0x88, 0x18, 0x2C, 0xFA, 0xBA, 0x10, 0x31, 0x38, 0x8E, 0x84, 0x60, 0xB9, 0x76, 0x89,
+    0xDB, 0xB6, 0x55, 0x5D, 0xD2, 0xAA, 0x7B, 0x5C, 0xD4, 0x4F, 0x7F, 0xF0, 0x7D, 0x97, 0xA4, 0xEA,
+    0x00, 0x00, 0x00,
+};
+
+static const PortalAsset PORTAL_ASSETS[] = {
+    {"/", "text/html", "\"0ea654c8c9856fb9\"", PORTAL_INDEX_HTML_GZ, sizeof(PORTAL_INDEX_HTML_GZ)},
+    {"/save_error.html", "text/html", "\"5427bbc03a5450f3\"", PORTAL_SAVE_ERROR_HTML_GZ, sizeof(PORTAL_SAVE_ERROR_HTML_GZ)},
+    {"/saved.html", "text/html", "\"2c97437ddb2347a2\"", PORTAL_SAVED_HTML_GZ, sizeof(PORTAL_SAVED_HTML_GZ)},
+};
+#define PORTAL_ASSET_COUNT 3
+
+#endif // PORTAL_ASSETS_H
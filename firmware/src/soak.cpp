@@ -0,0 +1,267 @@
+#include "soak.h"
+
+#if SOAK_MODE
+
+#include <ArduinoJson.h>
+#include "metrics.h"
+#include "deferred_log.h"
+#include "flag_drawing.h"
+#include "flag_programs.h"
+#include "led_timeline.h"
+
+// ******************************************************
+// ** SOAK DRIVER (GET /api/debug/soak) **
+// ******************************************************
+// Generates job payloads and pushes them through submitJob(), so every job takes
+// the production path: JSON parse, LED timeline, render (ahead), completion body.
+// The LED timeline runs on a scaled clock, which takes the fixed blink time out
+// of the run. Every SOAK_SAMPLE_EVERY_JOBS accepted jobs the heap is sampled, and
+// a least-squares fit over the samples flags slow leaks and fragmentation growth
+// long before they would end in an out-of-memory reboot.
+
+struct SoakSample
+{
+    uint32_t jobs;
+    uint32_t freeHeap;
+    uint32_t largestBlock;
+    uint16_t fragmentationPermille; // 1000 - largest block / free heap
+};
+
+static WebServer *soakServer = nullptr;
+static SoakSubmitFn soakSubmit = nullptr;
+static unsigned long soakStartMs = 0;
+static uint32_t jobsAccepted = 0;
+static uint32_t jobsRejected = 0;
+static uint32_t busyRetries = 0;
+
+static SoakSample samples[SOAK_MAX_SAMPLES];
+static int sampleCount = 0;
+static uint32_t sampleInterval = SOAK_SAMPLE_EVERY_JOBS;
+static bool leakReported = false;
+static bool fragmentationReported = false;
+
+// Names exercise the buffer limits: short, long (truncated), multi-byte UTF-8 and quotes.
+static const char *const SOAK_NAMES[] = {
+    "Ada",
+    "Grace Hopper",
+    "Zo\xC3\xAB \xC5\x81ukasiewicz",
+    "A very long display name that wraps and then gets truncated on the second line",
+    "\xE5\xB1\xB1\xE7\x94\xB0\xE5\xA4\xAA\xE9\x83\x8E",
+    "O\\\"Brien",
+};
+static const int NUM_SOAK_NAMES = sizeof(SOAK_NAMES) / sizeof(SOAK_NAMES[0]);
+
+static const char *const SOAK_COUNTRIES[] = {"Netherlands", "Brazil", "Japan", "New Zealand", "Unknown Location"};
+static const int NUM_SOAK_COUNTRIES = sizeof(SOAK_COUNTRIES) / sizeof(SOAK_COUNTRIES[0]);
+
+static SoakSample takeSample()
+{
+    SoakSample s;
+    s.jobs = jobsAccepted;
+    s.freeHeap = ESP.getFreeHeap();
+    s.largestBlock = ESP.getMaxAllocHeap();
+    s.fragmentationPermille = s.freeHeap ? 1000 - (uint16_t)((uint64_t)s.largestBlock * 1000 / s.freeHeap) : 0;
+    return s;
+}
+
+// Least-squares slope of a sample field against the job count, per 1000 jobs. Skips the warm-up samples.
+template <typename Field>
+static float slopePerKJob(Field field)
+{
+    int n = sampleCount - SOAK_WARMUP_SAMPLES;
+    if (n < 3)
+    {
+         return 0;
+    }
+    double sx = 0, sy = 0, sxx = 0, sxy = 0;
+    for (int i = SOAK_WARMUP_SAMPLES; i < sampleCount; i++)
+    {
+         double x = samples[i].jobs / 1000.0;
+         double y = field(samples[i]);
+         sx += x;
+         sy += y;
+         sxx += x * x;
+         sxy += x * y;
+    }
+    double denom = n * sxx - sx * sx;
+    return denom != 0 ? (float)((n * sxy - sx * sy) / denom) : 0;
+}
+
+static float heapSlope()
+{
+    return slopePerKJob([](const SoakSample &s) { return (double)s.freeHeap; });
+}
+
+static float fragmentationSlope()
+{
+    return slopePerKJob([](const SoakSample &s) { return (double)s.fragmentationPermille; });
+}
+
+static void recordSample()
+{
+    if (sampleCount == SOAK_MAX_SAMPLES)
+    {
+         // Keep the whole run in view: drop every other sample and halve the sampling rate
+         for (int i = 0; i < SOAK_MAX_SAMPLES / 2; i++)
+         {
+             samples[i] = samples[i * 2];
+         }
+         sampleCount = SOAK_MAX_SAMPLES / 2;
+         sampleInterval *= 2;
+    }
+    SoakSample s = takeSample();
+    samples[sampleCount++] = s;
+
+    float heapTrend = heapSlope();
+    float fragTrend = fragmentationSlope();
+    LOG_INFO("Soak: %lu jobs, heap %lu free / %lu min / %lu largest, frag %u permille, trend %ld B/kjob\n",
+             (unsigned long)s.jobs, (unsigned long)s.freeHeap, (unsigned long)ESP.getMinFreeHeap(),
+             (unsigned long)s.largestBlock, (unsigned)s.fragmentationPermille, (long)heapTrend);
+
+    if (!leakReported && heapTrend < -SOAK_LEAK_BYTES_PER_KJOB)
+    {
+         leakReported = true;
+         LOG_WARN("Soak: free heap falling by %ld bytes per 1000 jobs - probable leak\n", (long)-heapTrend);
+    }
+    if (!fragmentationReported && fragTrend > SOAK_FRAG_PERMILLE_PER_KJOB)
+    {
+         fragmentationReported = true;
+         LOG_WARN("Soak: fragmentation growing by %ld permille per 1000 jobs\n", (long)fragTrend);
+    }
+}
+
+// Picks a flag so every per-job renderer is exercised: hand-written codes (mostly served
+// from the prerender cache), any ISO code from the bytecode table (drawn live, from the
+// flag pack when it has art for the code, else by the interpreter) and an unknown code.
+static const char *pickFlag(uint32_t r)
+{
+    uint32_t kind = r % 16;
+    if (kind == 0)
+    {
+         return "ZZ";
+    }
+    if (kind < 6)
+    {
+         return CUSTOM_FLAG_CODES[(r >> 4) % NUM_CUSTOM_FLAG_CODES];
+    }
+    return FLAG_PROGRAMS[(r >> 4) % NUM_FLAG_PROGRAMS].code;
+}
+
+// Builds a varied job payload. About one in eight brings its own LED sequence.
+static size_t buildJob(char *buf, size_t len)
+{
+    uint32_t r = esp_random();
+    const char *name = SOAK_NAMES[r % NUM_SOAK_NAMES];
+    const char *country = SOAK_COUNTRIES[(r >> 8) % NUM_SOAK_COUNTRIES];
+    const char *flag = pickFlag(esp_random());
+
+    int n = snprintf(buf, len, "{\"name\":\"%s\",\"country\":\"%s\",\"flag\":\"%s\"", name, country, flag);
+    if ((r >> 24) % 8 == 0)
+    {
+         n += snprintf(buf + n, len - n,
+                       ",\"sequence\":{\"repeat\":2,\"keyframes\":[{\"color\":\"#FF00FF\",\"ms\":200,\"fade\":true},{\"color\":65280,\"ms\":100}]}");
+    }
+    n += snprintf(buf + n, len - n, "}");
+    return min<size_t>(n, len - 1);
+}
+
+static void handleSoakReport()
+{
+    uint32_t elapsedMs = millis() - soakStartMs;
+    SoakSample now = takeSample();
+
+    JsonDocument doc;
+    doc["time_scale"] = SOAK_TIME_SCALE;
+    doc["elapsed_s"] = elapsedMs / 1000;
+    doc["jobs"] = jobsAccepted;
+    doc["jobs_per_s"] = elapsedMs ? jobsAccepted * 1000.0f / elapsedMs : 0;
+    doc["rejected"] = jobsRejected;
+    doc["busy_retries"] = busyRetries;
+
+    JsonObject heap = doc["heap"].to<JsonObject>();
+    heap["free"] = now.freeHeap;
+    heap["min_free"] = ESP.getMinFreeHeap(); // High-water mark of heap use
+    heap["largest_block"] = now.largestBlock;
+    heap["fragmentation_permille"] = now.fragmentationPermille;
+    heap["trend_bytes_per_kjob"] = heapSlope();
+    heap["frag_trend_permille_per_kjob"] = fragmentationSlope();
+    heap["leak_suspected"] = leakReported;
+    heap["fragmentation_growing"] = fragmentationReported;
+
+    // Per-stage CPU time, from the same histograms /metrics exports
+    static const MetricHistogram STAGES[] = {HISTOGRAM_JSON_PARSE, HISTOGRAM_DRAW_JOB_DATA, HISTOGRAM_FRAME_SWAP, HISTOGRAM_COMPLETION_RTT, HISTOGRAM_LOOP_ITERATION};
+    static const char *STAGE_NAMES[] = {"json_parse", "render", "frame_swap", "completion", "loop_iteration"};
+    JsonObject stages = doc["stages"].to<JsonObject>();
+    for (int i = 0; i < (int)(sizeof(STAGES) / sizeof(STAGES[0])); i++)
+    {
+         uint32_t count;
+         uint64_t sum;
+         metricsHistogramTotals(STAGES[i], &count, &sum);
+         JsonObject stage = stages[STAGE_NAMES[i]].to<JsonObject>();
+         stage["count"] = count;
+         stage["mean_us"] = count ? (uint32_t)(sum / count) : 0;
+         stage["total_ms"] = (uint32_t)(sum / 1000);
+    }
+
+    JsonArray series = doc["samples"].to<JsonArray>();
+    for (int i = 0; i < sampleCount; i++)
+    {
+         JsonArray row = series.add<JsonArray>();
+         row.add(samples[i].jobs);
+         row.add(samples[i].freeHeap);
+         row.add(samples[i].largestBlock);
+    }
+
+    String body;
+    serializeJson(doc, body);
+    soakServer->send(200, "application/json", body);
+}
+
+// --- PUBLIC API ---
+
+void setupSoak(WebServer &server, SoakSubmitFn submit)
+{
+    soakServer = &server;
+    soakSubmit = submit;
+    soakStartMs = millis();
+    ledTimelineSetTimeScale(SOAK_TIME_SCALE);
+    server.on("/api/debug/soak", HTTP_GET, handleSoakReport);
+    samples[sampleCount++] = takeSample();
+    LOG_WARN("SOAK MODE: synthetic jobs at %ux speed. Report on GET /api/debug/soak\n", (unsigned)SOAK_TIME_SCALE);
+}
+
+void soakTick()
+{
+    if (soakSubmit == nullptr)
+    {
+         return;
+    }
+
+    char payload[320];
+    size_t len = buildJob(payload, sizeof(payload));
+    const char *response;
+    int status = soakSubmit(payload, len, &response);
+    if (status == 429)
+    {
+         busyRetries++;
+         return;
+    }
+    if (status >= 400)
+    {
+         jobsRejected++;
+         return;
+    }
+
+    jobsAccepted++;
+    if (jobsAccepted % sampleInterval == 0)
+    {
+         recordSample();
+    }
+}
+
+#else
+
+void setupSoak(WebServer &, SoakSubmitFn) {}
+void soakTick() {}
+
+#endif // SOAK_MODE
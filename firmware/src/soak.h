@@ -0,0 +1,36 @@
+#ifndef SOAK_H
+#define SOAK_H
+
+#include <Arduino.h>
+#include <WebServer.h>
+
+// --- SOAK MODE CONFIGURATION ---
+// Build the "soak" PlatformIO environment (-D SOAK_MODE=1) to have the device feed
+// itself synthetic jobs through the real pipeline and watch the heap for trends.
+#ifndef SOAK_MODE
+#define SOAK_MODE 0
+#endif
+#ifndef SOAK_TIME_SCALE
+#define SOAK_TIME_SCALE 100        // Virtual clock: LED sequences run this many times faster
+#endif
+#define SOAK_SAMPLE_EVERY_JOBS 500 // Heap sample interval
+#define SOAK_MAX_SAMPLES 64        // Retained samples; older ones are thinned out 2:1 when full
+#define SOAK_WARMUP_SAMPLES 4      // Samples ignored by the trend fit (caches, sockets, first allocations)
+#define SOAK_LEAK_BYTES_PER_KJOB 32   // Free-heap decline that is reported as a leak
+#define SOAK_FRAG_PERMILLE_PER_KJOB 2 // Fragmentation growth that is reported (0.1% units)
+
+// Same contract as submitJob() in main.cpp: returns the HTTP status and sets the response body.
+typedef int (*SoakSubmitFn)(const char *json, size_t length, const char **response);
+
+/**
+ * @brief Registers GET /api/debug/soak and switches the LED timeline to the virtual clock.
+ * @param submit Entry point jobs are pushed through (the same one POST /api/job/start uses).
+ */
+void setupSoak(WebServer &server, SoakSubmitFn submit);
+
+/**
+ * @brief Offers the pipeline a new synthetic job and samples the heap. Called once per loop() iteration.
+ */
+void soakTick();
+
+#endif // SOAK_H
@@ -0,0 +1,57 @@
+#include "span_canvas.h"
+#include "pixel_kernels.h"
+
+// ******************************************************
+// ** SPAN CANVAS (GFX drawing into caller-owned frames) **
+// ******************************************************
+// Adafruit_GFX reduces text and shapes to pixels, spans and rectangles; those are
+// clipped once here and written straight into the frame.
+
+SpanCanvas16::SpanCanvas16(uint16_t w, uint16_t h, uint16_t *buffer) : Adafruit_GFX(w, h), buffer(buffer)
+{
+}
+
+void SpanCanvas16::drawPixel(int16_t x, int16_t y, uint16_t color)
+{
+    if (x >= 0 && y >= 0 && x < _width && y < _height)
+    {
+         buffer[y * _width + x] = color;
+    }
+}
+
+void SpanCanvas16::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color)
+{
+    fillRect(x, y, w, 1, color);
+}
+
+void SpanCanvas16::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color)
+{
+    fillRect(x, y, 1, h, color);
+}
+
+void SpanCanvas16::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+{
+    if (w < 0)
+    {
+         x += w + 1;
+         w = -w;
+    }
+    if (h < 0)
+    {
+         y += h + 1;
+         h = -h;
+    }
+    int x0 = constrain((int)x, 0, (int)_width);
+    int x1 = constrain(x + w, 0, (int)_width);
+    int y0 = constrain((int)y, 0, (int)_height);
+    int y1 = constrain(y + h, 0, (int)_height);
+    for (int row = y0; row < y1 && x0 < x1; row++)
+    {
+         rgb565Fill(buffer + row * _width + x0, color, x1 - x0);
+    }
+}
+
+void SpanCanvas16::fillScreen(uint16_t color)
+{
+    rgb565Fill(buffer, color, (size_t)_width * _height);
+}
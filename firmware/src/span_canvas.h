@@ -0,0 +1,29 @@
+#ifndef SPAN_CANVAS_H
+#define SPAN_CANVAS_H
+
+#include <Arduino.h>
+#include <Adafruit_GFX.h>
+
+/**
+ * @brief An RGB565 canvas over memory it does not own (a PSRAM arena frame), so frames can be
+ * placed by the memory tiers instead of GFXcanvas16's own malloc. Horizontal spans and
+ * rectangles go through rgb565Fill. Unrotated only: setRotation() is not supported.
+ */
+class SpanCanvas16 : public Adafruit_GFX
+{
+public:
+    SpanCanvas16(uint16_t w, uint16_t h, uint16_t *buffer);
+
+    void drawPixel(int16_t x, int16_t y, uint16_t color) override;
+    void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override;
+    void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override;
+    void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override;
+    void fillScreen(uint16_t color) override;
+
+    uint16_t *getBuffer() const { return buffer; }
+
+private:
+    uint16_t *buffer;
+};
+
+#endif // SPAN_CANVAS_H
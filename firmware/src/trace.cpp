@@ -0,0 +1,126 @@
+#include "trace.h"
+#include <atomic>
+#include <esp_timer.h>
+
+// ******************************************************
+// ** CHROME TRACE RING BUFFER (GET /api/debug/trace) **
+// ******************************************************
+// Writers claim a slot with a single atomic increment, fill it, then publish it
+// by storing its sequence number last. The dump only emits slots whose sequence
+// is unchanged before and after copying, so torn records are skipped, never shown.
+
+static_assert((TRACE_BUFFER_SIZE & (TRACE_BUFFER_SIZE - 1)) == 0, "TRACE_BUFFER_SIZE must be a power of two");
+
+struct TraceRecord
+{
+    std::atomic<uint32_t> seq; // Index + 1 once published, 0 while being written
+    const char *name;
+    uint32_t timestamp;        // Low 32 bits of esp_timer_get_time() (us)
+    int32_t arg;
+    char phase;
+    uint8_t core;
+};
+
+static TraceRecord traceRing[TRACE_BUFFER_SIZE];
+static std::atomic<uint32_t> traceHead(0);
+static WebServer *traceServer = nullptr;
+
+void traceEvent(const char *name, char phase, int32_t arg)
+{
+    uint32_t index = traceHead.fetch_add(1, std::memory_order_relaxed);
+    TraceRecord &r = traceRing[index & (TRACE_BUFFER_SIZE - 1)];
+    r.seq.store(0, std::memory_order_relaxed);
+    r.name = name;
+    r.timestamp = (uint32_t)esp_timer_get_time();
+    r.arg = arg;
+    r.phase = phase;
+    r.core = (uint8_t)xPortGetCoreID();
+    r.seq.store(index + 1, std::memory_order_release);
+}
+
+// --- CHUNKED JSON DUMP ---
+
+static char traceOut[1024];
+static size_t traceOutLen = 0;
+
+static void traceFlush()
+{
+    if (traceOutLen > 0)
+    {
+         traceServer->sendContent(traceOut, traceOutLen);
+         traceOutLen = 0;
+    }
+}
+
+static void traceAppend(const char *text, size_t len)
+{
+    if (traceOutLen + len > sizeof(traceOut))
+    {
+         traceFlush();
+    }
+    memcpy(traceOut + traceOutLen, text, len);
+    traceOutLen += len;
+}
+
+static void handleTraceDump()
+{
+    traceServer->setContentLength(CONTENT_LENGTH_UNKNOWN);
+    traceServer->sendHeader("Content-Disposition", "inline; filename=\"web2wire-trace.json\"");
+    traceServer->send(200, "application/json", "");
+
+    // Unwrap the 32-bit timestamps against a single 64-bit reference taken now.
+    int64_t now64 = esp_timer_get_time();
+    uint32_t now32 = (uint32_t)now64;
+    uint32_t head = traceHead.load(std::memory_order_acquire);
+    uint32_t first = head > TRACE_BUFFER_SIZE ? head - TRACE_BUFFER_SIZE : 0;
+
+    const char *prefix = "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    traceAppend(prefix, strlen(prefix));
+
+    bool firstEvent = true;
+    for (uint32_t i = first; i < head; i++)
+    {
+         TraceRecord &r = traceRing[i & (TRACE_BUFFER_SIZE - 1)];
+         if (r.seq.load(std::memory_order_acquire) != i + 1)
+         {
+             continue;
+         }
+         const char *name = r.name;
+         uint32_t ts = r.timestamp;
+         int32_t arg = r.arg;
+         char phase = r.phase;
+         uint8_t core = r.core;
+         if (r.seq.load(std::memory_order_acquire) != i + 1)
+         {
+             continue; // Overwritten while we were copying it
+         }
+
+         int64_t ts64 = now64 - (int64_t)(uint32_t)(now32 - ts);
+         char line[160];
+         int len = snprintf(line, sizeof(line),
+                            "%s{\"name\":\"%s\",\"ph\":\"%c\",\"ts\":%lld,\"pid\":1,\"tid\":%u%s",
+                            firstEvent ? "" : ",", name, phase, (long long)ts64, core,
+                            phase == 'i' ? ",\"s\":\"t\"" : "");
+         if (len > 0 && len < (int)sizeof(line) && phase != 'E')
+         {
+             len += snprintf(line + len, sizeof(line) - len, ",\"args\":{\"v\":%ld}", (long)arg);
+         }
+         if (len > 0 && len < (int)sizeof(line) - 1)
+         {
+             line[len++] = '}';
+             traceAppend(line, len);
+             firstEvent = false;
+         }
+    }
+
+    const char *suffix = "]}";
+    traceAppend(suffix, strlen(suffix));
+    traceFlush();
+    traceServer->sendContent("");
+}
+
+void setupTrace(WebServer &server)
+{
+    traceServer = &server;
+    server.on("/api/debug/trace", HTTP_GET, handleTraceDump);
+}
@@ -0,0 +1,59 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <Arduino.h>
+#include <WebServer.h>
+
+// --- TRACE RING BUFFER CONFIGURATION ---
+// Size must be a power of two. Each record is 20 bytes, so 512 records = 10 KB.
+#ifndef TRACE_BUFFER_SIZE
+#define TRACE_BUFFER_SIZE 512
+#endif
+
+// Set TRACE_ENABLED=0 in build_flags to compile every trace point out.
+#ifndef TRACE_ENABLED
+#define TRACE_ENABLED 1
+#endif
+
+/**
+ * @brief Records a begin ('B'), end ('E') or instant ('i') event.
+ * Lock-free and allocation-free; callable from any task.
+ * @param name Must point to storage that outlives the buffer (string literal or __func__).
+ * @param phase Chrome trace phase character.
+ * @param arg Optional integer shown under "args" in the viewer.
+ */
+void traceEvent(const char *name, char phase, int32_t arg = 0);
+
+/**
+ * @brief Registers GET /api/debug/trace, which dumps the ring in Chrome trace JSON (open in Perfetto).
+ */
+void setupTrace(WebServer &server);
+
+// RAII helper: emits 'B' on construction and 'E' when the scope ends.
+class TraceScope
+{
+public:
+    explicit TraceScope(const char *name) : _name(name) { traceEvent(_name, 'B'); }
+    ~TraceScope() { traceEvent(_name, 'E'); }
+
+private:
+    const char *_name;
+};
+
+#if TRACE_ENABLED
+#define TRACE_CONCAT_INNER(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_INNER(a, b)
+#define TRACE_SCOPE(name) TraceScope TRACE_CONCAT(_traceScope, __LINE__)(name)
+#define TRACE_FUNCTION() TRACE_SCOPE(__func__)
+#define TRACE_BEGIN(name, arg) traceEvent(name, 'B', arg)
+#define TRACE_END(name) traceEvent(name, 'E')
+#define TRACE_INSTANT(name, arg) traceEvent(name, 'i', arg)
+#else
+#define TRACE_SCOPE(name) do {} while (0)
+#define TRACE_FUNCTION() do {} while (0)
+#define TRACE_BEGIN(name, arg) do {} while (0)
+#define TRACE_END(name) do {} while (0)
+#define TRACE_INSTANT(name, arg) do {} while (0)
+#endif
+
+#endif // TRACE_H
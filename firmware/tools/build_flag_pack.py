@@ -0,0 +1,168 @@
+"""
+Builds the flag pack image for the "flagpack" partition (format: firmware/src/flag_pack.h).
+
+Sources are applied in order, later ones replacing earlier art for the same code:
+  --programs           the built-in bytecode table (src/flag_programs.cpp), as a starting point
+  --art DIR            XX.png (any size up to 255x255, stored as RGB565) and XX.fp (raw bytecode)
+
+Then flash it, either over USB:
+    esptool.py --chip esp32s3 write_flash 0x310000 flagpack.bin
+or over the network to a running board:
+    curl -F pack=@flagpack.bin http://<device-ip>/api/flags/pack
+
+Usage:
+    python build_flag_pack.py --programs --art flags/ -o flagpack.bin
+    python build_flag_pack.py --dump flagpack.bin
+"""
+import argparse
+import os
+import re
+import struct
+import sys
+import zlib
+
+SRC_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'src')
+
+MAGIC = b'W2FP'
+VERSION = 1
+SLOTS = 26 * 26
+HEADER = struct.Struct('<4sHHII')       # magic, version, flagCount, totalSize, crc32
+ENTRY = struct.Struct('<BBBBII')        # kind, width, height, reserved, offset, length
+KIND_BITMAP = 1
+KIND_PROGRAM = 2
+PARTITION_SIZE = 0xE0000                # partitions_flagpack.csv
+
+
+def slot_of(code):
+    code = code.upper()
+    if len(code) != 2 or not code.isalpha() or not code.isascii():
+        raise ValueError(f"not a 2-letter code: {code!r}")
+    return (ord(code[0]) - ord('A')) * 26 + (ord(code[1]) - ord('A'))
+
+
+def _enum_values(header_text, enum_name):
+    """Maps enumerator names to values for a simple C enum (implicit increments, = N, hex)."""
+    body = re.search(r'enum\s+' + enum_name + r'\b[^{]*\{(.*?)\};', header_text, re.S).group(1)
+    values, next_value = {}, 0
+    for line in body.splitlines():
+        line = line.split('//')[0].strip().rstrip(',')
+        if not line:
+            continue
+        name, _, value = (part.strip() for part in line.partition('='))
+        next_value = int(value, 0) if value else next_value
+        values[name] = next_value
+        next_value += 1
+    return values
+
+
+def load_builtin_programs():
+    """Reads the bytecode table compiled into the firmware: {code: bytes}."""
+    with open(os.path.join(SRC_DIR, 'flag_programs.h'), encoding='utf-8') as f:
+        header = f.read()
+    with open(os.path.join(SRC_DIR, 'flag_programs.cpp'), encoding='utf-8') as f:
+        source = f.read()
+    symbols = {**_enum_values(header, 'FlagOpcode'), **_enum_values(header, 'FlagColor')}
+
+    arrays = {}
+    for name, body in re.findall(r'static const uint8_t (FP_\w+)\[\] = \{(.*?)\};', source, re.S):
+        tokens = [t.strip() for t in body.replace('\n', ' ').split(',') if t.strip()]
+        arrays[name] = bytes(symbols[t] if t in symbols else int(t, 0) for t in tokens)
+
+    programs = {}
+    for code, array in re.findall(r'\{"([A-Z]{2})", (FP_\w+), sizeof', source):
+        programs[code] = arrays[array]
+    return programs
+
+
+def rgb565(r, g, b):
+    return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3)
+
+
+def load_png(path):
+    try:
+        from PIL import Image
+    except ImportError:
+        sys.exit("PNG art needs Pillow (pip install pillow).")
+    image = Image.open(path).convert('RGB')
+    width, height = image.size
+    if width > 255 or height > 255:
+        raise ValueError(f"{path}: {width}x{height} is larger than 255x255")
+    pixels = [rgb565(*image.getpixel((x, y))) for y in range(height) for x in range(width)]
+    return width, height, struct.pack(f'<{len(pixels)}H', *pixels)
+
+
+def build(entries):
+    """entries: {code: (kind, width, height, data)} -> pack bytes."""
+    index = [ENTRY.pack(0, 0, 0, 0, 0, 0)] * SLOTS
+    data = bytearray()
+    data_start = HEADER.size + SLOTS * ENTRY.size
+    for code in sorted(entries):
+        kind, width, height, blob = entries[code]
+        if (data_start + len(data)) % 2:
+            data.append(0)  # Bitmaps are read as 16-bit words
+        index[slot_of(code)] = ENTRY.pack(kind, width, height, 0, data_start + len(data), len(blob))
+        data += blob
+    body = b''.join(index) + bytes(data)
+    total = HEADER.size + len(body)
+    return HEADER.pack(MAGIC, VERSION, len(entries), total, zlib.crc32(body)) + body
+
+
+def dump(path):
+    with open(path, 'rb') as f:
+        pack = f.read()
+    magic, version, count, total, crc = HEADER.unpack_from(pack)
+    crc_ok = zlib.crc32(pack[HEADER.size:total]) == crc
+    print(f"{path}: magic={magic!r} version={version} flags={count} size={total} crc32={crc:08x} ({'ok' if crc_ok else 'MISMATCH'})")
+    for slot in range(SLOTS):
+        kind, width, height, _, offset, length = ENTRY.unpack_from(pack, HEADER.size + slot * ENTRY.size)
+        if kind:
+            code = chr(ord('A') + slot // 26) + chr(ord('A') + slot % 26)
+            shape = f"bitmap {width}x{height}" if kind == KIND_BITMAP else "program"
+            print(f"  {code}  {shape:<16} {length:6d} bytes @ {offset}")
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Build or inspect a Web2Wire flag pack.")
+    parser.add_argument('--programs', action='store_true', help="Start from the built-in bytecode table")
+    parser.add_argument('--art', action='append', default=[], help="Directory of XX.png / XX.fp files (repeatable)")
+    parser.add_argument('-o', '--output', default='flagpack.bin')
+    parser.add_argument('--dump', metavar='PACK', help="Print the index of an existing pack and exit")
+    args = parser.parse_args()
+
+    if args.dump:
+        dump(args.dump)
+        return
+
+    entries = {}
+    if args.programs:
+        for code, program in load_builtin_programs().items():
+            entries[code] = (KIND_PROGRAM, 0, 0, program)
+    for directory in args.art:
+        for filename in sorted(os.listdir(directory)):
+            code, ext = os.path.splitext(filename)
+            path = os.path.join(directory, filename)
+            if ext.lower() == '.png':
+                width, height, pixels = load_png(path)
+                entries[code.upper()] = (KIND_BITMAP, width, height, pixels)
+            elif ext.lower() == '.fp':
+                with open(path, 'rb') as f:
+                    program = f.read()
+                if not program or program[-1] != 0:
+                    sys.exit(f"{path}: a program must end with FOP_END (0)")
+                entries[code.upper()] = (KIND_PROGRAM, 0, 0, program)
+            else:
+                continue
+            slot_of(code)  # Validates the file name
+    if not entries:
+        sys.exit("Nothing to pack: pass --programs and/or --art DIR.")
+
+    pack = build(entries)
+    if len(pack) > PARTITION_SIZE:
+        sys.exit(f"Pack is {len(pack)} bytes; the flagpack partition holds {PARTITION_SIZE}.")
+    with open(args.output, 'wb') as f:
+        f.write(pack)
+    print(f"Wrote {args.output}: {len(entries)} flags, {len(pack)} bytes ({100 * len(pack) / PARTITION_SIZE:.1f}% of the partition).")
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,110 @@
+"""
+Precompresses the captive portal pages (firmware/portal/) into src/portal_assets.h.
+
+Each file is gzipped once at build time and stored in flash with an ETag (a hash of the
+compressed bytes), so the device sends it as-is with Content-Encoding: gzip and answers
+revalidations with 304. index.html is served on "/", every other file on "/<name>".
+
+Runs before every PlatformIO build (extra_scripts = pre:tools/build_portal_assets.py) and
+only rewrites the header when a page changed. It can also be run by hand:
+    python tools/build_portal_assets.py
+"""
+import gzip
+import hashlib
+import os
+
+CONTENT_TYPES = {
+    '.html': 'text/html',
+    '.css': 'text/css',
+    '.js': 'application/javascript',
+    '.svg': 'image/svg+xml',
+    '.txt': 'text/plain',
+}
+
+
+def c_identifier(name):
+    return 'PORTAL_' + ''.join(ch.upper() if ch.isalnum() else '_' for ch in name) + '_GZ'
+
+
+def byte_rows(data, per_row=16):
+    for i in range(0, len(data), per_row):
+        yield '    ' + ', '.join(f'0x{b:02X}' for b in data[i:i + per_row]) + ','
+
+
+def build_header(portal_dir):
+    assets = []
+    for name in sorted(os.listdir(portal_dir)):
+        content_type = CONTENT_TYPES.get(os.path.splitext(name)[1])
+        if content_type is None:
+            continue
+        with open(os.path.join(portal_dir, name), 'rb') as f:
+            raw = f.read()
+        compressed = gzip.compress(raw, compresslevel=9, mtime=0) # mtime=0: same input, same bytes, same ETag
+        assets.append({
+            'name': name,
+            'path': '/' if name == 'index.html' else '/' + name,
+            'type': content_type,
+            'etag': hashlib.sha256(compressed).hexdigest()[:16],
+            'symbol': c_identifier(name),
+            'raw': len(raw),
+            'gzip': compressed,
+        })
+
+    lines = [
+        '// Generated by firmware/tools/build_portal_assets.py from firmware/portal/ -- do not edit.',
+        '#ifndef PORTAL_ASSETS_H',
+        '#define PORTAL_ASSETS_H',
+        '',
+        '#include <Arduino.h>',
+        '',
+        'struct PortalAsset',
+        '{',
+        '    const char *path;        // URI it is served on',
+        '    const char *contentType;',
+        '    const char *etag;        // Quoted, as sent in the ETag header',
+        '    const uint8_t *gzip;     // Precompressed body, read straight from flash',
+        '    size_t gzipLength;',
+        '};',
+        '',
+    ]
+    for asset in assets:
+        lines.append(f"// {asset['name']}: {asset['raw']} bytes, {len(asset['gzip'])} gzipped")
+        lines.append(f"static const uint8_t {asset['symbol']}[] PROGMEM = {{")
+        lines.extend(byte_rows(asset['gzip']))
+        lines.append('};')
+        lines.append('')
+    lines.append('static const PortalAsset PORTAL_ASSETS[] = {')
+    for asset in assets:
+        lines.append(f"    {{\"{asset['path']}\", \"{asset['type']}\", \"\\\"{asset['etag']}\\\"\", "
+                     f"{asset['symbol']}, sizeof({asset['symbol']})}},")
+    lines.append('};')
+    lines.append(f'#define PORTAL_ASSET_COUNT {len(assets)}')
+    lines.append('')
+    lines.append('#endif // PORTAL_ASSETS_H')
+    return '\n'.join(lines) + '\n', assets
+
+
+def generate(project_dir):
+    portal_dir = os.path.join(project_dir, 'portal')
+    header_path = os.path.normpath(os.path.join(project_dir, 'src', 'portal_assets.h'))
+    header, assets = build_header(portal_dir)
+
+    try:
+        with open(header_path, encoding='utf-8') as f:
+            if f.read() == header:
+                return
+    except OSError:
+        pass
+    with open(header_path, 'w', encoding='utf-8') as f:
+        f.write(header)
+    total_raw = sum(a['raw'] for a in assets)
+    total_gzip = sum(len(a['gzip']) for a in assets)
+    print(f"Portal assets: {len(assets)} files, {total_raw} -> {total_gzip} bytes gzipped ({header_path})")
+
+
+try:
+    Import('env')  # noqa: F821 -- defined when PlatformIO runs this as an extra script
+    generate(env.subst('$PROJECT_DIR'))  # noqa: F821
+except NameError:
+    if __name__ == '__main__':
+        generate(os.path.join(os.path.dirname(os.path.abspath(__file__)), '..'))
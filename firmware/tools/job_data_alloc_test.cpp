@@ -0,0 +1,207 @@
+// Host check that a job's parse/copy cycle never touches the heap (src/job_data.cpp).
+//
+// malloc/calloc/realloc and operator new are replaced with counting versions. Each job is
+// parsed the way submitJob() does it (ArduinoJson with a fixed-block allocator standing in
+// for the internal SRAM pools), copied into JobData by jobDataFromJson(), then handed down
+// the pipeline (incoming -> queued -> current) by assignment. Any allocation fails the run.
+// The UTF-8 cut of copyJobText() is checked as well.
+//
+//   g++ -O2 -I<ArduinoJson>/src -I../src ../src/job_data.cpp job_data_alloc_test.cpp -o job_data_test
+//   ./job_data_test
+//
+// glibc only: the counting malloc forwards to __libc_malloc.
+#include "job_data.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+extern "C" void *__libc_malloc(size_t);
+extern "C" void *__libc_calloc(size_t, size_t);
+extern "C" void *__libc_realloc(void *, size_t);
+extern "C" void __libc_free(void *);
+
+static bool counting = false;
+static unsigned long allocations = 0;
+
+extern "C" void *malloc(size_t n)
+{
+    allocations += counting;
+    return __libc_malloc(n);
+}
+
+extern "C" void *calloc(size_t count, size_t n)
+{
+    allocations += counting;
+    return __libc_calloc(count, n);
+}
+
+extern "C" void *realloc(void *ptr, size_t n)
+{
+    allocations += counting;
+    return __libc_realloc(ptr, n);
+}
+
+extern "C" void free(void *ptr)
+{
+    __libc_free(ptr);
+}
+
+void *operator new(size_t n)
+{
+    allocations += counting;
+    void *ptr = __libc_malloc(n ? n : 1);
+    if (!ptr)
+    {
+         throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void *operator new[](size_t n)
+{
+    return operator new(n);
+}
+
+void operator delete(void *ptr) noexcept
+{
+    __libc_free(ptr);
+}
+
+void operator delete[](void *ptr) noexcept
+{
+    __libc_free(ptr);
+}
+
+void operator delete(void *ptr, size_t) noexcept
+{
+    __libc_free(ptr);
+}
+
+void operator delete[](void *ptr, size_t) noexcept
+{
+    __libc_free(ptr);
+}
+
+// Bump allocator over a static block, released as a whole after each job (the firmware's
+// pools hand out fixed blocks instead; what matters here is that neither is the heap).
+class FixedAllocator : public ArduinoJson::Allocator
+{
+public:
+    void *allocate(size_t size) override
+    {
+         size = (size + 7) & ~(size_t)7;
+         if (used + size > sizeof(block))
+         {
+             return nullptr;
+         }
+         last = block + used;
+         used += size;
+         return last;
+    }
+
+    void deallocate(void *) override
+    {
+    }
+
+    void *reallocate(void *ptr, size_t newSize) override
+    {
+         if (ptr == last)
+         {
+             used = (size_t)(last - block); // Grow or shrink the newest block in place
+             return allocate(newSize);
+         }
+         void *moved = allocate(newSize);
+         if (moved && ptr)
+         {
+             memcpy(moved, ptr, newSize);
+         }
+         return moved;
+    }
+
+    void reset()
+    {
+         used = 0;
+         last = nullptr;
+    }
+
+private:
+    alignas(8) unsigned char block[4096];
+    size_t used = 0;
+    unsigned char *last = nullptr;
+};
+
+static const char *const PAYLOADS[] = {
+    "{\"name\":\"Ada\",\"country\":\"United Kingdom\",\"flag\":\"GB\",\"timestamp\":1760000000.5}",
+    "{\"name\":\"Zo\\u00eb \\u00c5ngstr\\u00f6m\",\"country\":\"Sverige\",\"flag\":\"SE\",\"backlog\":3}",
+    // 68 two-byte characters: cut to 31 of them, never in the middle of one
+    "{\"name\":\"\\u00e9\\u00e9\\u00e9\\u00e9\\u00e9\\u00e9\\u00e9\\u00e9\\u00e9\\u00e9\\u00e9\\u00e9\\u00e9\\u00e9"
+    "\\u00e9\\u00e9\\u00e9\\u00e9\\u00e9\\u00e9\\u00e9\\u00e9\\u00e9\\u00e9\\u00e9\\u00e9\\u00e9\\u00e9\\u00e9\\u00e9"
+    "\\u00e9\\u00e9\\u00e9\\u00e9\\u00e9\\u00e9\\u00e9\\u00e9\\u00e9\\u00e9\\u00e9\\u00e9\\u00e9\\u00e9\\u00e9\\u00e9"
+    "\\u00e9\\u00e9\\u00e9\\u00e9\\u00e9\\u00e9\\u00e9\\u00e9\\u00e9\\u00e9\\u00e9\\u00e9\\u00e9\\u00e9\\u00e9\\u00e9"
+    "\\u00e9\\u00e9\\u00e9\\u00e9\\u00e9\\u00e9\",\"country\":\"France\",\"flag\":\"FR\"}",
+    "{\"country\":\"Nowhere\",\"flag\":\"TOOLONG\",\"sequence\":[{\"color\":\"#ff0000\",\"ms\":200}]}",
+    "{}",
+};
+#define NUM_PAYLOADS (int)(sizeof(PAYLOADS) / sizeof(PAYLOADS[0]))
+#define ROUNDS 1000
+
+// True if 's' ends on a character boundary (no dangling lead or continuation bytes).
+static bool wholeUtf8(const char *s)
+{
+    size_t len = strlen(s);
+    size_t i = len;
+    while (i > 0 && ((unsigned char)s[i - 1] & 0xC0) == 0x80)
+    {
+         i--;
+    }
+    if (i == 0)
+    {
+         return len == 0;
+    }
+    unsigned char lead = (unsigned char)s[i - 1];
+    size_t want = lead < 0x80 ? 1 : lead >= 0xF0 ? 4 : lead >= 0xE0 ? 3 : 2;
+    return len - (i - 1) == want;
+}
+
+int main()
+{
+    static FixedAllocator allocator;
+    JobData current = {"Waiting", "for next", "JOB"};
+    JobData queued;
+    int failures = 0;
+
+    counting = true;
+    for (int round = 0; round < ROUNDS; round++)
+    {
+         for (int p = 0; p < NUM_PAYLOADS; p++)
+         {
+             {
+                 JsonDocument doc(&allocator);
+                 if (deserializeJson(doc, PAYLOADS[p], strlen(PAYLOADS[p])))
+                 {
+                     failures++;
+                     continue;
+                 }
+                 JobData incoming;
+                 jobDataFromJson(incoming, doc);
+                 queued = incoming;
+             }
+             allocator.reset();
+             current = queued;
+             failures += !wholeUtf8(current.name) || !wholeUtf8(current.country) || strlen(current.flag) >= sizeof(current.flag);
+         }
+    }
+    counting = false;
+
+    printf("%d jobs, %lu heap allocations, %d bad copies\n", ROUNDS * NUM_PAYLOADS, allocations, failures);
+    printf("last job: name \"%s\" (%zu bytes), country \"%s\", flag \"%s\"\n",
+           current.name, strlen(current.name), current.country, current.flag);
+    if (allocations != 0 || failures != 0)
+    {
+         printf("FAIL\n");
+         return 1;
+    }
+    printf("OK\n");
+    return 0;
+}
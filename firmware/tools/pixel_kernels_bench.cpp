@@ -0,0 +1,147 @@
+// Host microbenchmark and self-check for src/pixel_kernels.cpp.
+//
+// Every kernel is checked against a one-pixel-at-a-time scalar reference (the way Adafruit
+// GFX writes, kept out of the vectorizer), then both are timed on the frame sizes the
+// firmware uses.
+//
+//   g++ -O2 -march=native -I../src ../src/pixel_kernels.cpp pixel_kernels_bench.cpp -o pixel_bench
+//   ./pixel_bench
+//
+// The device's SWAR path can be checked here too (it is plain C):
+//   g++ -O2 -DESP_PLATFORM -I<dir with an empty sdkconfig.h> -I../src ../src/pixel_kernels.cpp pixel_kernels_bench.cpp
+#include "pixel_kernels.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+static const int FRAME_W = 320, FRAME_H = 170; // Back buffer
+static const int TILE_W = 32, TILE_H = 20;     // Flag art
+static const int SCALE = 4;                    // 128x80 on screen
+
+#define SCALAR __attribute__((noinline, optimize("no-tree-vectorize")))
+
+SCALAR static void referenceFill(uint16_t *dst, uint16_t color, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+         dst[i] = color;
+    }
+}
+
+SCALAR static void referenceBlit(uint16_t *dst, size_t stride, const uint16_t *src, int w, int h, int scale)
+{
+    for (int y = 0; y < h * scale; y++)
+    {
+         for (int x = 0; x < w * scale; x++)
+         {
+             dst[y * stride + x] = src[(y / scale) * w + x / scale];
+         }
+    }
+}
+
+SCALAR static void referenceSwap(uint16_t *dst, const uint16_t *src, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+         dst[i] = (uint16_t)((src[i] >> 8) | (src[i] << 8));
+    }
+}
+
+// Mean nanoseconds per call; the volatile sink keeps the work from being optimised away.
+template <typename F>
+static double timeIt(F body, int iterations)
+{
+    static volatile uint16_t sink;
+    (void)sink;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++)
+    {
+         sink = body(i);
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    return std::chrono::duration<double, std::nano>(elapsed).count() / iterations;
+}
+
+static int failures = 0;
+
+static void expectSame(const char *what, const std::vector<uint16_t> &a, const std::vector<uint16_t> &b)
+{
+    if (a != b)
+    {
+         printf("MISMATCH in %s\n", what);
+         failures++;
+    }
+}
+
+static void report(const char *name, double referenceNs, double kernelNs, size_t pixels)
+{
+    printf("%-28s reference %9.0f ns   kernel %9.0f ns   %5.1fx   %6.2f Gpx/s\n",
+           name, referenceNs, kernelNs, referenceNs / kernelNs, pixels / kernelNs);
+}
+
+int main()
+{
+    const size_t framePixels = FRAME_W * FRAME_H;
+    std::vector<uint16_t> tile(TILE_W * TILE_H), frameA(framePixels + 1), frameB(framePixels + 1);
+    for (size_t i = 0; i < tile.size(); i++)
+    {
+         tile[i] = (uint16_t)(rand() & 0xFFFF);
+    }
+
+    // Correctness, including odd lengths and offsets that miss the word/vector alignment
+    for (size_t offset = 0; offset < 3; offset++)
+    {
+         for (size_t count : {(size_t)0, (size_t)1, (size_t)7, (size_t)33, framePixels - offset})
+         {
+             std::fill(frameA.begin(), frameA.end(), 0);
+             std::fill(frameB.begin(), frameB.end(), 0);
+             referenceFill(frameA.data() + offset, 0xF81F, count);
+             rgb565Fill(frameB.data() + offset, 0xF81F, count);
+             expectSame("fill", frameA, frameB);
+
+             for (size_t i = 0; i < frameA.size(); i++)
+             {
+                 frameA[i] = frameB[i] = (uint16_t)(i * 2654435761u >> 7);
+             }
+             referenceSwap(frameA.data() + offset, frameA.data() + offset, count);
+             rgb565Swap(frameB.data() + offset, frameB.data() + offset, count);
+             expectSame("swap", frameA, frameB);
+         }
+         for (int scale = 1; scale <= 5; scale++)
+         {
+             std::fill(frameA.begin(), frameA.end(), 0);
+             std::fill(frameB.begin(), frameB.end(), 0);
+             referenceBlit(frameA.data() + offset, FRAME_W, tile.data(), TILE_W, TILE_H, scale);
+             rgb565ScaleBlit(frameB.data() + offset, FRAME_W, tile.data(), TILE_W, TILE_H, scale);
+             expectSame("scale blit", frameA, frameB);
+         }
+    }
+
+    const int iterations = 2000;
+    uint16_t *frame = frameA.data();
+    uint16_t *flagAt = frame + 45 * FRAME_W + 176; // Where the job screen puts the flag
+
+    printf("pixel kernels (%s path)\n", pixelKernelsPath());
+    report("fill 320x170",
+           timeIt([&](int i) { referenceFill(frame, (uint16_t)i, framePixels); return frame[i % framePixels]; }, iterations),
+           timeIt([&](int i) { rgb565Fill(frame, (uint16_t)i, framePixels); return frame[i % framePixels]; }, iterations),
+           framePixels);
+    report("scale blit 32x20 -> 128x80",
+           timeIt([&](int i) { referenceBlit(flagAt, FRAME_W, tile.data(), TILE_W, TILE_H, SCALE); return flagAt[i % 128]; }, iterations),
+           timeIt([&](int i) { rgb565ScaleBlit(flagAt, FRAME_W, tile.data(), TILE_W, TILE_H, SCALE); return flagAt[i % 128]; }, iterations),
+           TILE_W * TILE_H * SCALE * SCALE);
+    report("byte swap 320x170",
+           timeIt([&](int i) { referenceSwap(frame, frame, framePixels); return frame[i % framePixels]; }, iterations),
+           timeIt([&](int i) { rgb565Swap(frame, frame, framePixels); return frame[i % framePixels]; }, iterations),
+           framePixels);
+
+    if (failures)
+    {
+         printf("%d mismatches\n", failures);
+         return 1;
+    }
+    printf("all kernels match the reference\n");
+    return 0;
+}